@@ -29,6 +29,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <tuple>
+
 #include <ocs2_core/PreComputation.h>
 #include <ocs2_core/Types.h>
 #include <ocs2_core/constraint/StateConstraint.h>
@@ -62,6 +64,15 @@ class StateAugmentedLagrangianInterface {
   virtual std::pair<Multiplier, scalar_t> updateLagrangian(scalar_t time, const vector_t& state, const vector_t& constraint,
                                                            const Multiplier& multiplier) const = 0;
 
+  /**
+   * Update Lagrange/penalty multipliers and the penalty function value in place. The default implementation calls updateLagrangian.
+   * Override it to update the multipliers without allocation.
+   */
+  virtual void updateLagrangianInPlace(scalar_t time, const vector_t& state, const vector_t& constraint, Multiplier& multiplier,
+                                       scalar_t& penalty) const {
+    std::tie(multiplier, penalty) = updateLagrangian(time, state, constraint, multiplier);
+  }
+
   /** Initialize Lagrange/penalty multipliers. */
   virtual Multiplier initializeLagrangian(scalar_t time) const = 0;
 
@@ -70,6 +70,9 @@ class StateInputAugmentedLagrangian final : public StateInputAugmentedLagrangian
   std::pair<Multiplier, scalar_t> updateLagrangian(scalar_t time, const vector_t& /*state*/, const vector_t& /*input*/,
                                                    const vector_t& constraint, const Multiplier& multiplier) const override;
 
+  void updateLagrangianInPlace(scalar_t time, const vector_t& /*state*/, const vector_t& /*input*/, const vector_t& constraint,
+                               Multiplier& multiplier, scalar_t& penalty) const override;
+
   Multiplier initializeLagrangian(scalar_t time) const override;
 
   /** Gets the wrapped constraint. */
@@ -29,6 +29,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <tuple>
+
 #include <ocs2_core/PreComputation.h>
 #include <ocs2_core/Types.h>
 #include <ocs2_core/constraint/StateInputConstraint.h>
@@ -63,6 +65,15 @@ class StateInputAugmentedLagrangianInterface {
   virtual std::pair<Multiplier, scalar_t> updateLagrangian(scalar_t time, const vector_t& state, const vector_t& input,
                                                            const vector_t& constraint, const Multiplier& lagrangian) const = 0;
 
+  /**
+   * Update Lagrange/penalty multipliers and the penalty function value in place. The default implementation calls updateLagrangian.
+   * Override it to update the multipliers without allocation.
+   */
+  virtual void updateLagrangianInPlace(scalar_t time, const vector_t& state, const vector_t& input, const vector_t& constraint,
+                                       Multiplier& multiplier, scalar_t& penalty) const {
+    std::tie(multiplier, penalty) = updateLagrangian(time, state, input, constraint, multiplier);
+  }
+
   /** Initialize Lagrange/penalty multipliers. */
   virtual Multiplier initializeLagrangian(scalar_t time) const = 0;
 
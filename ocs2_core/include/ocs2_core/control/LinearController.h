@@ -105,6 +105,9 @@ class LinearController final : public ControllerBase {
  private:
   void flattenSingle(scalar_t time, std::vector<float>& flatArray) const;
 
+  /** The rollouts query computeInput at increasing times. */
+  LinearInterpolation::Cursor cursor_;
+
  public:
   scalar_array_t timeStamp_;
   vector_array_t biasArray_;
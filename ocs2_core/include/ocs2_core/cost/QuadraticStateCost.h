@@ -53,6 +53,10 @@ class QuadraticStateCost : public StateCost {
                                                                  const TargetTrajectories& targetTrajectories,
                                                                  const PreComputation&) const final;
 
+  /** Adds the cost term quadratic approximation to the accumulator without creating an intermediate approximation */
+  void accumulateQuadraticApproximation(scalar_t time, const vector_t& state, const TargetTrajectories& targetTrajectories,
+                                        const PreComputation&, ScalarFunctionQuadraticApproximation& accumulator) const final;
+
  protected:
   QuadraticStateCost(const QuadraticStateCost& rhs) = default;
 
@@ -60,6 +64,9 @@ class QuadraticStateCost : public StateCost {
    * This method can be overwritten if desiredTrajectory has a different dimensions. */
   virtual vector_t getStateDeviation(scalar_t time, const vector_t& state, const TargetTrajectories& targetTrajectories) const;
 
+  /** The cursor of the target trajectories lookup. The cost is cloned for every worker thread, therefore it is not shared. */
+  mutable LinearInterpolation::Cursor targetCursor_;
+
  private:
   matrix_t Q_;
 };
@@ -58,6 +58,11 @@ class QuadraticStateInputCost : public StateInputCost {
                                                                  const TargetTrajectories& targetTrajectories,
                                                                  const PreComputation&) const final;
 
+  /** Adds the cost term quadratic approximation to the accumulator without creating an intermediate approximation */
+  void accumulateQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input,
+                                        const TargetTrajectories& targetTrajectories, const PreComputation&,
+                                        ScalarFunctionQuadraticApproximation& accumulator) const final;
+
  protected:
   QuadraticStateInputCost(const QuadraticStateInputCost& rhs) = default;
 
@@ -66,6 +71,9 @@ class QuadraticStateInputCost : public StateInputCost {
   virtual std::pair<vector_t, vector_t> getStateInputDeviation(scalar_t time, const vector_t& state, const vector_t& input,
                                                                const TargetTrajectories& targetTrajectories) const;
 
+  /** The cursor of the target trajectories lookup. The cost is cloned for every worker thread, therefore it is not shared. */
+  mutable LinearInterpolation::Cursor targetCursor_;
+
  private:
   matrix_t Q_;
   matrix_t R_;
@@ -56,6 +56,18 @@ class StateCost {
                                                                          const TargetTrajectories& targetTrajectories,
                                                                          const PreComputation& preComp) const = 0;
 
+  /**
+   * Adds the cost term quadratic approximation to the state derivatives of the accumulator. The default implementation adds the
+   * result of getQuadraticApproximation(). Terms may override it to write into the accumulator directly.
+   */
+  virtual void accumulateQuadraticApproximation(scalar_t time, const vector_t& state, const TargetTrajectories& targetTrajectories,
+                                                const PreComputation& preComp, ScalarFunctionQuadraticApproximation& accumulator) const {
+    const auto approximation = getQuadraticApproximation(time, state, targetTrajectories, preComp);
+    accumulator.f += approximation.f;
+    accumulator.dfdx += approximation.dfdx;
+    accumulator.dfdxx += approximation.dfdxx;
+  }
+
  protected:
   StateCost(const StateCost& rhs) = default;
 };
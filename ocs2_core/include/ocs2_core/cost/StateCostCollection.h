@@ -59,6 +59,13 @@ class StateCostCollection : public Collection<StateCost> {
                                                                          const TargetTrajectories& targetTrajectories,
                                                                          const PreComputation& preComp) const;
 
+  /**
+   * Adds the quadratic approximation of the active terms to the state derivatives of the accumulator in a single pass. The input
+   * derivatives of the accumulator are not touched.
+   */
+  virtual void accumulateQuadraticApproximation(scalar_t time, const vector_t& state, const TargetTrajectories& targetTrajectories,
+                                                const PreComputation& preComp, ScalarFunctionQuadraticApproximation& accumulator) const;
+
  protected:
   /** Copy constructor */
   StateCostCollection(const StateCostCollection& other);
@@ -34,7 +34,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace ocs2 {
 
-enum class SensitivityIntegratorType { EULER, RK2, RK4 };
+enum class SensitivityIntegratorType { EULER, RK2, RK4, IMPLICIT_EULER, IMPLICIT_MIDPOINT };
 
 namespace sensitivity_integrator {
 
@@ -76,4 +76,37 @@ vector_t rk4Discretization(SystemDynamicsBase& system, scalar_t t, const vector_
 VectorFunctionLinearApproximation rk4SensitivityDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u,
                                                                scalar_t dt);
 
+/**
+ * Computes the discretized dynamics. Uses an implicit (backward) euler discretization, which is L-stable and therefore suited for
+ * stiff systems. The implicit equation is solved by a simplified Newton method, which throws std::runtime_error if it does not
+ * converge.
+ * Returns x_{k+1}
+ */
+vector_t implicitEulerDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u, scalar_t dt);
+
+/**
+ * Creates a linear approximation of the discretized dynamics. Uses an implicit (backward) euler discretization. The sensitivities
+ * are exact for the converged implicit step (implicit function theorem).
+ * Returns an approximation of the form:
+ *      x_{k+1} = A_{k} * dx_{k} + B_{k} * du_{k} + b_{k}
+ */
+VectorFunctionLinearApproximation implicitEulerSensitivityDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x,
+                                                                         const vector_t& u, scalar_t dt);
+
+/**
+ * Computes the discretized dynamics. Uses an implicit midpoint discretization, which is A-stable and of 2nd order.
+ * The implicit equation is solved by a simplified Newton method, which throws std::runtime_error if it does not converge.
+ * Returns x_{k+1}
+ */
+vector_t implicitMidpointDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u, scalar_t dt);
+
+/**
+ * Creates a linear approximation of the discretized dynamics. Uses an implicit midpoint discretization. The sensitivities
+ * are exact for the converged implicit step (implicit function theorem).
+ * Returns an approximation of the form:
+ *      x_{k+1} = A_{k} * dx_{k} + B_{k} * du_{k} + b_{k}
+ */
+VectorFunctionLinearApproximation implicitMidpointSensitivityDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x,
+                                                                            const vector_t& u, scalar_t dt);
+
 }  // namespace ocs2
\ No newline at end of file
@@ -69,7 +69,19 @@ class LoopshapingDefinition {
   scalar_t loopshapingCost(const vector_t& filteredInput) const { return 0.5 * filteredInput.dot(R_ * filteredInput); }
 
   /** Get the quadratic cost matrix for the filtered inputs */
-  matrix_t& costMatrix() { return R_; }
+  const matrix_t& costMatrix() const { return R_; }
+
+  /** Set the quadratic cost matrix for the filtered inputs */
+  void setCostMatrix(matrix_t costMatrix);
+
+  /**
+   * Get the constant blocks of the loopshaping cost Hessian w.r.t. the filter state and the augmented input. For the output pattern,
+   * the filtered input is C * filterState + D * input, which results in the blocks C'RC, D'RC, and D'RD. They are only computed for
+   * the output pattern.
+   */
+  const matrix_t& costHessianFilterState() const { return CtRC_; }
+  const matrix_t& costHessianInputFilterState() const { return DtRC_; }
+  const matrix_t& costHessianInput() const { return DtRD_; }
 
   /** Display details of the LoopshapingDefinition  */
   void print() const;
@@ -148,6 +160,7 @@ class LoopshapingDefinition {
   LoopshapingType loopshapingType_;
   bool diagonal_;
   matrix_t R_;
+  matrix_t CtRC_, DtRC_, DtRD_;
 };
 
 }  // namespace ocs2
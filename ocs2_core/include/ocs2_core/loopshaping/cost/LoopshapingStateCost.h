@@ -56,6 +56,15 @@ class LoopshapingStateCost final : public StateCostCollection {
                                                                  const TargetTrajectories& targetTrajectories,
                                                                  const PreComputation& preComp) const override;
 
+  /** The decorator approximates the system cost as a whole, hence it accumulates its getQuadraticApproximation(). */
+  void accumulateQuadraticApproximation(scalar_t t, const vector_t& x, const TargetTrajectories& targetTrajectories,
+                                        const PreComputation& preComp, ScalarFunctionQuadraticApproximation& accumulator) const override {
+    const auto approximation = getQuadraticApproximation(t, x, targetTrajectories, preComp);
+    accumulator.f += approximation.f;
+    accumulator.dfdx += approximation.dfdx;
+    accumulator.dfdxx += approximation.dfdxx;
+  }
+
  private:
   LoopshapingStateCost(const LoopshapingStateCost& other) = default;
 
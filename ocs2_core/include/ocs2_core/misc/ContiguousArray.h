@@ -0,0 +1,238 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <cassert>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ocs2_core/Types.h"
+#include "ocs2_core/misc/LinearInterpolation.h"
+
+namespace ocs2 {
+
+/**
+ * An array of Eigen vectors or matrices which stores all the coefficients in one contiguous buffer. The nodes are accessed through
+ * Eigen::Map views. Compared to std::vector<vector_t>, a copy is a single allocation, and a trajectory of equally sized nodes is a
+ * strided view of the buffer which can be flattened with a single copy. The nodes may have different sizes.
+ *
+ * The container is opt-in: PrimalSolution and the controllers keep their std::vector trajectories, and TrajectorySpreading can adjust
+ * a ContiguousArray in place. Use it for the trajectories which are copied or flattened often.
+ *
+ * @note Adding nodes may reallocate the buffer, which invalidates the views of the nodes.
+ *
+ * @tparam Data: vector_t or matrix_t.
+ */
+template <typename Data>
+class ContiguousArray {
+ public:
+  using map_t = Eigen::Map<Data>;
+  using const_map_t = Eigen::Map<const Data>;
+
+  ContiguousArray() = default;
+
+  /** Copies the nodes of an array. */
+  template <class Alloc>
+  explicit ContiguousArray(const std::vector<Data, Alloc>& array) {
+    assign(array);
+  }
+
+  /** Copies the nodes of an array and reuses the memory of this array. */
+  template <class Alloc>
+  void assign(const std::vector<Data, Alloc>& array) {
+    clear();
+    size_t numCoefficients = 0;
+    for (const auto& node : array) {
+      numCoefficients += node.size();
+    }
+    reserve(array.size(), numCoefficients);
+    for (const auto& node : array) {
+      push_back(node);
+    }
+  }
+
+  /** Converts to an array of separately allocated nodes. */
+  std::vector<Data> toArray() const {
+    std::vector<Data> array;
+    array.reserve(size());
+    for (size_t i = 0; i < size(); i++) {
+      array.emplace_back((*this)[i]);
+    }
+    return array;
+  }
+
+  size_t size() const { return nodes_.size(); }
+  bool empty() const { return nodes_.empty(); }
+
+  /** Removes all nodes. The memory is kept. */
+  void clear() {
+    buffer_.clear();
+    nodes_.clear();
+  }
+
+  /**
+   * Reserves memory.
+   *
+   * @param [in] numNodes: The number of nodes.
+   * @param [in] numCoefficients: The total number of coefficients of all nodes.
+   */
+  void reserve(size_t numNodes, size_t numCoefficients) {
+    nodes_.reserve(numNodes);
+    buffer_.reserve(numCoefficients);
+  }
+
+  /** Appends a copy of the node. The node may be a view of this array. */
+  void push_back(const Eigen::Ref<const Data>& node) {
+    // the resize below may reallocate the buffer which a view of this array points to
+    const std::less<const scalar_t*> isLess;
+    if (!buffer_.empty() && !isLess(node.data(), buffer_.data()) && isLess(node.data(), buffer_.data() + buffer_.size())) {
+      const Data copy = node;
+      push_back(copy);
+      return;
+    }
+
+    nodes_.push_back({buffer_.size(), static_cast<int>(node.rows()), static_cast<int>(node.cols())});
+    buffer_.resize(buffer_.size() + node.size());
+    map_t(buffer_.data() + nodes_.back().offset, node.rows(), node.cols()) = node;
+  }
+
+  /** Appends a node of the given size with uninitialized coefficients. */
+  map_t emplace_back(int rows, int cols = 1) {
+    nodes_.push_back({buffer_.size(), rows, cols});
+    buffer_.resize(buffer_.size() + rows * cols);
+    return (*this)[nodes_.size() - 1];
+  }
+
+  /** Removes the nodes from numNodes to the end. Throws std::out_of_range if the array has less than numNodes nodes. */
+  void truncate(size_t numNodes) {
+    if (numNodes > size()) {
+      throw std::out_of_range("[ContiguousArray::truncate] The array has less than " + std::to_string(numNodes) + " nodes!");
+    }
+    buffer_.resize(numNodes < size() ? nodes_[numNodes].offset : buffer_.size());
+    nodes_.resize(numNodes);
+  }
+
+  map_t operator[](size_t i) {
+    const auto& node = nodes_[i];
+    return map_t(buffer_.data() + node.offset, node.rows, node.cols);
+  }
+
+  const_map_t operator[](size_t i) const {
+    const auto& node = nodes_[i];
+    return const_map_t(buffer_.data() + node.offset, node.rows, node.cols);
+  }
+
+  map_t front() { return (*this)[0]; }
+  const_map_t front() const { return (*this)[0]; }
+  map_t back() { return (*this)[size() - 1]; }
+  const_map_t back() const { return (*this)[size() - 1]; }
+
+  /** The coefficients of all nodes, in order of the nodes and column-major within a node. */
+  const scalar_array_t& coefficients() const { return buffer_; }
+
+  /** Whether all the nodes have the same size. */
+  bool isUniform() const {
+    for (const auto& node : nodes_) {
+      if (node.rows != nodes_.front().rows || node.cols != nodes_.front().cols) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * A view of a uniform array as a matrix with the coefficients of one node per column.
+   * Throws std::runtime_error if the nodes have different sizes.
+   */
+  Eigen::Map<const matrix_t> asMatrix() const {
+    if (!isUniform()) {
+      throw std::runtime_error("[ContiguousArray::asMatrix] The nodes have different sizes!");
+    }
+    const auto numRows = empty() ? 0 : nodes_.front().rows * nodes_.front().cols;
+    return Eigen::Map<const matrix_t>(buffer_.data(), numRows, size());
+  }
+
+  /** The allocated memory in bytes. */
+  size_t memoryInBytes() const { return buffer_.capacity() * sizeof(scalar_t) + nodes_.capacity() * sizeof(Node); }
+
+ private:
+  struct Node {
+    size_t offset;
+    int rows;
+    int cols;
+  };
+
+  scalar_array_t buffer_;
+  std::vector<Node> nodes_;
+};
+
+/** Contiguous dynamic vector's trajectory type. */
+using contiguous_vector_array_t = ContiguousArray<vector_t>;
+/** Contiguous dynamic matrix's trajectory type. */
+using contiguous_matrix_array_t = ContiguousArray<matrix_t>;
+
+namespace LinearInterpolation {
+
+/** Same as interpolate for std::vector, see LinearInterpolation.h. */
+template <typename Data>
+Data interpolate(index_alpha_t indexAlpha, const ContiguousArray<Data>& dataArray) {
+  assert(dataArray.size() > 0);
+  if (dataArray.size() > 1) {
+    const int index = indexAlpha.first;
+    const scalar_t alpha = indexAlpha.second;
+    const auto lhs = dataArray[index];
+    const auto rhs = dataArray[index + 1];
+    if (lhs.rows() == rhs.rows() && lhs.cols() == rhs.cols()) {
+      return alpha * lhs + (scalar_t(1.0) - alpha) * rhs;
+    } else {
+      return (alpha > 0.5) ? Data(lhs) : Data(rhs);
+    }
+  } else {  // dataArray.size() == 1
+    return dataArray[0];
+  }
+}
+
+/** Same as interpolate for std::vector, see LinearInterpolation.h. */
+template <typename Data>
+Data interpolate(scalar_t enquiryTime, const scalar_array_t& timeArray, const ContiguousArray<Data>& dataArray) {
+  return interpolate(timeSegment(enquiryTime, timeArray), dataArray);
+}
+
+/** Same as interpolate for std::vector, see LinearInterpolation.h. */
+template <typename Data>
+Data interpolate(scalar_t enquiryTime, const scalar_array_t& timeArray, const ContiguousArray<Data>& dataArray, Cursor& cursor) {
+  return interpolate(timeSegment(enquiryTime, timeArray, cursor), dataArray);
+}
+
+}  // namespace LinearInterpolation
+
+}  // namespace ocs2
@@ -53,6 +53,28 @@ using remove_cvref_t = typename std::remove_cv<typename std::remove_reference<T>
  */
 index_alpha_t timeSegment(scalar_t enquiryTime, const std::vector<scalar_t>& timeArray);
 
+/**
+ * Remembers the position of the previous enquiry in a time array. Enquiries at nearby times, e.g., the increasing times of a
+ * rollout, are then found in amortized constant time instead of by a binary search over the whole array.
+ *
+ * The interpolation result does not depend on the cursor. Therefore, a cursor can be kept over changes of the time array, but it
+ * should not be shared between threads.
+ */
+struct Cursor {
+  /** The lower bound index of the previous enquiry, see lookup::findIndexInTimeArray. */
+  int index = 0;
+};
+
+/**
+ * Same as timeSegment, but the search starts at the previous enquiry of the cursor.
+ *
+ * @param [in] enquiryTime: The enquiry time for interpolation.
+ * @param [in] timeArray: interpolation time array.
+ * @param [in, out] cursor: The cursor into the timeArray, updated to the enquiryTime.
+ * @return {index, alpha}
+ */
+index_alpha_t timeSegment(scalar_t enquiryTime, const std::vector<scalar_t>& timeArray, Cursor& cursor);
+
 /**
  * Directly uses the index and interpolation coefficient provided by the user
  * @note If sizes in data array are not equal, the interpolation will snap to the data
@@ -92,6 +114,22 @@ Data interpolate(index_alpha_t indexAlpha, const std::vector<Data, Alloc>& dataA
 template <typename Data, class Alloc>
 Data interpolate(scalar_t enquiryTime, const std::vector<scalar_t>& timeArray, const std::vector<Data, Alloc>& dataArray);
 
+/**
+ * Same as interpolate, but the time segment is found with a cursor.
+ *
+ * @param [in] enquiryTime: The enquiry time for interpolation.
+ * @param [in] timeArray: Times vector
+ * @param [in] dataArray: Data vector
+ * @param [in, out] cursor: The cursor into the timeArray, updated to the enquiryTime.
+ * @return The interpolation result
+ *
+ * @tparam Data: Data type
+ * @tparam Alloc: Specialized allocation class
+ */
+template <typename Data, class Alloc>
+Data interpolate(scalar_t enquiryTime, const std::vector<scalar_t>& timeArray, const std::vector<Data, Alloc>& dataArray,
+                 Cursor& cursor);
+
 /**
  * Directly uses the index and interpolation coefficient provided by the user
  * @note If sizes in data array are not equal, the interpolation will snap to the data
@@ -91,6 +91,46 @@ int findIndexInTimeArray(const std::vector<SCALAR>& timeArray, SCALAR time) {
   return static_cast<int>(firstLargerValueIterator - timeArray.begin());
 }
 
+/**
+ * Same as findIndexInTimeArray, but the search starts at a hint, e.g., the index of the previous enquiry. The search steps
+ * exponentially away from the hint, such that its cost is logarithmic in the distance between the hint and the result rather than
+ * in the size of the timeArray. The result does not depend on the hint.
+ *
+ * @tparam SCALAR : numerical type of time
+ * @param timeArray : sorted time array to perform the lookup in
+ * @param time : enquiry time
+ * @param hint : initial guess of the index, clamped to [0, size(timeArray)]
+ * @return index between [0, size(timeArray)]
+ */
+template <typename SCALAR = double>
+int findIndexInTimeArray(const std::vector<SCALAR>& timeArray, SCALAR time, int hint) {
+  const auto size = static_cast<int>(timeArray.size());
+  hint = std::min(std::max(hint, 0), size);
+
+  if (hint < size && timeArray[hint] < time) {
+    // search forward, invariant: timeArray[lower] < time
+    int lower = hint;
+    int step = 1;
+    while (lower + step < size && timeArray[lower + step] < time) {
+      lower += step;
+      step *= 2;
+    }
+    const auto upper = std::min(lower + step, size);
+    return static_cast<int>(std::lower_bound(timeArray.begin() + lower + 1, timeArray.begin() + upper, time) - timeArray.begin());
+
+  } else {
+    // search backward, invariant: upper == size or time <= timeArray[upper]
+    int upper = hint;
+    int step = 1;
+    while (upper - step >= 0 && !(timeArray[upper - step] < time)) {
+      upper -= step;
+      step *= 2;
+    }
+    const auto lower = std::max(upper - step + 1, 0);
+    return static_cast<int>(std::lower_bound(timeArray.begin() + lower, timeArray.begin() + upper, time) - timeArray.begin());
+  }
+}
+
 /**
  *  Find interval into a sorted time Array
  *
@@ -113,6 +113,15 @@ class MultidimensionalPenalty final {
    */
   vector_t updateMultipliers(scalar_t t, const vector_t& h, const vector_t& l) const;
 
+  /**
+   * Updates the Lagrange multipliers in place.
+   *
+   * @param [in] t: The time stamp.
+   * @param [in] h: The vector of constraint values.
+   * @param [in, out] l: The Lagrange multipliers which are overwritten by the updated ones.
+   */
+  void updateMultipliersInPlace(scalar_t t, const vector_t& h, vector_t& l) const;
+
   /**
    * Initializes the Lagrange multipliers.
    *
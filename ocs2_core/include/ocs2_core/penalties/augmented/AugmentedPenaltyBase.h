@@ -102,6 +102,48 @@ class AugmentedPenaltyBase {
    */
   virtual scalar_t initializeMultiplier() const = 0;
 
+  /**
+   * Compute the sum of the penalty values over a vector of constraint values.
+   * The default implementation calls getValue per constraint. Override it for a vectorized evaluation.
+   *
+   * @param [in] t: The time that the constraints are evaluated.
+   * @param [in] l: The Lagrange multipliers. If nullptr, the multipliers are zero.
+   * @param [in] h: Vector of constraint values.
+   * @return sum of the penalty costs.
+   */
+  virtual scalar_t getBatchValue(scalar_t t, const vector_t* l, const vector_t& h) const {
+    scalar_t value = 0.0;
+    for (Eigen::Index i = 0; i < h.size(); i++) {
+      value += getValue(t, (l == nullptr) ? 0.0 : (*l)(i), h(i));
+    }
+    return value;
+  }
+
+  /**
+   * Compute the sum of the penalty values, and the penalty derivatives and second derivatives over a vector of constraint values.
+   * The default implementation calls the scalar methods per constraint. Override it for a vectorized evaluation.
+   *
+   * @param [in] t: The time that the constraints are evaluated.
+   * @param [in] l: The Lagrange multipliers. If nullptr, the multipliers are zero.
+   * @param [in] h: Vector of constraint values.
+   * @param [out] derivative: penalty derivatives with respect to the constraint values.
+   * @param [out] secondDerivative: penalty second derivatives with respect to the constraint values.
+   * @return sum of the penalty costs.
+   */
+  virtual scalar_t getBatchValue1stDev2ndDev(scalar_t t, const vector_t* l, const vector_t& h, vector_t& derivative,
+                                             vector_t& secondDerivative) const {
+    derivative.resize(h.size());
+    secondDerivative.resize(h.size());
+    scalar_t value = 0.0;
+    for (Eigen::Index i = 0; i < h.size(); i++) {
+      const scalar_t li = (l == nullptr) ? 0.0 : (*l)(i);
+      value += getValue(t, li, h(i));
+      derivative(i) = getDerivative(t, li, h(i));
+      secondDerivative(i) = getSecondDerivative(t, li, h(i));
+    }
+    return value;
+  }
+
  protected:
   AugmentedPenaltyBase(const AugmentedPenaltyBase& other) = default;
 };
@@ -80,6 +80,44 @@ class PenaltyBase {
    */
   virtual scalar_t getSecondDerivative(scalar_t t, scalar_t h) const = 0;
 
+  /**
+   * Compute the sum of the penalty values over a vector of constraint values.
+   * The default implementation calls getValue per constraint. Override it for a vectorized evaluation.
+   *
+   * @param [in] t: The time that the constraints are evaluated.
+   * @param [in] h: Vector of constraint values.
+   * @return sum of the penalty costs.
+   */
+  virtual scalar_t getBatchValue(scalar_t t, const vector_t& h) const {
+    scalar_t value = 0.0;
+    for (Eigen::Index i = 0; i < h.size(); i++) {
+      value += getValue(t, h(i));
+    }
+    return value;
+  }
+
+  /**
+   * Compute the sum of the penalty values, and the penalty derivatives and second derivatives over a vector of constraint values.
+   * The default implementation calls the scalar methods per constraint. Override it for a vectorized evaluation.
+   *
+   * @param [in] t: The time that the constraints are evaluated.
+   * @param [in] h: Vector of constraint values.
+   * @param [out] derivative: penalty derivatives with respect to the constraint values.
+   * @param [out] secondDerivative: penalty second derivatives with respect to the constraint values.
+   * @return sum of the penalty costs.
+   */
+  virtual scalar_t getBatchValue1stDev2ndDev(scalar_t t, const vector_t& h, vector_t& derivative, vector_t& secondDerivative) const {
+    derivative.resize(h.size());
+    secondDerivative.resize(h.size());
+    scalar_t value = 0.0;
+    for (Eigen::Index i = 0; i < h.size(); i++) {
+      value += getValue(t, h(i));
+      derivative(i) = getDerivative(t, h(i));
+      secondDerivative(i) = getSecondDerivative(t, h(i));
+    }
+    return value;
+  }
+
  protected:
   PenaltyBase(const PenaltyBase& other) = default;
 };
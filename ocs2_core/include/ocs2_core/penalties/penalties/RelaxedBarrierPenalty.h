@@ -74,6 +74,8 @@ class RelaxedBarrierPenalty final : public PenaltyBase {
   scalar_t getValue(scalar_t t, scalar_t h) const override;
   scalar_t getDerivative(scalar_t t, scalar_t h) const override;
   scalar_t getSecondDerivative(scalar_t t, scalar_t h) const override;
+  scalar_t getBatchValue(scalar_t t, const vector_t& h) const override;
+  scalar_t getBatchValue1stDev2ndDev(scalar_t t, const vector_t& h, vector_t& derivative, vector_t& secondDerivative) const override;
 
  private:
   RelaxedBarrierPenalty(const RelaxedBarrierPenalty& other) = default;
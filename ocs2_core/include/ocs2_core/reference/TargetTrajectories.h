@@ -32,6 +32,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ostream>
 
 #include "ocs2_core/Types.h"
+#include "ocs2_core/misc/LinearInterpolation.h"
 
 namespace ocs2 {
 
@@ -52,6 +53,10 @@ struct TargetTrajectories {
   vector_t getDesiredState(scalar_t time) const;
   vector_t getDesiredInput(scalar_t time) const;
 
+  /** Same as getDesiredState and getDesiredInput, but the time is looked up with a cursor, e.g., of the cost term. */
+  vector_t getDesiredState(scalar_t time, LinearInterpolation::Cursor& cursor) const;
+  vector_t getDesiredInput(scalar_t time, LinearInterpolation::Cursor& cursor) const;
+
   scalar_array_t timeTrajectory;
   vector_array_t stateTrajectory;
   vector_array_t inputTrajectory;
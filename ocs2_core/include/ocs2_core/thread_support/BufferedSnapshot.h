@@ -0,0 +1,111 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace ocs2 {
+
+/**
+ * Wraps a value with a thread-safe buffer, like BufferedValue, but keeps the active value in an immutable, reference-counted
+ * snapshot. A snapshot of the active value can be taken without copying and it remains valid and unchanged after the active
+ * value has been replaced or modified, i.e. the active value is copy-on-write.
+ *
+ * Multiple threads can set new values to the buffer. Publishing a value and activating it are pointer swaps. As for
+ * BufferedValue, only one thread should access/modify the active value and take snapshots of it (i.e. not simultaneously
+ * calling get(), getMutable(), getSnapshot() and updateFromBuffer()). The snapshots themselves can be read by any thread.
+ *
+ * @tparam T : wrapped type
+ */
+template <typename T>
+class BufferedSnapshot {
+ public:
+  using snapshot_ptr_t = std::shared_ptr<const T>;
+
+  /**
+   * Constructor initializes with a given value and an empty buffer.
+   * @param value
+   */
+  explicit BufferedSnapshot(T value) : activeValuePtr_(std::make_shared<T>(std::move(value))), bufferPtr_(nullptr) {}
+
+  /** Read the currently active value. */
+  const T& get() const { return *activeValuePtr_; }
+
+  /**
+   * Read/write the currently active value. If snapshots of the active value are still held, the value is copied first so that the
+   * snapshots remain unchanged.
+   */
+  T& getMutable() {
+    if (activeValuePtr_.use_count() > 1) {
+      activeValuePtr_ = std::make_shared<T>(*activeValuePtr_);
+    }
+    return *activeValuePtr_;
+  }
+
+  /** Returns a snapshot of the currently active value without copying it. */
+  snapshot_ptr_t getSnapshot() const { return activeValuePtr_; }
+
+  /** The number of times the active value has been replaced by the buffer. */
+  size_t version() const { return version_.load(std::memory_order_acquire); }
+
+  /** Copy a new value into the buffer. */
+  void setBuffer(const T& value) { std::atomic_store(&bufferPtr_, std::make_shared<T>(value)); }
+
+  /** Move a new value into the buffer. */
+  void setBuffer(T&& value) { std::atomic_store(&bufferPtr_, std::make_shared<T>(std::move(value))); }
+
+  /**
+   * Replaces the active value with the value in the buffer. Snapshots of the previous value are not affected.
+   * The active value is not protected so this method is NOT thread-safe w.r.t. get(), getMutable() and getSnapshot().
+   * The buffer is accessed atomically, so this method is thread-safe w.r.t. setBuffer()
+   * @return True: the active value was updated, False: the active value was not updated.
+   */
+  bool updateFromBuffer() {
+    // The exchanged pointer is null if there was no new value set.
+    std::shared_ptr<T> updatedValuePtr = std::atomic_exchange(&bufferPtr_, std::shared_ptr<T>(nullptr));
+
+    if (updatedValuePtr != nullptr) {
+      activeValuePtr_ = std::move(updatedValuePtr);
+      version_.fetch_add(1, std::memory_order_release);
+      return true;
+    } else {
+      return false;
+    }
+  }
+
+ private:
+  std::shared_ptr<T> activeValuePtr_;
+  std::shared_ptr<T> bufferPtr_;
+  std::atomic<size_t> version_{0};
+};
+
+}  // namespace ocs2
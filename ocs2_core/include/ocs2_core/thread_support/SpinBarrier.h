@@ -0,0 +1,125 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+namespace ocs2 {
+
+/**
+ * A reusable sense-reversing barrier for a fixed number of threads.
+ *
+ * Arriving threads first spin on the shared sense flag for a bounded number of iterations and then park on a condition variable.
+ * Short phases are therefore synchronized without a system call, while oversubscribed machines do not burn the cores that the
+ * remaining workers need. The last arriving thread runs an optional completion function before releasing the others, which gives
+ * a serial section between two parallel phases.
+ *
+ * All threads have to call arriveAndWait() the same number of times.
+ */
+class SpinBarrier {
+ public:
+  /**
+   * Constructor.
+   * @param [in] numThreads : The number of threads that take part in the barrier.
+   * @param [in] spinCount : The number of polls of the sense flag before a waiting thread is parked.
+   */
+  explicit SpinBarrier(size_t numThreads, size_t spinCount = 2048) : numThreads_(numThreads), spinCount_(spinCount) {}
+
+  SpinBarrier(const SpinBarrier&) = delete;
+  SpinBarrier& operator=(const SpinBarrier&) = delete;
+
+  /** Blocks until all threads have arrived. */
+  void arriveAndWait() {
+    arriveAndWait([] {});
+  }
+
+  /**
+   * Blocks until all threads have arrived. The last arriving thread calls the completion function before any thread is released.
+   * Everything written before arriving, including by the completion function, is visible to all threads after they are released.
+   *
+   * @param [in] completion : Function with signature void().
+   */
+  template <typename Completion>
+  void arriveAndWait(Completion&& completion) {
+    // The sense can only flip once this thread has arrived, so reading it here gives the sense of the current phase.
+    const bool nextSense = !sense_.load(std::memory_order_relaxed);
+
+    if (numArrived_.fetch_add(1, std::memory_order_acq_rel) + 1 == numThreads_) {
+      numArrived_.store(0, std::memory_order_relaxed);
+      completion();
+      // sequentially consistent store and load pair with the ones in the parking branch.
+      sense_.store(nextSense);
+      if (numParked_.load() > 0) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        wakeUp_.notify_all();
+      }
+      return;
+    }
+
+    for (size_t i = 0; i < spinCount_; ++i) {
+      if (sense_.load(std::memory_order_acquire) == nextSense) {
+        return;
+      }
+      pause();
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    ++numParked_;
+    wakeUp_.wait(lock, [&] { return sense_.load() == nextSense; });
+    --numParked_;
+  }
+
+  /** Number of threads that take part in the barrier. */
+  size_t numThreads() const { return numThreads_; }
+
+ private:
+  static void pause() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+  }
+
+  const size_t numThreads_;
+  const size_t spinCount_;
+
+  std::atomic<size_t> numArrived_{0};
+  std::atomic_bool sense_{false};
+
+  std::atomic<size_t> numParked_{0};
+  std::mutex mutex_;
+  std::condition_variable wakeUp_;
+};
+
+}  // namespace ocs2
@@ -77,9 +77,9 @@ size_t StateAugmentedLagrangian::getNumConstraints(scalar_t time) const {
 /******************************************************************************************************/
 LagrangianMetrics StateAugmentedLagrangian::getValue(scalar_t time, const vector_t& state, const Multiplier& multiplier,
                                                      const PreComputation& preComp) const {
-  const auto h = constraintPtr_->getValue(time, state, preComp);
+  auto h = constraintPtr_->getValue(time, state, preComp);
   const auto p = multiplier.penalty * penalty_.getValue(time, h, &multiplier.lagrangian);
-  return {p, h};
+  return {p, std::move(h)};
 }
 
 /******************************************************************************************************/
@@ -103,11 +103,21 @@ ScalarFunctionQuadraticApproximation StateAugmentedLagrangian::getQuadraticAppro
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-std::pair<Multiplier, scalar_t> StateAugmentedLagrangian::updateLagrangian(scalar_t time, const vector_t& /*state*/,
+std::pair<Multiplier, scalar_t> StateAugmentedLagrangian::updateLagrangian(scalar_t time, const vector_t& state,
                                                                            const vector_t& constraint, const Multiplier& multiplier) const {
-  const Multiplier updatedMultiplier{multiplier.penalty, penalty_.updateMultipliers(time, constraint, multiplier.lagrangian)};
-  const auto penalty = updatedMultiplier.penalty * penalty_.getValue(time, constraint, &updatedMultiplier.lagrangian);
-  return {updatedMultiplier, penalty};
+  Multiplier updatedMultiplier = multiplier;
+  scalar_t penalty;
+  updateLagrangianInPlace(time, state, constraint, updatedMultiplier, penalty);
+  return {std::move(updatedMultiplier), penalty};
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void StateAugmentedLagrangian::updateLagrangianInPlace(scalar_t time, const vector_t& /*state*/, const vector_t& constraint,
+                                                       Multiplier& multiplier, scalar_t& penalty) const {
+  penalty_.updateMultipliersInPlace(time, constraint, multiplier.lagrangian);
+  penalty = multiplier.penalty * penalty_.getValue(time, constraint, &multiplier.lagrangian);
 }
 
 /******************************************************************************************************/
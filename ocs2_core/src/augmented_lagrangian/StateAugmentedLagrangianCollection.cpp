@@ -115,10 +115,7 @@ void StateAugmentedLagrangianCollection::updateLagrangian(scalar_t time, const v
 
   for (size_t i = 0; i < terms_.size(); i++) {
     if (terms_[i]->isActive(time)) {
-      Multiplier updatedLagrangian;
-      std::tie(updatedLagrangian, termsMetrics[i].penalty) =
-          terms_[i]->updateLagrangian(time, state, termsMetrics[i].constraint, termsMultiplier[i]);
-      termsMultiplier[i] = std::move(updatedLagrangian);
+      terms_[i]->updateLagrangianInPlace(time, state, termsMetrics[i].constraint, termsMultiplier[i], termsMetrics[i].penalty);
     }
   }
 }
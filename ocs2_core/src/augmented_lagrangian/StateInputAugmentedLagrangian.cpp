@@ -77,9 +77,9 @@ size_t StateInputAugmentedLagrangian::getNumConstraints(scalar_t time) const {
 /******************************************************************************************************/
 LagrangianMetrics StateInputAugmentedLagrangian::getValue(scalar_t time, const vector_t& state, const vector_t& input,
                                                           const Multiplier& multiplier, const PreComputation& preComp) const {
-  const auto h = constraintPtr_->getValue(time, state, input, preComp);
+  auto h = constraintPtr_->getValue(time, state, input, preComp);
   const auto p = multiplier.penalty * penalty_.getValue(time, h, &multiplier.lagrangian);
-  return {p, h};
+  return {p, std::move(h)};
 }
 
 /******************************************************************************************************/
@@ -104,12 +104,22 @@ ScalarFunctionQuadraticApproximation StateInputAugmentedLagrangian::getQuadratic
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-std::pair<Multiplier, scalar_t> StateInputAugmentedLagrangian::updateLagrangian(scalar_t time, const vector_t& /*state*/,
-                                                                                const vector_t& /*input*/, const vector_t& constraint,
+std::pair<Multiplier, scalar_t> StateInputAugmentedLagrangian::updateLagrangian(scalar_t time, const vector_t& state,
+                                                                                const vector_t& input, const vector_t& constraint,
                                                                                 const Multiplier& multiplier) const {
-  const Multiplier updatedMultiplier{multiplier.penalty, penalty_.updateMultipliers(time, constraint, multiplier.lagrangian)};
-  const auto penalty = updatedMultiplier.penalty * penalty_.getValue(time, constraint, &updatedMultiplier.lagrangian);
-  return {updatedMultiplier, penalty};
+  Multiplier updatedMultiplier = multiplier;
+  scalar_t penalty;
+  updateLagrangianInPlace(time, state, input, constraint, updatedMultiplier, penalty);
+  return {std::move(updatedMultiplier), penalty};
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void StateInputAugmentedLagrangian::updateLagrangianInPlace(scalar_t time, const vector_t& /*state*/, const vector_t& /*input*/,
+                                                            const vector_t& constraint, Multiplier& multiplier, scalar_t& penalty) const {
+  penalty_.updateMultipliersInPlace(time, constraint, multiplier.lagrangian);
+  penalty = multiplier.penalty * penalty_.getValue(time, constraint, &multiplier.lagrangian);
 }
 
 /******************************************************************************************************/
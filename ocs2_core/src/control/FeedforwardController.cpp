@@ -87,7 +87,7 @@ void FeedforwardController::setController(const scalar_array_t& controllerTime,
 /******************************************************************************************************/
 /******************************************************************************************************/
 vector_t FeedforwardController::computeInput(scalar_t t, const vector_t& x) {
-  return LinearInterpolation::interpolate(t, timeStamp_, uffArray_);
+  return LinearInterpolation::interpolate(t, timeStamp_, uffArray_, cursor_);
 }
 
 /******************************************************************************************************/
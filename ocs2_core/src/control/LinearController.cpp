@@ -77,7 +77,7 @@ void LinearController::setController(const scalar_array_t& controllerTime, const
 /******************************************************************************************************/
 /******************************************************************************************************/
 vector_t LinearController::computeInput(scalar_t t, const vector_t& x) {
-  const auto indexAlpha = LinearInterpolation::timeSegment(t, timeStamp_);
+  const auto indexAlpha = LinearInterpolation::timeSegment(t, timeStamp_, cursor_);
 
   vector_t uff = LinearInterpolation::interpolate(indexAlpha, biasArray_);
   const matrix_t k = LinearInterpolation::interpolate(indexAlpha, gainArray_);
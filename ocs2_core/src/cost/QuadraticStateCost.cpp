@@ -67,11 +67,23 @@ ScalarFunctionQuadraticApproximation QuadraticStateCost::getQuadraticApproximati
   return Phi;
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void QuadraticStateCost::accumulateQuadraticApproximation(scalar_t time, const vector_t& state,
+                                                          const TargetTrajectories& targetTrajectories, const PreComputation&,
+                                                          ScalarFunctionQuadraticApproximation& accumulator) const {
+  const vector_t xDeviation = getStateDeviation(time, state, targetTrajectories);
+  accumulator.f += 0.5 * xDeviation.dot(Q_ * xDeviation);
+  accumulator.dfdx.noalias() += Q_ * xDeviation;
+  accumulator.dfdxx += Q_;
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
 vector_t QuadraticStateCost::getStateDeviation(scalar_t time, const vector_t& state, const TargetTrajectories& targetTrajectories) const {
-  return state - targetTrajectories.getDesiredState(time);
+  return state - targetTrajectories.getDesiredState(time, targetCursor_);
 }
 
 }  // namespace ocs2
@@ -96,13 +96,36 @@ ScalarFunctionQuadraticApproximation QuadraticStateInputCost::getQuadraticApprox
   return L;
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void QuadraticStateInputCost::accumulateQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input,
+                                                               const TargetTrajectories& targetTrajectories, const PreComputation&,
+                                                               ScalarFunctionQuadraticApproximation& accumulator) const {
+  vector_t stateDeviation, inputDeviation;
+  std::tie(stateDeviation, inputDeviation) = getStateInputDeviation(time, state, input, targetTrajectories);
+
+  accumulator.f += 0.5 * stateDeviation.dot(Q_ * stateDeviation) + 0.5 * inputDeviation.dot(R_ * inputDeviation);
+  accumulator.dfdx.noalias() += Q_ * stateDeviation;
+  accumulator.dfdu.noalias() += R_ * inputDeviation;
+  accumulator.dfdxx += Q_;
+  accumulator.dfduu += R_;
+
+  if (P_.size() > 0) {
+    accumulator.f += inputDeviation.dot(P_ * stateDeviation);
+    accumulator.dfdu.noalias() += P_ * stateDeviation;
+    accumulator.dfdx.noalias() += P_.transpose() * inputDeviation;
+    accumulator.dfdux += P_;
+  }
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
 std::pair<vector_t, vector_t> QuadraticStateInputCost::getStateInputDeviation(scalar_t time, const vector_t& state, const vector_t& input,
                                                                               const TargetTrajectories& targetTrajectories) const {
-  const vector_t stateDeviation = state - targetTrajectories.getDesiredState(time);
-  const vector_t inputDeviation = input - targetTrajectories.getDesiredInput(time);
+  const vector_t stateDeviation = state - targetTrajectories.getDesiredState(time, targetCursor_);
+  const vector_t inputDeviation = input - targetTrajectories.getDesiredInput(time, targetCursor_);
   return {stateDeviation, inputDeviation};
 }
 
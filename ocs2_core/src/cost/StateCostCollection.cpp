@@ -93,4 +93,17 @@ ScalarFunctionQuadraticApproximation StateCostCollection::getQuadraticApproximat
   return cost;
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void StateCostCollection::accumulateQuadraticApproximation(scalar_t time, const vector_t& state,
+                                                           const TargetTrajectories& targetTrajectories, const PreComputation& preComp,
+                                                           ScalarFunctionQuadraticApproximation& accumulator) const {
+  for (const auto& costTerm : this->terms_) {
+    if (costTerm->isActive(time)) {
+      costTerm->accumulateQuadraticApproximation(time, state, targetTrajectories, preComp, accumulator);
+    }
+  }
+}
+
 }  // namespace ocs2
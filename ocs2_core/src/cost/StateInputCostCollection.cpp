@@ -86,4 +86,17 @@ ScalarFunctionQuadraticApproximation StateInputCostCollection::getQuadraticAppro
   return cost;
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void StateInputCostCollection::accumulateQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input,
+                                                                const TargetTrajectories& targetTrajectories, const PreComputation& preComp,
+                                                                ScalarFunctionQuadraticApproximation& accumulator) const {
+  for (const auto& costTerm : this->terms_) {
+    if (costTerm->isActive(time)) {
+      costTerm->accumulateQuadraticApproximation(time, state, input, targetTrajectories, preComp, accumulator);
+    }
+  }
+}
+
 }  // namespace ocs2
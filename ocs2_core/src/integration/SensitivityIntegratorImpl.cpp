@@ -29,8 +29,70 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ocs2_core/integration/SensitivityIntegratorImpl.h"
 
+#include <stdexcept>
+#include <string>
+
+#include <Eigen/LU>
+
 namespace ocs2 {
 
+namespace {
+constexpr int maxNumNewtonIterations = 10;
+constexpr scalar_t newtonTolerance = 1e-10;
+
+/**
+ * Solves the implicit step of the theta-method, x_{k+1} = x_{k} + dt * f(t + theta * dt, (1 - theta) * x_{k} + theta * x_{k+1}, u_{k}),
+ * with a simplified Newton method. theta = 1 results in the implicit euler and theta = 0.5 in the implicit midpoint discretization.
+ * The iteration matrix is factorized once at the first iterate, x_{k+1} = x_{k}, and the iterates only evaluate the flowmap.
+ *
+ * @return The converged state x_{k+1}.
+ * @throws std::runtime_error if the iterations do not converge.
+ */
+vector_t solveThetaMethod(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u, scalar_t dt, scalar_t theta) {
+  const scalar_t tStage = t + theta * dt;
+
+  // Jacobian of the residual w.r.t. x_{k+1}: I - theta * dt * dfdx
+  matrix_t jacobian = -theta * dt * system.linearApproximation(tStage, x, u).dfdx;
+  jacobian.diagonal().array() += 1.0;  // plus Identity()
+  const Eigen::PartialPivLU<matrix_t> jacobianLu(jacobian);
+
+  vector_t xNext = x;
+  for (int iter = 0; iter < maxNumNewtonIterations; iter++) {
+    const vector_t residual = xNext - x - dt * system.computeFlowMap(tStage, (1.0 - theta) * x + theta * xNext, u);
+    if (residual.lpNorm<Eigen::Infinity>() < newtonTolerance * (1.0 + xNext.lpNorm<Eigen::Infinity>())) {
+      return xNext;
+    }
+    xNext -= jacobianLu.solve(residual);
+  }
+
+  throw std::runtime_error("[solveThetaMethod] Newton iterations of the implicit discretization did not converge within " +
+                           std::to_string(maxNumNewtonIterations) + " iterations (t = " + std::to_string(t) +
+                           ", dt = " + std::to_string(dt) + ").");
+}
+
+/**
+ * Creates a linear approximation of the theta-method discretization. Differentiating the implicit equation at the converged step gives
+ *      (I - theta * dt * dfdx) * dx_{k+1} = (I + (1 - theta) * dt * dfdx) * dx_{k} + dt * dfdu * du_{k}
+ */
+VectorFunctionLinearApproximation thetaMethodSensitivityDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x,
+                                                                       const vector_t& u, scalar_t dt, scalar_t theta) {
+  vector_t xNext = solveThetaMethod(system, t, x, u, dt, theta);
+  VectorFunctionLinearApproximation stage = system.linearApproximation(t + theta * dt, (1.0 - theta) * x + theta * xNext, u);
+
+  matrix_t lhs = -theta * dt * stage.dfdx;
+  lhs.diagonal().array() += 1.0;  // plus Identity()
+  const Eigen::PartialPivLU<matrix_t> lhsLu(lhs);
+
+  // Re-use memory from stage to collect the result
+  stage.dfdx *= (1.0 - theta) * dt;
+  stage.dfdx.diagonal().array() += 1.0;  // plus Identity()
+  stage.dfdx = lhsLu.solve(stage.dfdx);
+  stage.dfdu = lhsLu.solve(dt * stage.dfdu);
+  stage.f = std::move(xNext);
+  return stage;
+}
+}  // unnamed namespace
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -168,4 +230,34 @@ VectorFunctionLinearApproximation rk4SensitivityDiscretization(SystemDynamicsBas
   return k1;
 }
 
-}  // namespace ocs2
\ No newline at end of file
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+vector_t implicitEulerDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u, scalar_t dt) {
+  return solveThetaMethod(system, t, x, u, dt, 1.0);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+VectorFunctionLinearApproximation implicitEulerSensitivityDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x,
+                                                                         const vector_t& u, scalar_t dt) {
+  return thetaMethodSensitivityDiscretization(system, t, x, u, dt, 1.0);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+vector_t implicitMidpointDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u, scalar_t dt) {
+  return solveThetaMethod(system, t, x, u, dt, 0.5);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+VectorFunctionLinearApproximation implicitMidpointSensitivityDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x,
+                                                                            const vector_t& u, scalar_t dt) {
+  return thetaMethodSensitivityDiscretization(system, t, x, u, dt, 0.5);
+}
+
+}  // namespace ocs2
@@ -63,6 +63,7 @@
 // Misc
 #include <ocs2_core/misc/Benchmark.h>
 #include <ocs2_core/misc/CommandLine.h>
+#include <ocs2_core/misc/ContiguousArray.h>
 // #include <ocs2_core/misc/LTI_Equations.h>
 // #include <ocs2_core/misc/LinearFunction.h>
 #include <ocs2_core/misc/LinearInterpolation.h>
@@ -71,8 +72,10 @@
 #include <ocs2_core/misc/randomMatrices.h>
 
 // thread_support
+#include <ocs2_core/thread_support/BufferedSnapshot.h>
 #include <ocs2_core/thread_support/BufferedValue.h>
 #include <ocs2_core/thread_support/SetThreadPriority.h>
+#include <ocs2_core/thread_support/SpinBarrier.h>
 #include <ocs2_core/thread_support/Synchronized.h>
 #include <ocs2_core/thread_support/ThreadPool.h>
 
@@ -34,7 +34,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace ocs2 {
 
 LoopshapingDefinition::LoopshapingDefinition(LoopshapingType loopshapingType, Filter filter, matrix_t costMatrix)
-    : loopshapingType_(loopshapingType), filter_(std::move(filter)), R_(std::move(costMatrix)) {
+    : loopshapingType_(loopshapingType), filter_(std::move(filter)) {
   if (filter_.getNumStates() == 0) {
     throw std::runtime_error(
         "[LoopshapingDefinition] The definition has zero extra states. This would be equivalent to a constant scaling. Using loopshaping "
@@ -44,8 +44,27 @@ LoopshapingDefinition::LoopshapingDefinition(LoopshapingType loopshapingType, Fi
   // Detect diagonal formulation if all involved matrices are diagonal
   diagonal_ = filter_.getA().isDiagonal() && filter_.getB().isDiagonal() && filter_.getC().isDiagonal() && filter_.getD().isDiagonal();
 
-  if (R_.size() == 0) {  // No cost provided
-    R_.setIdentity(filter_.getNumInputs(), filter_.getNumInputs());
+  if (costMatrix.size() == 0) {  // No cost provided
+    costMatrix.setIdentity(filter_.getNumInputs(), filter_.getNumInputs());
+  }
+  setCostMatrix(std::move(costMatrix));
+}
+
+void LoopshapingDefinition::setCostMatrix(matrix_t costMatrix) {
+  R_ = std::move(costMatrix);
+
+  // The Hessian blocks of the cost on the filtered input only depend on the filter for the output pattern
+  if (loopshapingType_ == LoopshapingType::outputpattern) {
+    if (diagonal_) {
+      CtRC_ = filter_.getScalingCdiagCdiag().cwiseProduct(R_);
+      DtRC_ = filter_.getScalingDdiagCdiag().cwiseProduct(R_);
+      DtRD_ = filter_.getScalingDdiagDdiag().cwiseProduct(R_);
+    } else {
+      const matrix_t RC = R_ * filter_.getC();
+      CtRC_.noalias() = filter_.getC().transpose() * RC;
+      DtRC_.noalias() = filter_.getD().transpose() * RC;
+      DtRD_.noalias() = filter_.getD().transpose() * R_ * filter_.getD();
+    }
   }
 }
 
@@ -146,7 +146,7 @@ VectorFunctionQuadraticApproximation LoopshapingConstraintEliminatePattern::getQ
       // dfdxx
       h.dfdxx[i].resize(stateDim, stateDim);
       h.dfdxx[i].topLeftCorner(sysStateDim, sysStateDim) = h_system.dfdxx[i];
-      h.dfdxx[i].bottomLeftCorner(filtStateDim, sysStateDim) = s_filter.getC().transpose() * h_system.dfdux[i];
+      h.dfdxx[i].bottomLeftCorner(filtStateDim, sysStateDim).noalias() = s_filter.getC().transpose() * h_system.dfdux[i];
       h.dfdxx[i].topRightCorner(sysStateDim, filtStateDim).noalias() = h.dfdxx[i].bottomLeftCorner(filtStateDim, sysStateDim).transpose();
       dfduu_C.noalias() = h_system.dfduu[i] * s_filter.getC();
       h.dfdxx[i].bottomRightCorner(filtStateDim, filtStateDim).noalias() = s_filter.getC().transpose() * dfduu_C;
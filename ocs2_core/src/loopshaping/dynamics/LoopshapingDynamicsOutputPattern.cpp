@@ -50,7 +50,7 @@ VectorFunctionLinearApproximation LoopshapingDynamicsOutputPattern::linearApprox
   const auto& u_system = preCompLS.getSystemInput();
   const auto& x_filter = preCompLS.getFilterState();
   const auto& u_filter = preCompLS.getFilteredInput();
-  const auto dynamics_system = systemDynamics_->linearApproximation(t, x_system, u_system);
+  const auto dynamics_system = systemDynamics_->linearApproximation(t, x_system, u_system, preCompLS.getSystemPreComputation());
 
   const auto stateDim = x.rows();
   const auto inputDim = u.rows();
@@ -49,6 +49,12 @@ class PenaltyBaseWrapper final : public augmented::AugmentedPenaltyBase {
   scalar_t getDerivative(scalar_t t, scalar_t l, scalar_t h) const override { return penaltyPtr_->getDerivative(t, h); }
   scalar_t getSecondDerivative(scalar_t t, scalar_t l, scalar_t h) const override { return penaltyPtr_->getSecondDerivative(t, h); }
 
+  scalar_t getBatchValue(scalar_t t, const vector_t* /*l*/, const vector_t& h) const override { return penaltyPtr_->getBatchValue(t, h); }
+  scalar_t getBatchValue1stDev2ndDev(scalar_t t, const vector_t* /*l*/, const vector_t& h, vector_t& derivative,
+                                     vector_t& secondDerivative) const override {
+    return penaltyPtr_->getBatchValue1stDev2ndDev(t, h, derivative, secondDerivative);
+  }
+
   scalar_t updateMultiplier(scalar_t t, scalar_t l, scalar_t h) const override {
     throw std::runtime_error("[" + name() + "] This penalty is only applicable to soft constraints!");
   }
@@ -125,9 +131,14 @@ scalar_t MultidimensionalPenalty::getValue(scalar_t t, const vector_t& h, const
   const auto numConstraints = h.rows();
   assert(penaltyPtrArray_.size() == 1 || penaltyPtrArray_.size() == numConstraints);
 
+  // the same penalty on all constraints is evaluated in a single call
+  if (penaltyPtrArray_.size() == 1) {
+    return penaltyPtrArray_[0]->getBatchValue(t, l, h);
+  }
+
   scalar_t penalty = 0;
   for (size_t i = 0; i < numConstraints; i++) {
-    const auto& penaltyTerm = (penaltyPtrArray_.size() == 1) ? penaltyPtrArray_[0] : penaltyPtrArray_[i];
+    const auto& penaltyTerm = penaltyPtrArray_[i];
     penalty += penaltyTerm->getValue(t, getMultiplier(l, i), h(i));
   }
 
@@ -212,8 +223,15 @@ std::tuple<scalar_t, vector_t, vector_t> MultidimensionalPenalty::getPenaltyValu
   scalar_t penaltyValue = 0.0;
   vector_t penaltyDerivative(numConstraints);
   vector_t penaltySecondDerivative(numConstraints);
+
+  // the same penalty on all constraints is evaluated in a single call
+  if (penaltyPtrArray_.size() == 1) {
+    penaltyValue = penaltyPtrArray_[0]->getBatchValue1stDev2ndDev(t, l, h, penaltyDerivative, penaltySecondDerivative);
+    return {penaltyValue, penaltyDerivative, penaltySecondDerivative};
+  }
+
   for (size_t i = 0; i < numConstraints; i++) {
-    const auto& penaltyTerm = (penaltyPtrArray_.size() == 1) ? penaltyPtrArray_[0] : penaltyPtrArray_[i];
+    const auto& penaltyTerm = penaltyPtrArray_[i];
     penaltyValue += penaltyTerm->getValue(t, getMultiplier(l, i), h(i));
     penaltyDerivative(i) = penaltyTerm->getDerivative(t, getMultiplier(l, i), h(i));
     penaltySecondDerivative(i) = penaltyTerm->getSecondDerivative(t, getMultiplier(l, i), h(i));
@@ -226,17 +244,23 @@ std::tuple<scalar_t, vector_t, vector_t> MultidimensionalPenalty::getPenaltyValu
 /******************************************************************************************************/
 /******************************************************************************************************/
 vector_t MultidimensionalPenalty::updateMultipliers(scalar_t t, const vector_t& h, const vector_t& l) const {
+  vector_t updted_l = l;
+  updateMultipliersInPlace(t, h, updted_l);
+  return updted_l;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MultidimensionalPenalty::updateMultipliersInPlace(scalar_t t, const vector_t& h, vector_t& l) const {
   const size_t numConstraints = h.size();
   assert(l.size() == numConstraints);
   assert(penaltyPtrArray_.size() == 1 || penaltyPtrArray_.size() == numConstraints);
 
-  vector_t updted_l(numConstraints);
   for (size_t i = 0; i < numConstraints; i++) {
     const auto& penaltyTerm = (penaltyPtrArray_.size() == 1) ? penaltyPtrArray_[0] : penaltyPtrArray_[i];
-    updted_l(i) = penaltyTerm->updateMultiplier(t, l(i), h(i));
+    l(i) = penaltyTerm->updateMultiplier(t, l(i), h(i));
   }
-
-  return updted_l;
 }
 
 /******************************************************************************************************/
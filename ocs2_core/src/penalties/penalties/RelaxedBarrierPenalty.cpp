@@ -65,4 +65,48 @@ scalar_t RelaxedBarrierPenalty::getSecondDerivative(scalar_t t, scalar_t h) cons
   };
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+scalar_t RelaxedBarrierPenalty::getBatchValue(scalar_t /*t*/, const vector_t& h) const {
+  // Both branches are evaluated for all elements and blended, such that the loop has no branches. The log-barrier branch is
+  // evaluated on the values clamped to delta to keep the discarded elements finite.
+  const scalar_t delta = config_.delta;
+  const auto isBarrier = (h.array() > delta).cast<scalar_t>();
+  const auto barrier = -h.array().max(delta).log();
+  const auto relaxed = 0.5 * ((h.array() - 2.0 * delta) / delta).square() - (0.5 + log(delta));
+  return config_.mu * (isBarrier * barrier + (1.0 - isBarrier) * relaxed).sum();
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+scalar_t RelaxedBarrierPenalty::getBatchValue1stDev2ndDev(scalar_t /*t*/, const vector_t& h, vector_t& derivative,
+                                                          vector_t& secondDerivative) const {
+  // The value and the derivatives are accumulated in a single pass over the constraints.
+  const scalar_t mu = config_.mu;
+  const scalar_t delta = config_.delta;
+  const scalar_t deltaInverse = 1.0 / delta;
+  const scalar_t relaxedOffset = 0.5 + log(delta);
+
+  const auto numConstraints = h.size();
+  derivative.resize(numConstraints);
+  secondDerivative.resize(numConstraints);
+  scalar_t value = 0.0;
+  for (int i = 0; i < numConstraints; i++) {
+    if (h(i) > delta) {
+      const scalar_t hInverse = 1.0 / h(i);
+      value -= log(h(i));
+      derivative(i) = -mu * hInverse;
+      secondDerivative(i) = mu * hInverse * hInverse;
+    } else {
+      const scalar_t relaxed = (h(i) - 2.0 * delta) * deltaInverse;
+      value += 0.5 * relaxed * relaxed - relaxedOffset;
+      derivative(i) = mu * relaxed * deltaInverse;
+      secondDerivative(i) = mu * deltaInverse * deltaInverse;
+    }
+  }
+  return mu * value;
+}
+
 }  // namespace ocs2
@@ -94,6 +94,30 @@ vector_t TargetTrajectories::getDesiredInput(scalar_t time) const {
   }
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/***************************************************************************************************** */
+vector_t TargetTrajectories::getDesiredState(scalar_t time, LinearInterpolation::Cursor& cursor) const {
+  if (this->empty()) {
+    throw std::runtime_error("[TargetTrajectories] TargetTrajectories is empty!");
+  } else {
+    return LinearInterpolation::interpolate(time, timeTrajectory, stateTrajectory, cursor);
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/***************************************************************************************************** */
+vector_t TargetTrajectories::getDesiredInput(scalar_t time, LinearInterpolation::Cursor& cursor) const {
+  if (this->empty()) {
+    throw std::runtime_error("[TargetTrajectories] TargetTrajectories is empty!");
+  } else if (inputTrajectory.empty()) {
+    throw std::runtime_error("[TargetTrajectories] TargetTrajectories does not have inputTrajectory!");
+  } else {
+    return LinearInterpolation::interpolate(time, timeTrajectory, inputTrajectory, cursor);
+  }
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /***************************************************************************************************** */
@@ -0,0 +1,109 @@
+/******************************************************************************
+Copyright (c) 2017, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <ocs2_core/augmented_lagrangian/AugmentedLagrangian.h>
+#include <ocs2_core/augmented_lagrangian/StateInputAugmentedLagrangianCollection.h>
+#include <ocs2_core/constraint/LinearStateInputConstraint.h>
+#include <ocs2_core/penalties/Penalties.h>
+
+using namespace ocs2;
+
+namespace {
+
+/** Box constraints of the form umin <= u <= umax, written as D u + e >= 0 */
+std::unique_ptr<StateInputConstraint> getInputBoxConstraint(size_t stateDim, size_t inputDim, scalar_t bound) {
+  const vector_t e = vector_t::Constant(2 * inputDim, bound);
+  const matrix_t C = matrix_t::Zero(2 * inputDim, stateDim);
+  matrix_t D(2 * inputDim, inputDim);
+  D << matrix_t::Identity(inputDim, inputDim), -matrix_t::Identity(inputDim, inputDim);
+  return std::make_unique<LinearStateInputConstraint>(e, C, D);
+}
+
+}  // unnamed namespace
+
+TEST(testAugmentedLagrangianCollection, updateLagrangianInPlace) {
+  constexpr size_t stateDim = 3;
+  constexpr size_t inputDim = 4;
+  constexpr size_t numTerms = 3;
+  constexpr scalar_t t = 0.0;
+
+  const augmented::SlacknessSquaredHingePenalty::Config penaltyConfig(10.0, 1.0);
+  StateInputAugmentedLagrangianCollection collection;
+  for (size_t i = 0; i < numTerms; i++) {
+    collection.add("box" + std::to_string(i), create(getInputBoxConstraint(stateDim, inputDim, 0.1 * (i + 1)),
+                                                     augmented::SlacknessSquaredHingePenalty::create(penaltyConfig)));
+  }
+
+  const vector_t x = vector_t::Random(stateDim);
+  const vector_t u = vector_t::Random(inputDim);
+  std::vector<Multiplier> termsMultiplier;
+  collection.initializeLagrangian(t, termsMultiplier);
+  for (auto& multiplier : termsMultiplier) {
+    multiplier.lagrangian.setRandom();
+  }
+  auto termsMetrics = collection.getValue(t, x, u, termsMultiplier, PreComputation());
+
+  // reference: the element-wise multiplier update on the box constraint values u + b >= 0 and -u + b >= 0
+  const augmented::SlacknessSquaredHingePenalty penalty(penaltyConfig);
+  std::vector<Multiplier> expectedMultiplier;
+  std::vector<scalar_t> expectedPenalty;
+  for (size_t i = 0; i < numTerms; i++) {
+    const scalar_t bound = 0.1 * (i + 1);
+    vector_t h(2 * inputDim);
+    h << u.array() + bound, -u.array() + bound;
+
+    Multiplier multiplier = termsMultiplier[i];
+    scalar_t penaltyValue = 0.0;
+    for (int j = 0; j < h.size(); j++) {
+      multiplier.lagrangian(j) = penalty.updateMultiplier(t, termsMultiplier[i].lagrangian(j), h(j));
+      penaltyValue += penalty.getValue(t, multiplier.lagrangian(j), h(j));
+    }
+    expectedMultiplier.push_back(std::move(multiplier));
+    expectedPenalty.push_back(termsMultiplier[i].penalty * penaltyValue);
+  }
+
+  std::vector<const scalar_t*> multiplierData;
+  for (const auto& multiplier : termsMultiplier) {
+    multiplierData.push_back(multiplier.lagrangian.data());
+  }
+
+  collection.updateLagrangian(t, x, u, termsMetrics, termsMultiplier);
+
+  for (size_t i = 0; i < numTerms; i++) {
+    // the multipliers are updated in their existing storage
+    EXPECT_EQ(termsMultiplier[i].lagrangian.data(), multiplierData[i]);
+    EXPECT_DOUBLE_EQ(termsMultiplier[i].penalty, expectedMultiplier[i].penalty);
+    EXPECT_TRUE(termsMultiplier[i].lagrangian.isApprox(expectedMultiplier[i].lagrangian));
+    EXPECT_NEAR(termsMetrics[i].penalty, expectedPenalty[i], 1e-12);
+  }
+}
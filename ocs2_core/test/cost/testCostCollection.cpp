@@ -117,6 +117,17 @@ TEST_F(StateInputCost_TestFixture, getStateInputCostApproximation) {
   EXPECT_TRUE((cost.dfdux.array() == 0.0).all());
 }
 
+TEST_F(StateInputCost_TestFixture, accumulateStateInputCostApproximation) {
+  auto cost = ocs2::ScalarFunctionQuadraticApproximation::Zero(STATE_DIM, INPUT_DIM);
+  costCollection.accumulateQuadraticApproximation(t, x, u, targetTrajectories, {}, cost);
+  EXPECT_NEAR(cost.f, expectedCost, 1e-6);
+  EXPECT_TRUE(cost.dfdx.isApprox(expectedCostApproximation.dfdx));
+  EXPECT_TRUE(cost.dfdu.isApprox(expectedCostApproximation.dfdu));
+  EXPECT_TRUE(cost.dfdxx.isApprox(expectedCostApproximation.dfdxx));
+  EXPECT_TRUE(cost.dfduu.isApprox(expectedCostApproximation.dfduu));
+  EXPECT_TRUE((cost.dfdux.array() == 0.0).all());
+}
+
 TEST_F(StateInputCost_TestFixture, canGetCostFunction) {
   const auto& costFunction = costCollection.get("Simple quadratic cost");
 }
@@ -214,6 +225,15 @@ TEST_F(StateCost_TestFixture, testStateCost) {
   EXPECT_NEAR(cost, expectedCost, 1e-6);
 }
 
+TEST_F(StateCost_TestFixture, testStateCostAccumulateApproximation) {
+  auto cost = ocs2::ScalarFunctionQuadraticApproximation::Zero(STATE_DIM, INPUT_DIM);
+  costCollection.accumulateQuadraticApproximation(t, x, targetTrajectories, {}, cost);
+  EXPECT_NEAR(cost.f, expectedCost, 1e-6);
+  EXPECT_TRUE(cost.dfdx.isApprox(expectedCostApproximation.dfdx));
+  EXPECT_TRUE(cost.dfdxx.isApprox(expectedCostApproximation.dfdxx));
+  EXPECT_TRUE(cost.dfdu.isZero());
+}
+
 TEST_F(StateCost_TestFixture, testStateCostApproximation) {
   const auto cost = costCollection.getQuadraticApproximation(t, x, targetTrajectories, {});
   EXPECT_NEAR(cost.f, expectedCost, 1e-6);
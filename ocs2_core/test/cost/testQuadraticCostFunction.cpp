@@ -67,6 +67,24 @@ TEST_F(testQuadraticCost, StateInputCostApproximation) {
   EXPECT_TRUE(L.dfduu.isApprox(R_, PRECISION));
 }
 
+TEST_F(testQuadraticCost, StateInputCostAccumulateApproximation) {
+  QuadraticStateInputCost costFunction(Q_, R_, P_);
+
+  // accumulating twice is equal to twice the approximation
+  auto L = ScalarFunctionQuadraticApproximation::Zero(x_.size(), u_.size());
+  costFunction.accumulateQuadraticApproximation(t_, x_, u_, targetTrajectories_, preComputation_, L);
+  costFunction.accumulateQuadraticApproximation(t_, x_, u_, targetTrajectories_, preComputation_, L);
+
+  auto expected = costFunction.getQuadraticApproximation(t_, x_, u_, targetTrajectories_, preComputation_);
+  expected *= 2.0;
+  EXPECT_NEAR(L.f, expected.f, PRECISION);
+  EXPECT_TRUE(L.dfdx.isApprox(expected.dfdx, PRECISION));
+  EXPECT_TRUE(L.dfdu.isApprox(expected.dfdu, PRECISION));
+  EXPECT_TRUE(L.dfdxx.isApprox(expected.dfdxx, PRECISION));
+  EXPECT_TRUE(L.dfdux.isApprox(expected.dfdux, PRECISION));
+  EXPECT_TRUE(L.dfduu.isApprox(expected.dfduu, PRECISION));
+}
+
 TEST_F(testQuadraticCost, StateInputCostClone) {
   QuadraticStateInputCost costFunction(Q_, R_, P_);
   auto costFunctionClone = std::unique_ptr<StateInputCost>(costFunction.clone());
@@ -94,6 +112,21 @@ TEST_F(testQuadraticCost, StateCostApproximation) {
   EXPECT_TRUE(Phi.dfdxx.isApprox(Qf_, PRECISION));
 }
 
+TEST_F(testQuadraticCost, StateCostAccumulateApproximation) {
+  QuadraticStateCost costFunction(Qf_);
+
+  auto Phi = ScalarFunctionQuadraticApproximation::Zero(x_.size(), u_.size());
+  costFunction.accumulateQuadraticApproximation(t_, x_, targetTrajectories_, preComputation_, Phi);
+
+  const auto expected = costFunction.getQuadraticApproximation(t_, x_, targetTrajectories_, preComputation_);
+  EXPECT_NEAR(Phi.f, expected.f, PRECISION);
+  EXPECT_TRUE(Phi.dfdx.isApprox(expected.dfdx, PRECISION));
+  EXPECT_TRUE(Phi.dfdxx.isApprox(expected.dfdxx, PRECISION));
+  // the input derivatives are not touched
+  EXPECT_TRUE(Phi.dfdu.isZero());
+  EXPECT_TRUE(Phi.dfduu.isZero());
+}
+
 TEST_F(testQuadraticCost, StateCostClone) {
   QuadraticStateCost costFunction(Qf_);
   auto costFunctionClone = std::unique_ptr<StateCost>(costFunction.clone());
@@ -210,3 +210,140 @@ TEST(test_sensitivity_integrator, vsBoostRK4) {
   // Check
   ASSERT_TRUE(rk4ForwardDynamics.isApprox(boostRk4ForwardDynamics));
 }
+
+namespace {
+/** A nonlinear system with a stiff, fast pole: dx0 = x1, dx1 = -sin(x0) + u, dx2 = -stiffness * (x2 - x0) */
+class StiffNonlinearSystem final : public ocs2::SystemDynamicsBase {
+ public:
+  explicit StiffNonlinearSystem(ocs2::scalar_t stiffness) : stiffness_(stiffness) {}
+  ~StiffNonlinearSystem() override = default;
+  StiffNonlinearSystem* clone() const override { return new StiffNonlinearSystem(*this); }
+
+  using ocs2::SystemDynamicsBase::computeFlowMap;
+  using ocs2::SystemDynamicsBase::linearApproximation;
+
+  ocs2::vector_t computeFlowMap(ocs2::scalar_t, const ocs2::vector_t& x, const ocs2::vector_t& u,
+                                const ocs2::PreComputation&) override {
+    ocs2::vector_t dxdt(3);
+    dxdt << x(1), -std::sin(x(0)) + u(0), -stiffness_ * (x(2) - x(0));
+    return dxdt;
+  }
+
+  ocs2::VectorFunctionLinearApproximation linearApproximation(ocs2::scalar_t t, const ocs2::vector_t& x, const ocs2::vector_t& u,
+                                                              const ocs2::PreComputation& preComp) override {
+    ocs2::VectorFunctionLinearApproximation approximation;
+    approximation.f = computeFlowMap(t, x, u, preComp);
+    approximation.dfdx.setZero(3, 3);
+    approximation.dfdx(0, 1) = 1.0;
+    approximation.dfdx(1, 0) = -std::cos(x(0));
+    approximation.dfdx(2, 0) = stiffness_;
+    approximation.dfdx(2, 2) = -stiffness_;
+    approximation.dfdu.setZero(3, 1);
+    approximation.dfdu(1, 0) = 1.0;
+    return approximation;
+  }
+
+ private:
+  ocs2::scalar_t stiffness_;
+};
+}  // namespace
+
+TEST(test_sensitivity_integrator, implicitMidpointLinearSystem) {
+  auto type = ocs2::SensitivityIntegratorType::IMPLICIT_MIDPOINT;
+  auto sensitivityDiscretization = ocs2::selectDynamicsSensitivityDiscretization(type);
+  auto discretization = ocs2::selectDynamicsDiscretization(type);
+
+  auto system = getSystem();
+  ocs2::scalar_t t = 0.5;
+  ocs2::vector_t x = ocs2::vector_t::Random(2);
+  ocs2::vector_t u = ocs2::vector_t::Random(1);
+  ocs2::scalar_t dt = 0.1;
+
+  // For a linear system the implicit midpoint rule is the Tustin (bilinear) transformation
+  const ocs2::PreComputation preComp;
+  const auto continuous = system->linearApproximation(t, x, u, preComp);
+  const ocs2::matrix_t I = ocs2::matrix_t::Identity(2, 2);
+  const ocs2::matrix_t lhsInv = (I - 0.5 * dt * continuous.dfdx).inverse();
+  const ocs2::matrix_t Ad = lhsInv * (I + 0.5 * dt * continuous.dfdx);
+  const ocs2::matrix_t Bd = lhsInv * dt * continuous.dfdu;
+  const ocs2::vector_t xNext = Ad * x + Bd * u;
+
+  const auto forwardDynamics = discretization(*system, t, x, u, dt);
+  ASSERT_TRUE(forwardDynamics.isApprox(xNext));
+  const auto linearizedDynamics = sensitivityDiscretization(*system, t, x, u, dt);
+  ASSERT_TRUE(linearizedDynamics.f.isApprox(xNext));
+  ASSERT_TRUE(linearizedDynamics.dfdx.isApprox(Ad));
+  ASSERT_TRUE(linearizedDynamics.dfdu.isApprox(Bd));
+}
+
+TEST(test_sensitivity_integrator, implicitSensitivityFiniteDifference) {
+  StiffNonlinearSystem system(1e3);
+  ocs2::scalar_t t = 0.5;
+  ocs2::vector_t x = ocs2::vector_t::Random(3);
+  ocs2::vector_t u = ocs2::vector_t::Random(1);
+  ocs2::scalar_t dt = 0.05;
+  const ocs2::scalar_t eps = 1e-6;
+
+  for (auto type : {ocs2::SensitivityIntegratorType::IMPLICIT_EULER, ocs2::SensitivityIntegratorType::IMPLICIT_MIDPOINT}) {
+    auto sensitivityDiscretization = ocs2::selectDynamicsSensitivityDiscretization(type);
+    auto discretization = ocs2::selectDynamicsDiscretization(type);
+
+    const auto linearizedDynamics = sensitivityDiscretization(system, t, x, u, dt);
+    const ocs2::vector_t xNext = discretization(system, t, x, u, dt);
+    ASSERT_TRUE(linearizedDynamics.f.isApprox(xNext));
+
+    // Residual of the implicit step
+    const ocs2::scalar_t theta = (type == ocs2::SensitivityIntegratorType::IMPLICIT_EULER) ? 1.0 : 0.5;
+    const ocs2::vector_t xStage = (1.0 - theta) * x + theta * xNext;
+    const ocs2::vector_t residual = xNext - x - dt * system.computeFlowMap(t + theta * dt, xStage, u);
+    ASSERT_LT(residual.norm(), 1e-8);
+
+    // Sensitivities against central finite differences
+    ocs2::matrix_t dfdxFd(3, 3);
+    for (int i = 0; i < 3; i++) {
+      const ocs2::vector_t dx = eps * ocs2::vector_t::Unit(3, i);
+      dfdxFd.col(i) = (discretization(system, t, x + dx, u, dt) - discretization(system, t, x - dx, u, dt)) / (2.0 * eps);
+    }
+    const ocs2::vector_t du = eps * ocs2::vector_t::Ones(1);
+    const ocs2::matrix_t dfduFd = (discretization(system, t, x, u + du, dt) - discretization(system, t, x, u - du, dt)) / (2.0 * eps);
+
+    EXPECT_TRUE(linearizedDynamics.dfdx.isApprox(dfdxFd, 1e-5)) << ocs2::sensitivity_integrator::toString(type);
+    EXPECT_TRUE(linearizedDynamics.dfdu.isApprox(dfduFd, 1e-5)) << ocs2::sensitivity_integrator::toString(type);
+  }
+}
+
+TEST(test_sensitivity_integrator, implicitStiffStability) {
+  // The fast pole at -1e3 with dt = 0.05 is far outside the stability region of the explicit schemes
+  StiffNonlinearSystem system(1e3);
+  const ocs2::scalar_t dt = 0.05;
+  const ocs2::vector_t u = ocs2::vector_t::Zero(1);
+  const ocs2::vector_t x0 = (ocs2::vector_t(3) << 0.5, 0.0, 1.0).finished();
+
+  auto simulate = [&](ocs2::SensitivityIntegratorType type) {
+    auto discretization = ocs2::selectDynamicsDiscretization(type);
+    ocs2::vector_t x = x0;
+    for (int k = 0; k < 40; k++) {
+      x = discretization(system, k * dt, x, u, dt);
+    }
+    return x;
+  };
+
+  EXPECT_GT(simulate(ocs2::SensitivityIntegratorType::RK4).norm(), 1e6);
+  EXPECT_LT(simulate(ocs2::SensitivityIntegratorType::IMPLICIT_EULER).norm(), 2.0);
+  EXPECT_LT(simulate(ocs2::SensitivityIntegratorType::IMPLICIT_MIDPOINT).norm(), 2.0);
+}
+
+TEST(test_sensitivity_integrator, implicitNonConvergence) {
+  // A step far beyond the time scale of the nonlinearity, where the simplified Newton iterations diverge
+  StiffNonlinearSystem system(1e3);
+  const ocs2::vector_t x = (ocs2::vector_t(3) << 1.0, 0.0, 0.0).finished();
+  const ocs2::vector_t u = ocs2::vector_t::Zero(1);
+  const ocs2::scalar_t dt = 5.0;
+
+  for (auto type : {ocs2::SensitivityIntegratorType::IMPLICIT_EULER, ocs2::SensitivityIntegratorType::IMPLICIT_MIDPOINT}) {
+    EXPECT_THROW(ocs2::selectDynamicsDiscretization(type)(system, 0.0, x, u, dt), std::runtime_error)
+        << ocs2::sensitivity_integrator::toString(type);
+    EXPECT_THROW(ocs2::selectDynamicsSensitivityDiscretization(type)(system, 0.0, x, u, dt), std::runtime_error)
+        << ocs2::sensitivity_integrator::toString(type);
+  }
+}
@@ -76,3 +76,30 @@ TEST(testLoopshapingDefinition, stateInputAccessFunctions) {
     loopshapingDefinition->getFilterEquilibrium(systemInput, equilibriumState, equilibriumInput);
   }
 }
+
+TEST(testLoopshapingDefinition, costHessianBlocks) {
+  for (const auto config : configNames) {
+    const auto configPath = getAbsolutePathToConfigurationFile(config);
+    auto loopshapingDefinition = loopshaping_property_tree::load(configPath);
+    if (loopshapingDefinition->getType() != LoopshapingType::outputpattern) {
+      continue;
+    }
+
+    const auto& filter = loopshapingDefinition->getInputFilter();
+    const size_t inputDim = filter.getNumInputs();
+    matrix_t R = matrix_t::Random(inputDim, inputDim);
+    R = (R * R.transpose()).eval();
+    loopshapingDefinition->setCostMatrix(R);
+
+    // Quadratic cost on the filtered input C * filterState + D * input
+    const vector_t filterState = vector_t::Random(filter.getNumStates());
+    const vector_t input = vector_t::Random(inputDim);
+    const vector_t filteredInput = filter.getC() * filterState + filter.getD() * input;
+    const scalar_t expectedCost = 0.5 * filteredInput.dot(R * filteredInput);
+    const scalar_t cost = 0.5 * filterState.dot(loopshapingDefinition->costHessianFilterState() * filterState) +
+                          input.dot(loopshapingDefinition->costHessianInputFilterState() * filterState) +
+                          0.5 * input.dot(loopshapingDefinition->costHessianInput() * input);
+    EXPECT_NEAR(cost, expectedCost, 1e-9);
+    EXPECT_NEAR(loopshapingDefinition->loopshapingCost(filteredInput), expectedCost, 1e-9);
+  }
+}
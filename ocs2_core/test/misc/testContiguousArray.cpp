@@ -0,0 +1,117 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <ocs2_core/misc/ContiguousArray.h>
+#include <ocs2_core/misc/LinearInterpolation.h>
+
+using namespace ocs2;
+
+TEST(testContiguousArray, conversion) {
+  vector_array_t array;
+  for (int i = 0; i < 10; i++) {
+    array.push_back(vector_t::Random(3 + i % 2));
+  }
+
+  const contiguous_vector_array_t contiguousArray(array);
+  ASSERT_EQ(contiguousArray.size(), array.size());
+  EXPECT_FALSE(contiguousArray.isUniform());
+  for (size_t i = 0; i < array.size(); i++) {
+    EXPECT_TRUE(contiguousArray[i].isApprox(array[i]));
+  }
+  EXPECT_TRUE(contiguousArray.toArray() == array);
+  EXPECT_ANY_THROW(contiguousArray.asMatrix());
+}
+
+TEST(testContiguousArray, matrixNodes) {
+  contiguous_matrix_array_t contiguousArray;
+  matrix_array_t array;
+  for (int i = 0; i < 5; i++) {
+    array.push_back(matrix_t::Random(2, 3));
+    contiguousArray.push_back(array.back());
+  }
+  ASSERT_TRUE(contiguousArray.isUniform());
+
+  // one column per node
+  const auto asMatrix = contiguousArray.asMatrix();
+  ASSERT_EQ(asMatrix.rows(), 6);
+  ASSERT_EQ(asMatrix.cols(), 5);
+  for (size_t i = 0; i < array.size(); i++) {
+    EXPECT_TRUE(asMatrix.col(i).isApprox(Eigen::Map<const vector_t>(array[i].data(), array[i].size())));
+  }
+
+  // writing through the view
+  contiguousArray[2].setZero();
+  EXPECT_TRUE(contiguousArray[2].isZero());
+  EXPECT_TRUE(contiguousArray[3].isApprox(array[3]));
+}
+
+TEST(testContiguousArray, truncate) {
+  contiguous_vector_array_t contiguousArray;
+  for (int i = 0; i < 5; i++) {
+    contiguousArray.emplace_back(4).setConstant(i);
+  }
+  contiguousArray.truncate(2);
+  ASSERT_EQ(contiguousArray.size(), 2);
+  EXPECT_EQ(contiguousArray.coefficients().size(), 8);
+  EXPECT_TRUE(contiguousArray.back().isApprox(vector_t::Constant(4, 1.0)));
+  EXPECT_ANY_THROW(contiguousArray.truncate(3));
+
+  contiguousArray.push_back(vector_t::Constant(4, 5.0));
+  EXPECT_TRUE(contiguousArray.back().isApprox(vector_t::Constant(4, 5.0)));
+}
+
+TEST(testContiguousArray, pushBackOwnNode) {
+  contiguous_matrix_array_t contiguousArray;
+  contiguousArray.push_back(matrix_t::Constant(3, 2, 1.0));
+  // each push_back of an own node outgrows the capacity at some point, which reallocates the buffer the node points to
+  for (int i = 0; i < 20; i++) {
+    contiguousArray.push_back(contiguousArray[i]);
+    contiguousArray.back().array() += 1.0;
+  }
+  ASSERT_EQ(contiguousArray.size(), 21);
+  for (size_t i = 0; i < contiguousArray.size(); i++) {
+    EXPECT_TRUE(contiguousArray[i].isApprox(matrix_t::Constant(3, 2, i + 1.0))) << "node " << i;
+  }
+}
+
+TEST(testContiguousArray, interpolation) {
+  const scalar_array_t timeArray{0.0, 1.0, 2.0, 2.0, 3.0};
+  vector_array_t array;
+  for (const auto t : timeArray) {
+    array.push_back(vector_t::Constant(2, t * t));
+  }
+  const contiguous_vector_array_t contiguousArray(array);
+
+  for (const auto t : {-1.0, 0.0, 0.3, 1.0, 1.7, 2.0, 2.5, 3.0, 4.0}) {
+    const vector_t expected = LinearInterpolation::interpolate(t, timeArray, array);
+    EXPECT_TRUE(LinearInterpolation::interpolate(t, timeArray, contiguousArray).isApprox(expected)) << "time: " << t;
+  }
+}
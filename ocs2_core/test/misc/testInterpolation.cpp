@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <cstdlib>
 #include <iostream>
 
 #include <ocs2_core/misc/LinearInterpolation.h>
@@ -132,3 +134,44 @@ TEST(testLinearInterpolation, testDifferentEigenSizes) {
   result = ocs2::LinearInterpolation::interpolate(1.1, times, data);
   EXPECT_TRUE(result.isApprox(data[1]));
 }
+
+TEST(testLinearInterpolation, testCursor) {
+  std::vector<double> times;
+  std::vector<double> data;
+  for (int k = 0; k < 50; k++) {
+    times.push_back(0.1 * k);
+    data.push_back(std::sin(0.1 * k));
+    if (k % 10 == 5) {  // event time
+      times.push_back(0.1 * k);
+      data.push_back(std::cos(0.1 * k));
+    }
+  }
+
+  // increasing times as in a rollout, decreasing times as in a Riccati backward pass, and random times
+  std::vector<double> enquiryTimes;
+  for (int i = -10; i < 600; i++) {
+    enquiryTimes.push_back(0.01 * i);
+  }
+  for (int i = 600; i > -10; i--) {
+    enquiryTimes.push_back(0.01 * i - 0.003);
+  }
+  std::srand(0);
+  for (int i = 0; i < 100; i++) {
+    enquiryTimes.push_back(6.0 * std::rand() / RAND_MAX - 0.5);
+  }
+
+  ocs2::LinearInterpolation::Cursor cursor;
+  for (const auto time : enquiryTimes) {
+    const auto indexAlpha = ocs2::LinearInterpolation::timeSegment(time, times);
+    const auto cursorIndexAlpha = ocs2::LinearInterpolation::timeSegment(time, times, cursor);
+    ASSERT_EQ(cursorIndexAlpha.first, indexAlpha.first) << "time: " << time;
+    ASSERT_EQ(cursorIndexAlpha.second, indexAlpha.second) << "time: " << time;
+    ASSERT_EQ(ocs2::LinearInterpolation::interpolate(time, times, data, cursor), ocs2::LinearInterpolation::interpolate(time, times, data));
+  }
+
+  // the cursor can be used on another time array
+  const std::vector<double> shortTimes{1.0, 2.0};
+  const auto indexAlpha = ocs2::LinearInterpolation::timeSegment(1.5, shortTimes, cursor);
+  ASSERT_EQ(indexAlpha.first, 0);
+  ASSERT_DOUBLE_EQ(indexAlpha.second, 0.5);
+}
@@ -36,6 +36,25 @@ TEST(testLookup, findIndexInTimeArray) {
   ASSERT_EQ(findIndexInTimeArray(timeArrayEmpty, 1.0), 0);
 }
 
+TEST(testLookup, findIndexInTimeArray_hint) {
+  const std::vector<double> timeArray{-1.0, 0.0, 0.5, 2.0, 2.0, 2.0, 3.0, 4.0, 4.5, 5.0, 7.0};
+  const std::vector<double> enquiryTimes{-2.0, -1.0, -0.5, 0.0, 1.0, 2.0, 2.5, 3.0, 4.9, 5.0, 6.0, 7.0, 8.0};
+  const int size = timeArray.size();
+
+  // the result does not depend on the hint, including hints out of range
+  for (const auto time : enquiryTimes) {
+    for (int hint = -2; hint <= size + 2; hint++) {
+      ASSERT_EQ(findIndexInTimeArray(timeArray, time, hint), findIndexInTimeArray(timeArray, time))
+          << "time: " << time << " hint: " << hint;
+    }
+  }
+
+  // empty time
+  std::vector<double> timeArrayEmpty;
+  ASSERT_EQ(findIndexInTimeArray(timeArrayEmpty, 1.0, 0), 0);
+  ASSERT_EQ(findIndexInTimeArray(timeArrayEmpty, 1.0, 3), 0);
+}
+
 TEST(testLookup, findIndexInTimeArray_precision_lowNumbers) {
   std::vector<double> timeArray{0.0};
   double tQuery = timeArray.front();
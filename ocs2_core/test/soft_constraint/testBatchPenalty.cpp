@@ -0,0 +1,126 @@
+/******************************************************************************
+Copyright (c) 2017, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <ocs2_core/penalties/MultidimensionalPenalty.h>
+#include <ocs2_core/penalties/Penalties.h>
+
+using namespace ocs2;
+
+namespace {
+
+/** Constraint values on both sides of the relaxation parameter, including the boundary itself */
+vector_t getConstraintValues(scalar_t delta) {
+  vector_t h = vector_t::Random(64);
+  h.head<4>() << delta, -delta, 2.0 * delta, 0.0;
+  return h;
+}
+
+void checkBatchAgainstScalar(const PenaltyBase& penalty, const vector_t& h) {
+  constexpr scalar_t eps = 1e-9;
+  constexpr scalar_t t = 0.0;
+
+  scalar_t value = 0.0;
+  vector_t derivative(h.size()), secondDerivative(h.size());
+  for (size_t i = 0; i < h.size(); i++) {
+    value += penalty.getValue(t, h(i));
+    derivative(i) = penalty.getDerivative(t, h(i));
+    secondDerivative(i) = penalty.getSecondDerivative(t, h(i));
+  }
+
+  vector_t batchDerivative, batchSecondDerivative;
+  EXPECT_NEAR(penalty.getBatchValue(t, h), value, eps);
+  EXPECT_NEAR(penalty.getBatchValue1stDev2ndDev(t, h, batchDerivative, batchSecondDerivative), value, eps);
+  EXPECT_TRUE(batchDerivative.isApprox(derivative, eps));
+  EXPECT_TRUE(batchSecondDerivative.isApprox(secondDerivative, eps));
+}
+
+}  // unnamed namespace
+
+TEST(testBatchPenalty, relaxedBarrier) {
+  const RelaxedBarrierPenalty::Config config(0.1, 5.0e-2);
+  checkBatchAgainstScalar(RelaxedBarrierPenalty(config), getConstraintValues(config.delta));
+}
+
+TEST(testBatchPenalty, squaredHinge) {
+  const SquaredHingePenalty::Config config(100.0, 1.0e-1);
+  checkBatchAgainstScalar(SquaredHingePenalty(config), getConstraintValues(config.delta));
+}
+
+TEST(testBatchPenalty, defaultImplementation) {
+  checkBatchAgainstScalar(DoubleSidedPenalty(-0.5, 0.5, std::make_unique<SquaredHingePenalty>(SquaredHingePenalty::Config())),
+                          getConstraintValues(0.5));
+}
+
+TEST(testBatchPenalty, multidimensionalPenalty) {
+  constexpr scalar_t t = 0.0;
+  const RelaxedBarrierPenalty::Config config(0.1, 5.0e-2);
+  const vector_t h = getConstraintValues(config.delta);
+
+  // the same penalty on all constraints, evaluated as a batch
+  MultidimensionalPenalty batchPenalty(std::unique_ptr<PenaltyBase>(new RelaxedBarrierPenalty(config)));
+
+  // one penalty per constraint, evaluated per element
+  std::vector<std::unique_ptr<PenaltyBase>> penaltyPtrArray;
+  for (size_t i = 0; i < h.size(); i++) {
+    penaltyPtrArray.emplace_back(new RelaxedBarrierPenalty(config));
+  }
+  MultidimensionalPenalty elementwisePenalty(std::move(penaltyPtrArray));
+
+  VectorFunctionLinearApproximation hApprox(h.size(), 3, 2);
+  hApprox.f = h;
+  hApprox.dfdx.setRandom();
+  hApprox.dfdu.setRandom();
+
+  EXPECT_NEAR(batchPenalty.getValue(t, h), elementwisePenalty.getValue(t, h), 1e-9);
+  const auto batchApprox = batchPenalty.getQuadraticApproximation(t, hApprox);
+  const auto elementwiseApprox = elementwisePenalty.getQuadraticApproximation(t, hApprox);
+  EXPECT_NEAR(batchApprox.f, elementwiseApprox.f, 1e-9);
+  EXPECT_TRUE(batchApprox.dfdx.isApprox(elementwiseApprox.dfdx, 1e-9));
+  EXPECT_TRUE(batchApprox.dfdu.isApprox(elementwiseApprox.dfdu, 1e-9));
+  EXPECT_TRUE(batchApprox.dfdxx.isApprox(elementwiseApprox.dfdxx, 1e-9));
+  EXPECT_TRUE(batchApprox.dfdux.isApprox(elementwiseApprox.dfdux, 1e-9));
+  EXPECT_TRUE(batchApprox.dfduu.isApprox(elementwiseApprox.dfduu, 1e-9));
+}
+
+TEST(testBatchPenalty, augmentedPenalty) {
+  constexpr scalar_t t = 0.0;
+  const vector_t h = getConstraintValues(0.0);
+  const vector_t l = vector_t::Random(h.size()).cwiseAbs() + vector_t::Constant(h.size(), 0.1);
+
+  const augmented::SlacknessSquaredHingePenalty penalty(augmented::SlacknessSquaredHingePenalty::Config(10.0, 1.0));
+  MultidimensionalPenalty batchPenalty(std::unique_ptr<augmented::AugmentedPenaltyBase>(penalty.clone()));
+
+  scalar_t value = 0.0;
+  for (size_t i = 0; i < h.size(); i++) {
+    value += penalty.getValue(t, l(i), h(i));
+  }
+  EXPECT_NEAR(batchPenalty.getValue(t, h, &l), value, 1e-9);
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <ocs2_core/thread_support/BufferedSnapshot.h>
+
+#include <string>
+#include <thread>
+
+TEST(testBufferedSnapshot, basicSetGet) {
+  // initialize
+  const std::string initialValue{"init"};
+  ocs2::BufferedSnapshot<std::string> bufferedSnapshot(initialValue);
+  ASSERT_EQ(bufferedSnapshot.get(), initialValue);
+  ASSERT_EQ(bufferedSnapshot.version(), 0);
+
+  // set buffer with copy
+  const std::string updatedValue{"update"};
+  bufferedSnapshot.setBuffer(updatedValue);
+  ASSERT_EQ(bufferedSnapshot.get(), initialValue);
+
+  // update
+  const bool isUpdated = bufferedSnapshot.updateFromBuffer();
+  ASSERT_TRUE(isUpdated);
+  ASSERT_EQ(bufferedSnapshot.get(), updatedValue);
+  ASSERT_EQ(bufferedSnapshot.version(), 1);
+
+  // update twice is false
+  const bool isUpdatedTwice = bufferedSnapshot.updateFromBuffer();
+  ASSERT_FALSE(isUpdatedTwice);
+  ASSERT_EQ(bufferedSnapshot.version(), 1);
+
+  // set buffer with r-value
+  bufferedSnapshot.setBuffer("update again");
+  ASSERT_TRUE(bufferedSnapshot.updateFromBuffer());
+  ASSERT_EQ(bufferedSnapshot.get(), "update again");
+  ASSERT_EQ(bufferedSnapshot.version(), 2);
+}
+
+TEST(testBufferedSnapshot, snapshotIsImmutable) {
+  ocs2::BufferedSnapshot<std::string> bufferedSnapshot(std::string("init"));
+
+  // a snapshot shares the active value
+  const auto snapshot = bufferedSnapshot.getSnapshot();
+  ASSERT_EQ(snapshot.get(), &bufferedSnapshot.get());
+
+  // writing to the active value does not change the snapshot
+  bufferedSnapshot.getMutable() = "modified";
+  ASSERT_EQ(*snapshot, "init");
+  ASSERT_EQ(bufferedSnapshot.get(), "modified");
+
+  // without outstanding snapshots, the active value is written in place
+  const auto* activeValuePtr = &bufferedSnapshot.get();
+  bufferedSnapshot.getMutable() += "!";
+  ASSERT_EQ(&bufferedSnapshot.get(), activeValuePtr);
+
+  // replacing the active value does not change the snapshot
+  const auto modifiedSnapshot = bufferedSnapshot.getSnapshot();
+  bufferedSnapshot.setBuffer("update");
+  bufferedSnapshot.updateFromBuffer();
+  ASSERT_EQ(*modifiedSnapshot, "modified!");
+  ASSERT_EQ(bufferedSnapshot.get(), "update");
+}
+
+namespace {
+/**
+ * Class that counts the amount of times it has been copied.
+ */
+class CopyCounter {
+ public:
+  CopyCounter() = default;
+  CopyCounter(const CopyCounter& other) : count_(other.count_ + 1){};
+  CopyCounter& operator=(const CopyCounter& other) {
+    count_ = other.count_ + 1;
+    return *this;
+  }
+  CopyCounter(CopyCounter&&) = default;
+  CopyCounter& operator=(CopyCounter&&) = default;
+
+  int getCount() const { return count_; }
+
+ private:
+  int count_ = 0;
+};
+}  // unnamed namespace
+
+TEST(testBufferedSnapshot, copyCount) {
+  ocs2::BufferedSnapshot<CopyCounter> bufferedSnapshot(CopyCounter{});
+  ASSERT_EQ(bufferedSnapshot.get().getCount(), 0);
+
+  // moving a new value and taking a snapshot of it does not copy
+  bufferedSnapshot.setBuffer(CopyCounter{});
+  bufferedSnapshot.updateFromBuffer();
+  auto snapshot = bufferedSnapshot.getSnapshot();
+  ASSERT_EQ(snapshot->getCount(), 0);
+
+  // writing while the snapshot is held copies once
+  bufferedSnapshot.getMutable();
+  bufferedSnapshot.getMutable();
+  ASSERT_EQ(bufferedSnapshot.get().getCount(), 1);
+  ASSERT_EQ(snapshot->getCount(), 0);
+}
+
+TEST(testBufferedSnapshot, concurrentSetBuffer) {
+  constexpr int numValues = 1000;
+  ocs2::BufferedSnapshot<int> bufferedSnapshot(0);
+
+  std::thread publisher([&]() {
+    for (int i = 1; i <= numValues; ++i) {
+      bufferedSnapshot.setBuffer(i);
+    }
+  });
+
+  // the active value only increases
+  int lastValue = 0;
+  while (lastValue < numValues) {
+    bufferedSnapshot.updateFromBuffer();
+    const auto snapshot = bufferedSnapshot.getSnapshot();
+    ASSERT_GE(*snapshot, lastValue);
+    lastValue = *snapshot;
+  }
+  publisher.join();
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <ocs2_core/thread_support/SpinBarrier.h>
+#include <ocs2_core/thread_support/ThreadPool.h>
+
+using namespace ocs2;
+
+TEST(testSpinBarrier, phasesAreSeparated) {
+  constexpr int numWorkers = 4;
+  constexpr int numPhases = 200;
+  ThreadPool pool(numWorkers - 1);
+
+  for (size_t spinCount : {size_t(0), size_t(2048)}) {
+    SpinBarrier barrier(numWorkers, spinCount);
+    std::vector<int> counters(numWorkers, 0);
+    std::atomic_int worker{0};
+    std::atomic_bool isConsistent{true};
+
+    pool.runParallel(
+        [&](int) {
+          const int i = worker++;
+          for (int phase = 0; phase < numPhases; ++phase) {
+            counters[i] = phase + 1;
+            barrier.arriveAndWait();
+            // every worker has written its counter of this phase and none has started the next one
+            for (int j = 0; j < numWorkers; ++j) {
+              if (counters[j] != phase + 1) {
+                isConsistent = false;
+              }
+            }
+            barrier.arriveAndWait();
+          }
+        },
+        numWorkers);
+
+    EXPECT_TRUE(isConsistent) << "spinCount: " << spinCount;
+  }
+}
+
+TEST(testSpinBarrier, completionRunsOncePerPhase) {
+  constexpr int numWorkers = 3;
+  constexpr int numPhases = 100;
+  ThreadPool pool(numWorkers - 1);
+  SpinBarrier barrier(numWorkers);
+
+  int numCompletions = 0;
+  std::atomic_bool isConsistent{true};
+  pool.runParallel(
+      [&](int) {
+        for (int phase = 0; phase < numPhases; ++phase) {
+          barrier.arriveAndWait([&] { ++numCompletions; });
+          // the completion of this phase is visible to all workers
+          if (numCompletions != phase + 1) {
+            isConsistent = false;
+          }
+          barrier.arriveAndWait();
+        }
+      },
+      numWorkers);
+
+  EXPECT_EQ(numCompletions, numPhases);
+  EXPECT_TRUE(isConsistent);
+}
@@ -107,6 +107,12 @@ struct Settings {
   /** Use either the optimized control policy (true) or the optimized state-input trajectory (false). */
   bool useFeedbackPolicy_ = false;
 
+  /**
+   * Warm start: beyond the end of the previous controller, continue its final feedback policy in the initial rollout up to the next event
+   * time instead of using the Initializer.
+   */
+  bool warmStartPolicyContinuation_ = false;
+
   /** The risk sensitivity coefficient for risk aware DDP. */
   scalar_t riskSensitiveCoeff_ = 0.0;
 
@@ -373,6 +373,10 @@ class GaussNewtonDDP : public SolverBase {
   std::unique_ptr<RolloutBase> initializerRolloutPtr_;
   std::vector<std::unique_ptr<RolloutBase>> dynamicsForwardRolloutPtrStock_;
 
+  // snapshots of the references, kept alive for the whole run
+  std::shared_ptr<const ModeSchedule> modeScheduleSnapshot_;
+  std::shared_ptr<const TargetTrajectories> targetTrajectoriesSnapshot_;
+
   // optimized data
   DualSolution optimizedDualSolution_;
   PrimalSolution optimizedPrimalSolution_;
@@ -233,6 +233,7 @@ class ContinuousTimeRiccatiEquations final : public OdeBase {
 
   // array pointers
   const scalar_array_t* timeStampPtr_ = nullptr;
+  LinearInterpolation::Cursor timeStampCursor_;  // the integrator queries nearby, decreasing times
   const std::vector<ModelData>* projectedModelDataPtr_ = nullptr;
   const std::vector<ModelData>* modelDataEventTimesPtr_ = nullptr;
   const std::vector<riccati_modification::Data>* riccatiModificationPtr_ = nullptr;
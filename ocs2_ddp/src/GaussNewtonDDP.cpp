@@ -383,13 +383,24 @@ bool GaussNewtonDDP::rolloutInitialController(PrimalSolution& inputPrimalSolutio
   auto& inputLinearController = getLinearController(inputPrimalSolution);
 
   // adjust in-place the controller
-  std::ignore = trajectorySpread(inputPrimalSolution.modeSchedule_, getReferenceManager().getModeSchedule(), inputLinearController);
+  std::ignore = trajectorySpread(inputPrimalSolution.modeSchedule_, *modeScheduleSnapshot_, inputLinearController);
   // after adjustment it might become empty
   if (inputLinearController.empty()) {
     return false;
   }
 
-  const auto finalTime = std::max(initTime_, std::min(inputLinearController.timeStamp_.back(), finalTime_));
+  // the final policy of the controller is continued up to the next event time, where the linear controller holds its final gain and bias
+  const auto controllerFinalTime = [&]() -> scalar_t {
+    const scalar_t controllerEndTime = inputLinearController.timeStamp_.back();
+    if (ddpSettings_.warmStartPolicyContinuation_) {
+      const auto& eventTimes = modeScheduleSnapshot_->eventTimes;
+      const auto nextEventItr = std::upper_bound(eventTimes.begin(), eventTimes.end(), controllerEndTime);
+      return (nextEventItr == eventTimes.end()) ? finalTime_ : *nextEventItr;
+    } else {
+      return controllerEndTime;
+    }
+  }();
+  const auto finalTime = std::max(initTime_, std::min(controllerFinalTime, finalTime_));
 
   if (initTime_ < finalTime) {
     if (ddpSettings_.debugPrintRollout_) {
@@ -414,7 +425,7 @@ bool GaussNewtonDDP::extractInitialTrajectories(PrimalSolution& inputPrimalSolut
   }
 
   // adjust in-place the primalSolution
-  std::ignore = trajectorySpread(inputPrimalSolution.modeSchedule_, getReferenceManager().getModeSchedule(), inputPrimalSolution);
+  std::ignore = trajectorySpread(inputPrimalSolution.modeSchedule_, *modeScheduleSnapshot_, inputPrimalSolution);
   // after adjustment it might become empty
   if (inputPrimalSolution.timeTrajectory_.empty()) {
     return false;
@@ -835,7 +846,7 @@ bool GaussNewtonDDP::initializePrimalSolution() {
     nominalPrimalData_.clear();
 
     // for non-StateTriggeredRollout case, set modeSchedule
-    nominalPrimalData_.primalSolution.modeSchedule_ = getReferenceManager().getModeSchedule();
+    nominalPrimalData_.primalSolution.modeSchedule_ = *modeScheduleSnapshot_;
 
     // try to initialize with controller
     bool initialSolutionExists = rolloutInitialController(optimizedPrimalSolution_, nominalPrimalData_.primalSolution);
@@ -904,7 +915,7 @@ void GaussNewtonDDP::takePrimalDualStep(scalar_t lqModelExpectedCost) {
   // update primal: run search strategy and find the optimal stepLength
   searchStrategyTimer_.startTimer();
   scalar_t avgTimeStep;
-  const auto& modeSchedule = this->getReferenceManager().getModeSchedule();
+  const auto& modeSchedule = *modeScheduleSnapshot_;
   search_strategy::SolutionRef solution(avgTimeStep, optimizedDualSolution_, optimizedPrimalSolution_, optimizedProblemMetrics_,
                                         performanceIndex_);
   const bool success = searchStrategyPtr_->run({initTime_, finalTime_}, initState_, lqModelExpectedCost, unoptimizedController_,
@@ -978,17 +989,21 @@ void GaussNewtonDDP::runImpl(scalar_t initTime, const vector_t& initState, scala
 /******************************************************************************************************/
 /******************************************************************************************************/
 void GaussNewtonDDP::runImpl(scalar_t initTime, const vector_t& initState, scalar_t finalTime) {
+  // take the snapshots of the references for this run
+  modeScheduleSnapshot_ = getReferenceManager().getModeScheduleSnapshot();
+  targetTrajectoriesSnapshot_ = getReferenceManager().getTargetTrajectoriesSnapshot();
+
   if (ddpSettings_.displayInfo_) {
     std::cerr << "\n++++++++++++++++++++++++++++++++++++++++++++++++++++++";
     std::cerr << "\n+++++++++++++ " + ddp::toAlgorithmName(ddpSettings_.algorithm_) + " solver is initialized ++++++++++++++";
     std::cerr << "\n++++++++++++++++++++++++++++++++++++++++++++++++++++++\n";
     std::cerr << "\nSolver starts from initial time " << initTime << " to final time " << finalTime << ".\n";
-    std::cerr << getReferenceManager().getModeSchedule();
+    std::cerr << *modeScheduleSnapshot_;
   }
 
   // set cost desired trajectories
   for (auto& ocp : optimalControlProblemStock_) {
-    ocp.targetTrajectoriesPtr = &this->getReferenceManager().getTargetTrajectories();
+    ocp.targetTrajectoriesPtr = targetTrajectoriesSnapshot_.get();
   }
 
   // initialize parameters
@@ -51,6 +51,18 @@ namespace ipm {
 void condenseIneqConstraints(scalar_t barrierParam, const vector_t& slack, const vector_t& dual,
                              const VectorFunctionLinearApproximation& ineqConstraints, ScalarFunctionQuadraticApproximation& lagrangian);
 
+/**
+ * Shifts the complementarity target of inequality constraints that are already condensed into the Lagrangian by
+ * condenseIneqConstraints. The condensing targets slack .* dual = barrierParam; after this call the target is
+ * barrierParam + targetShift. Only the gradient of the Lagrangian changes, hence the factorization of the Newton system is unaffected.
+ * @param[in] targetShift : The shift of the complementarity target of each constraint.
+ * @param[in] slack : The slack variable associated with the inequality constraints.
+ * @param[in] ineqConstraints : Linear approximation of the inequality constraints.
+ * @param[in, out] lagrangian : Quadratic approximation of the Lagrangian.
+ */
+void shiftComplementarityTarget(const vector_t& targetShift, const vector_t& slack,
+                                const VectorFunctionLinearApproximation& ineqConstraints, ScalarFunctionQuadraticApproximation& lagrangian);
+
 /**
  * Computes the SSE of the residual in the perturbed complementary slackness.
  *
@@ -99,6 +111,18 @@ vector_t retrieveSlackDirection(const VectorFunctionLinearApproximation& stateIn
  */
 vector_t retrieveDualDirection(scalar_t barrierParam, const vector_t& slack, const vector_t& dual, const vector_t& slackDirection);
 
+/**
+ * Retrieves the Newton directions of the dual variable for a complementarity target that differs between the constraints, e.g. the
+ * corrector step of the Mehrotra predictor-corrector method.
+ * @param[in] complementarityTarget : The target of slack .* dual of each constraint.
+ * @param[in] slack : The slack variable associated with the inequality constraints.
+ * @param[in] dual : The dual variable associated with the inequality constraints.
+ * @param[in] slackDirection : The Newton direction of the slack variable.
+ * @return Newton directions of the dual variable.
+ */
+vector_t retrieveDualDirection(const vector_t& complementarityTarget, const vector_t& slack, const vector_t& dual,
+                               const vector_t& slackDirection);
+
 /**
  * Computes the step size via fraction-to-boundary-rule, which is introduced in the IPOPT's implementaion paper,
  * "On the implementation of an interior-point filter line-search algorithm for large-scale nonlinear programming"
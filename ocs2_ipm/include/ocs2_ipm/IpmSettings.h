@@ -73,6 +73,13 @@ struct Settings {
   scalar_t barrierReductionConstraintTol = 1.0e-02;  // Barrier reduction condition : Constraint violations below this value
   scalar_t barrierLinearDecreaseFactor = 0.2;        // Linear decrease factor of the barrier parameter, i.e., mu <- mu * factor.
   scalar_t barrierSuperlinearDecreasePower = 1.5;    // Superlinear decrease factor of the barrier parameter, i.e., mu <- mu ^ factor
+  bool usePredictorCorrector = false;  // If true, Mehrotra's predictor-corrector step is used and the barrier parameter is set by its
+                                       // centering parameter instead of the above reduction rule. The corrector reuses the factorization.
+  bool warmStartBarrierParameter = true;  // If true, an MPC call starts from the final barrier parameter of the previous call instead of
+                                          // initialBarrierParameter, to match the slack and dual variables warm started from it.
+  bool warmStartPolicyContinuation = false;  // If true, beyond the end of the previous solution, the final policy of the previous call is
+                                             // continued through the dynamics instead of using the Initializer, and its final costate and
+                                             // projection multiplier are held instead of being set to zero.
 
   // Initialization of the interior point method. Follows the initialization method of IPOPT
   // (https://coin-or.github.io/Ipopt/OPTIONS.html#OPT_Initialization).
@@ -154,11 +154,24 @@ class IpmSolver : public SolverBase {
     scalar_t armijoDescentMetric;  // inner product of the cost gradient and decision variable step
     scalar_t maxPrimalStepSize;
     scalar_t maxDualStepSize;
+    scalar_t centeringBarrierParameter;  // barrier parameter targeted by the corrector, only set with the predictor-corrector method
   };
   OcpSubproblemSolution getOCPSolution(const vector_t& delta_x0, scalar_t barrierParam, const vector_array_t& slackStateIneq,
                                        const vector_array_t& dualStateIneq, const vector_array_t& slackStateInputIneq,
                                        const vector_array_t& dualStateInputIneq);
 
+  /**
+   * Solves the QP subproblem with Mehrotra's predictor-corrector method. The predictor solve factorizes the Newton system with the
+   * complementarity target zero, the corrector re-solves it with the centering and second order terms in the gradient only.
+   * Returns the complementarity targets of the corrector for the dual directions, and the linear term of its cost-to-go if the value
+   * function is created. The Lagrangian is left condensed with barrierParam.
+   */
+  hpipm_status solvePredictorCorrector(const vector_t& delta_x0, scalar_t barrierParam, const vector_array_t& slackStateIneq,
+                                       const vector_array_t& dualStateIneq, const vector_array_t& slackStateInputIneq,
+                                       const vector_array_t& dualStateInputIneq, vector_array_t& deltaXSol, vector_array_t& deltaUSol,
+                                       vector_array_t& targetStateIneq, vector_array_t& targetStateInputIneq,
+                                       vector_array_t& costToGoGradient, scalar_t& centeringBarrierParam);
+
   /** Extract the value function based on the last solved QP */
   void extractValueFunction(const std::vector<AnnotatedTime>& time, const vector_array_t& x, const vector_array_t& lmd,
                             const vector_array_t& deltaXSol);
@@ -198,12 +211,17 @@ class IpmSolver : public SolverBase {
   // Threading
   ThreadPool threadPool_;
 
+  // Snapshots of the references, kept alive for the whole run
+  std::shared_ptr<const ModeSchedule> modeScheduleSnapshot_;
+  std::shared_ptr<const TargetTrajectories> targetTrajectoriesSnapshot_;
+
   // Solution
   PrimalSolution primalSolution_;
   vector_array_t costateTrajectory_;
   vector_array_t projectionMultiplierTrajectory_;
   DualSolution slackIneqTrajectory_;
   DualSolution dualIneqTrajectory_;
+  scalar_t barrierParameter_ = 0.0;  // final barrier parameter of the last run
 
   // Value function in absolute state coordinates (without the constant value)
   std::vector<ScalarFunctionQuadraticApproximation> valueFunction_;
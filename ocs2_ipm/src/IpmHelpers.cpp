@@ -67,6 +67,19 @@ void condenseIneqConstraints(scalar_t barrierParam, const vector_t& slack, const
   }
 }
 
+void shiftComplementarityTarget(const vector_t& targetShift, const vector_t& slack, const VectorFunctionLinearApproximation& ineqConstraint,
+                                ScalarFunctionQuadraticApproximation& lagrangian) {
+  if (ineqConstraint.f.size() == 0) {
+    return;
+  }
+
+  const vector_t linearCoeffShift = targetShift.cwiseQuotient(slack);
+  lagrangian.dfdx.noalias() -= ineqConstraint.dfdx.transpose() * linearCoeffShift;
+  if (ineqConstraint.dfdu.cols() > 0) {
+    lagrangian.dfdu.noalias() -= ineqConstraint.dfdu.transpose() * linearCoeffShift;
+  }
+}
+
 vector_t retrieveSlackDirection(const VectorFunctionLinearApproximation& stateInputIneqConstraints, const vector_t& dx, const vector_t& du,
                                 scalar_t barrierParam, const vector_t& slackStateInputIneq) {
   assert(barrierParam > 0.0);
@@ -100,6 +113,14 @@ vector_t retrieveDualDirection(scalar_t barrierParam, const vector_t& slack, con
   return dualDirection;
 }
 
+vector_t retrieveDualDirection(const vector_t& complementarityTarget, const vector_t& slack, const vector_t& dual,
+                               const vector_t& slackDirection) {
+  vector_t dualDirection = dual.cwiseProduct(slack + slackDirection);
+  dualDirection -= complementarityTarget;
+  dualDirection.array() /= -slack.array();
+  return dualDirection;
+}
+
 scalar_t fractionToBoundaryStepSize(const vector_t& v, const vector_t& dv, scalar_t marginRate) {
   assert(marginRate > 0.0);
   assert(marginRate <= 1.0);
@@ -163,7 +184,17 @@ DualSolution toDualSolution(const std::vector<AnnotatedTime>& time, const std::v
   dualSolution.intermediates.reserve(time.size());
 
   for (int i = 0; i < N; ++i) {
-    if (time[i].event == AnnotatedTime::Event::PreEvent) {
+    if (i == 0) {
+      // The state-only inequality constraints are disabled at the initial node. Take them from the next intermediate node such that the
+      // interpolation over the first interval is consistent in size.
+      dualSolution.intermediates.emplace_back(toMultiplierCollection(constraintsSize[0], stateIneq[0], stateInputIneq[0]));
+      for (int j = 1; j < N; ++j) {
+        if (time[j].event != AnnotatedTime::Event::PreEvent) {
+          dualSolution.intermediates.back().stateIneq = toMultiplierCollection(constraintsSize[j], stateIneq[j]).stateIneq;
+          break;
+        }
+      }
+    } else if (time[i].event == AnnotatedTime::Event::PreEvent) {
       dualSolution.preJumps.emplace_back(toMultiplierCollection(constraintsSize[i], stateIneq[i]));
       dualSolution.intermediates.push_back(dualSolution.intermediates.back());  // no event at the initial node
     } else {
@@ -72,6 +72,9 @@ Settings loadSettings(const std::string& filename, const std::string& fieldName,
   loadData::loadPtreeValue(pt, settings.barrierReductionConstraintTol, fieldName + ".barrierReductionConstraintTol", verbose);
   loadData::loadPtreeValue(pt, settings.barrierLinearDecreaseFactor, fieldName + ".barrierLinearDecreaseFactor", verbose);
   loadData::loadPtreeValue(pt, settings.barrierSuperlinearDecreasePower, fieldName + ".barrierSuperlinearDecreasePower", verbose);
+  loadData::loadPtreeValue(pt, settings.usePredictorCorrector, fieldName + ".usePredictorCorrector", verbose);
+  loadData::loadPtreeValue(pt, settings.warmStartBarrierParameter, fieldName + ".warmStartBarrierParameter", verbose);
+  loadData::loadPtreeValue(pt, settings.warmStartPolicyContinuation, fieldName + ".warmStartPolicyContinuation", verbose);
   loadData::loadPtreeValue(pt, settings.fractionToBoundaryMargin, fieldName + ".fractionToBoundaryMargin", verbose);
   loadData::loadPtreeValue(pt, settings.usePrimalStepSizeForDual, fieldName + ".usePrimalStepSizeForDual", verbose);
   loadData::loadPtreeValue(pt, settings.initialSlackLowerBound, fieldName + ".initialSlackLowerBound", verbose);
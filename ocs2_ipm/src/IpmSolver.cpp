@@ -40,6 +40,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_oc/multiple_shooting/MetricsComputation.h>
 #include <ocs2_oc/multiple_shooting/PerformanceIndexComputation.h>
 #include <ocs2_oc/oc_problem/OcpSize.h>
+#include <ocs2_oc/oc_solver/ContinuationInitializer.h>
 #include <ocs2_oc/trajectory_adjustment/TrajectorySpreadingHelperFunctions.h>
 
 #include "ocs2_ipm/IpmHelpers.h"
@@ -58,6 +59,7 @@ ipm::Settings rectifySettings(const OptimalControlProblem& ocp, ipm::Settings&&
   if (ocp.inequalityConstraintPtr->empty() && ocp.stateInequalityConstraintPtr->empty() && ocp.preJumpInequalityConstraintPtr->empty() &&
       ocp.finalInequalityConstraintPtr->empty()) {
     settings.targetBarrierParameter = settings.initialBarrierParameter;
+    settings.usePredictorCorrector = false;
   }
   return settings;
 }
@@ -80,7 +82,11 @@ IpmSolver::IpmSolver(ipm::Settings settings, const OptimalControlProblem& optima
   }
 
   // Operating points
-  initializerPtr_.reset(initializer.clone());
+  if (settings_.warmStartPolicyContinuation) {
+    initializerPtr_.reset(new ContinuationInitializer(initializer, *optimalControlProblem.dynamicsPtr, settings_.integratorType));
+  } else {
+    initializerPtr_.reset(initializer.clone());
+  }
 
   // Linesearch
   filterLinesearch_.g_max = settings_.g_max;
@@ -207,19 +213,22 @@ void IpmSolver::runImpl(scalar_t initTime, const vector_t& initState, scalar_t f
     std::cerr << "\n++++++++++++++++++++++++++++++++++++++++++++++++++++++\n";
   }
 
+  // Take the snapshots of the references for this run
+  modeScheduleSnapshot_ = this->getReferenceManager().getModeScheduleSnapshot();
+  targetTrajectoriesSnapshot_ = this->getReferenceManager().getTargetTrajectoriesSnapshot();
+
   // Determine time discretization, taking into account event times.
-  const auto& eventTimes = this->getReferenceManager().getModeSchedule().eventTimes;
+  const auto& eventTimes = modeScheduleSnapshot_->eventTimes;
   const auto timeDiscretization = timeDiscretizationWithEvents(initTime, finalTime, settings_.dt, eventTimes);
 
   // Initialize references
   for (auto& ocpDefinition : ocpDefinitions_) {
-    const auto& targetTrajectories = this->getReferenceManager().getTargetTrajectories();
-    ocpDefinition.targetTrajectoriesPtr = &targetTrajectories;
+    ocpDefinition.targetTrajectoriesPtr = targetTrajectoriesSnapshot_.get();
   }
 
   // old and new mode schedules for the trajectory spreading
   const auto oldModeSchedule = primalSolution_.modeSchedule_;
-  const auto& newModeSchedule = this->getReferenceManager().getModeSchedule();
+  const auto& newModeSchedule = *modeScheduleSnapshot_;
 
   initializationTimer_.startTimer();
   // Initialize the state and input
@@ -227,6 +236,9 @@ void IpmSolver::runImpl(scalar_t initTime, const vector_t& initState, scalar_t f
     std::ignore = trajectorySpread(oldModeSchedule, newModeSchedule, primalSolution_);
   }
   vector_array_t x, u;
+  if (settings_.warmStartPolicyContinuation) {
+    static_cast<ContinuationInitializer&>(*initializerPtr_).setPolicy(primalSolution_);
+  }
   multiple_shooting::initializeStateInputTrajectories(initState, timeDiscretization, primalSolution_, *initializerPtr_, x, u);
 
   // Initialize the slack and dual variables of the interior point method
@@ -235,6 +247,9 @@ void IpmSolver::runImpl(scalar_t initTime, const vector_t& initState, scalar_t f
     std::ignore = trajectorySpread(oldModeSchedule, newModeSchedule, dualIneqTrajectory_);
   }
   scalar_t barrierParam = settings_.initialBarrierParameter;
+  if (settings_.warmStartBarrierParameter && !slackIneqTrajectory_.timeTrajectory.empty()) {
+    barrierParam = std::min(barrierParam, std::max(barrierParameter_, settings_.targetBarrierParameter));
+  }
   vector_array_t slackStateIneq, dualStateIneq, slackStateInputIneq, dualStateInputIneq;
   initializeSlackDualTrajectory(timeDiscretization, x, u, barrierParam, slackStateIneq, dualStateIneq, slackStateInputIneq,
                                 dualStateInputIneq);
@@ -287,7 +302,11 @@ void IpmSolver::runImpl(scalar_t initTime, const vector_t& initState, scalar_t f
     convergence = checkConvergence(iter, barrierParam, baselinePerformance, stepInfo);
 
     // Update the barrier parameter
-    barrierParam = updateBarrierParameter(barrierParam, baselinePerformance, stepInfo);
+    if (settings_.usePredictorCorrector) {
+      barrierParam = std::min(barrierParam, deltaSolution.centeringBarrierParameter);
+    } else {
+      barrierParam = updateBarrierParameter(barrierParam, baselinePerformance, stepInfo);
+    }
 
     // Next iteration
     ++iter;
@@ -300,6 +319,7 @@ void IpmSolver::runImpl(scalar_t initTime, const vector_t& initState, scalar_t f
   projectionMultiplierTrajectory_ = std::move(nu);
   slackIneqTrajectory_ = ipm::toDualSolution(timeDiscretization, constraintsSize_, slackStateIneq, slackStateInputIneq);
   dualIneqTrajectory_ = ipm::toDualSolution(timeDiscretization, constraintsSize_, dualStateIneq, dualStateInputIneq);
+  barrierParameter_ = barrierParam;
   problemMetrics_ = multiple_shooting::toProblemMetrics(timeDiscretization, std::move(metrics));
   computeControllerTimer_.endTimer();
 
@@ -324,19 +344,27 @@ void IpmSolver::initializeCostateTrajectory(const std::vector<AnnotatedTime>& ti
   const auto interpolateTill =
       primalSolution_.timeTrajectory_.size() < 2 ? timeDiscretization.front().time : primalSolution_.timeTrajectory_.back();
 
+  // Beyond the previous solution, either hold its final costate or initialize with zero
+  const bool holdFinalCostate = settings_.warmStartPolicyContinuation && !costateTrajectory_.empty() &&
+                                costateTrajectory_.size() == primalSolution_.timeTrajectory_.size() &&
+                                costateTrajectory_.back().size() == stateTrajectory.front().size();
+  auto tailCostate = [&](size_t stateDim) -> vector_t {
+    return holdFinalCostate ? costateTrajectory_.back() : vector_t::Zero(stateDim);
+  };
+
   const scalar_t initTime = getIntervalStart(timeDiscretization[0]);
   if (initTime < interpolateTill) {
     costateTrajectory.push_back(LinearInterpolation::interpolate(initTime, primalSolution_.timeTrajectory_, costateTrajectory_));
   } else {
-    costateTrajectory.push_back(vector_t::Zero(stateTrajectory[0].size()));
+    costateTrajectory.push_back(tailCostate(stateTrajectory[0].size()));
   }
 
   for (int i = 1; i < stateTrajectory.size(); i++) {
     const auto time = getIntervalEnd(timeDiscretization[i]);
     if (time < interpolateTill) {  // interpolate previous solution
       costateTrajectory.push_back(LinearInterpolation::interpolate(time, primalSolution_.timeTrajectory_, costateTrajectory_));
-    } else {  // Initialize with zero
-      costateTrajectory.push_back(vector_t::Zero(stateTrajectory[i].size()));
+    } else {  // continue the previous solution or initialize with zero
+      costateTrajectory.push_back(tailCostate(stateTrajectory[i].size()));
     }
   }
 }
@@ -352,6 +380,8 @@ void IpmSolver::initializeProjectionMultiplierTrajectory(const std::vector<Annot
   const auto interpolateTill =
       primalSolution_.timeTrajectory_.size() < 2 ? timeDiscretization.front().time : *std::prev(primalSolution_.timeTrajectory_.end(), 2);
 
+  const bool holdFinalMultiplier = settings_.warmStartPolicyContinuation && !primalSolution_.timeTrajectory_.empty();
+
   // @todo Fix this using trajectory spreading
   auto interpolateProjectionMultiplierTrajectory = [&](scalar_t time) -> vector_t {
     const size_t numConstraints = ocpDefinition.equalityConstraintPtr->getNumConstraints(time);
@@ -378,7 +408,7 @@ void IpmSolver::initializeProjectionMultiplierTrajectory(const std::vector<Annot
       // Intermediate node
       const scalar_t time = getIntervalStart(timeDiscretization[i]);
       const size_t numConstraints = ocpDefinition.equalityConstraintPtr->getNumConstraints(time);
-      if (time < interpolateTill) {  // interpolate previous solution
+      if (time < interpolateTill || holdFinalMultiplier) {  // interpolate previous solution, which holds its final value beyond its end
         projectionMultiplierTrajectory.push_back(interpolateProjectionMultiplierTrajectory(time));
       } else {  // Initialize with zero
         projectionMultiplierTrajectory.push_back(vector_t::Zero(numConstraints));
@@ -399,7 +429,7 @@ void IpmSolver::initializeSlackDualTrajectory(const std::vector<AnnotatedTime>&
   // find the time period that we can interpolate the cached solution
   const auto timePeriod = std::make_pair(newTimeTrajectory.front(), newTimeTrajectory.back());
   const auto interpolatableTimePeriod =
-      findIntersectionToExtendableInterval(oldTimeTrajectory, this->getReferenceManager().getModeSchedule().eventTimes, timePeriod);
+      findIntersectionToExtendableInterval(oldTimeTrajectory, modeScheduleSnapshot_->eventTimes, timePeriod);
   const bool interpolateTillFinalTime = numerics::almost_eq(interpolatableTimePeriod.second, timePeriod.second);
   const auto cacheEventIndexBias = [&]() -> size_t {
     if (!newPostEventIndices.empty()) {
@@ -440,7 +470,7 @@ void IpmSolver::initializeSlackDualTrajectory(const std::vector<AnnotatedTime>&
         std::tie(slackStateIneq[i], slackStateInputIneq[i]) =
             ipm::fromMultiplierCollection(getIntermediateDualSolutionAtTime(slackIneqTrajectory_, time));
         std::tie(dualStateIneq[i], dualStateInputIneq[i]) =
-            ipm::fromMultiplierCollection(getIntermediateDualSolutionAtTime(slackIneqTrajectory_, time));
+            ipm::fromMultiplierCollection(getIntermediateDualSolutionAtTime(dualIneqTrajectory_, time));
       } else {
         std::tie(slackStateIneq[i], slackStateInputIneq[i]) = ipm::initializeIntermediateSlackVariable(
             ocpDefinition, time, x[i], u[i], settings_.initialSlackLowerBound, settings_.initialSlackMarginRate);
@@ -477,7 +507,14 @@ IpmSolver::OcpSubproblemSolution IpmSolver::getOCPSolution(const vector_t& delta
   auto& deltaUSol = solution.deltaUSol;
   hpipm_status status;
   hpipmInterface_.resize(extractSizesFromProblem(dynamics_, lagrangian_, nullptr));
-  status = hpipmInterface_.solve(delta_x0, dynamics_, lagrangian_, nullptr, deltaXSol, deltaUSol, settings_.printSolverStatus);
+  vector_array_t targetStateIneq, targetStateInputIneq, costToGoGradient;
+  if (settings_.usePredictorCorrector) {
+    status = solvePredictorCorrector(delta_x0, barrierParam, slackStateIneq, dualStateIneq, slackStateInputIneq, dualStateInputIneq,
+                                     deltaXSol, deltaUSol, targetStateIneq, targetStateInputIneq, costToGoGradient,
+                                     solution.centeringBarrierParameter);
+  } else {
+    status = hpipmInterface_.solve(delta_x0, dynamics_, lagrangian_, nullptr, deltaXSol, deltaUSol, settings_.printSolverStatus);
+  }
 
   if (status != hpipm_status::SUCCESS) {
     throw std::runtime_error("[IpmSolver] Failed to solve QP");
@@ -489,6 +526,12 @@ IpmSolver::OcpSubproblemSolution IpmSolver::getOCPSolution(const vector_t& delta
   // Extract value function
   if (settings_.createValueFunction) {
     valueFunction_ = hpipmInterface_.getRiccatiCostToGo(dynamics_[0], lagrangian_[0]);
+    // The factorization is the one of the predictor, take the linear terms of the corrector
+    if (settings_.usePredictorCorrector) {
+      for (int i = 0; i < valueFunction_.size(); ++i) {
+        valueFunction_[i].dfdx.swap(costToGoGradient[i]);
+      }
+    }
   }
 
   // Problem horizon
@@ -510,6 +553,13 @@ IpmSolver::OcpSubproblemSolution IpmSolver::getOCPSolution(const vector_t& delta
   scalar_array_t primalStepSizes(settings_.nThreads, 1.0);
   scalar_array_t dualStepSizes(settings_.nThreads, 1.0);
 
+  // The corrector of the predictor-corrector method targets a different complementarity for each constraint
+  auto retrieveDualDirection = [&](const vector_array_t& target, int i, const vector_t& slack, const vector_t& dual,
+                                   const vector_t& slackDirection) {
+    return settings_.usePredictorCorrector ? ipm::retrieveDualDirection(target[i], slack, dual, slackDirection)
+                                           : ipm::retrieveDualDirection(barrierParam, slack, dual, slackDirection);
+  };
+
   std::atomic_int timeIndex{0};
   auto parallelTask = [&](int workerId) {
     // Get worker specific resources
@@ -518,11 +568,11 @@ IpmSolver::OcpSubproblemSolution IpmSolver::getOCPSolution(const vector_t& delta
     int i = timeIndex++;
     while (i < N) {
       deltaSlackStateIneq[i] = ipm::retrieveSlackDirection(stateIneqConstraints_[i], deltaXSol[i], barrierParam, slackStateIneq[i]);
-      deltaDualStateIneq[i] = ipm::retrieveDualDirection(barrierParam, slackStateIneq[i], dualStateIneq[i], deltaSlackStateIneq[i]);
+      deltaDualStateIneq[i] = retrieveDualDirection(targetStateIneq, i, slackStateIneq[i], dualStateIneq[i], deltaSlackStateIneq[i]);
       deltaSlackStateInputIneq[i] =
           ipm::retrieveSlackDirection(stateInputIneqConstraints_[i], deltaXSol[i], deltaUSol[i], barrierParam, slackStateInputIneq[i]);
       deltaDualStateInputIneq[i] =
-          ipm::retrieveDualDirection(barrierParam, slackStateInputIneq[i], dualStateInputIneq[i], deltaSlackStateInputIneq[i]);
+          retrieveDualDirection(targetStateInputIneq, i, slackStateInputIneq[i], dualStateInputIneq[i], deltaSlackStateInputIneq[i]);
       primalStepSizes[workerId] = std::min(
           {primalStepSizes[workerId],
            ipm::fractionToBoundaryStepSize(slackStateIneq[i], deltaSlackStateIneq[i], settings_.fractionToBoundaryMargin),
@@ -556,7 +606,7 @@ IpmSolver::OcpSubproblemSolution IpmSolver::getOCPSolution(const vector_t& delta
 
     if (i == N) {  // Only one worker will execute this
       deltaSlackStateIneq[i] = ipm::retrieveSlackDirection(stateIneqConstraints_[i], deltaXSol[i], barrierParam, slackStateIneq[i]);
-      deltaDualStateIneq[i] = ipm::retrieveDualDirection(barrierParam, slackStateIneq[i], dualStateIneq[i], deltaSlackStateIneq[i]);
+      deltaDualStateIneq[i] = retrieveDualDirection(targetStateIneq, i, slackStateIneq[i], dualStateIneq[i], deltaSlackStateIneq[i]);
       primalStepSizes[workerId] =
           std::min(primalStepSizes[workerId],
                    ipm::fractionToBoundaryStepSize(slackStateIneq[i], deltaSlackStateIneq[i], settings_.fractionToBoundaryMargin));
@@ -577,6 +627,133 @@ IpmSolver::OcpSubproblemSolution IpmSolver::getOCPSolution(const vector_t& delta
   return solution;
 }
 
+hpipm_status IpmSolver::solvePredictorCorrector(const vector_t& delta_x0, scalar_t barrierParam, const vector_array_t& slackStateIneq,
+                                                const vector_array_t& dualStateIneq, const vector_array_t& slackStateInputIneq,
+                                                const vector_array_t& dualStateInputIneq, vector_array_t& deltaXSol,
+                                                vector_array_t& deltaUSol, vector_array_t& targetStateIneq,
+                                                vector_array_t& targetStateInputIneq, vector_array_t& costToGoGradient,
+                                                scalar_t& centeringBarrierParam) {
+  // Problem horizon
+  const int N = static_cast<int>(dynamics_.size());
+
+  // The gradients condensed with barrierParam are restored after the corrector
+  vector_array_t lagrangianDfdx(N + 1), lagrangianDfdu(N + 1);
+  for (int i = 0; i <= N; ++i) {
+    lagrangianDfdx[i] = lagrangian_[i].dfdx;
+    lagrangianDfdu[i] = lagrangian_[i].dfdu;
+  }
+
+  // Shifts the complementarity targets of all nodes by targetStateIneq and targetStateInputIneq
+  auto shiftComplementarityTargets = [&]() {
+    std::atomic_int timeIndex{0};
+    runParallel([&](int workerId) {
+      int i = timeIndex++;
+      while (i <= N) {
+        ipm::shiftComplementarityTarget(targetStateIneq[i], slackStateIneq[i], stateIneqConstraints_[i], lagrangian_[i]);
+        if (i < N) {
+          ipm::shiftComplementarityTarget(targetStateInputIneq[i], slackStateInputIneq[i], stateInputIneqConstraints_[i], lagrangian_[i]);
+        }
+        i = timeIndex++;
+      }
+    });
+  };
+
+  // Predictor: the affine scaling direction, i.e., a complementarity target of zero. This solve factorizes the Newton system.
+  targetStateIneq.resize(N + 1);
+  targetStateInputIneq.resize(N);
+  for (int i = 0; i < N; ++i) {
+    targetStateIneq[i].setConstant(slackStateIneq[i].size(), -barrierParam);
+    targetStateInputIneq[i].setConstant(slackStateInputIneq[i].size(), -barrierParam);
+  }
+  targetStateIneq[N].setConstant(slackStateIneq[N].size(), -barrierParam);
+  shiftComplementarityTargets();
+
+  vector_array_t deltaXAffine, deltaUAffine;
+  auto status = hpipmInterface_.solve(delta_x0, dynamics_, lagrangian_, nullptr, deltaXAffine, deltaUAffine, settings_.printSolverStatus);
+  if (status != hpipm_status::SUCCESS) {
+    return status;
+  }
+
+  // Affine slack and dual directions, and the largest steps that keep them positive
+  vector_array_t deltaSlackStateIneq(N + 1), deltaDualStateIneq(N + 1), deltaSlackStateInputIneq(N), deltaDualStateInputIneq(N);
+  scalar_array_t primalStepSizes(settings_.nThreads, 1.0);
+  scalar_array_t dualStepSizes(settings_.nThreads, 1.0);
+  scalar_array_t complementarity(settings_.nThreads, 0.0);
+  std::vector<size_t> numConstraints(settings_.nThreads, 0);
+  std::atomic_int timeIndex{0};
+  runParallel([&](int workerId) {
+    auto affineDirections = [&](const vector_t& slack, const vector_t& dual, vector_t& deltaSlack, vector_t& deltaDual) {
+      deltaDual = ipm::retrieveDualDirection(vector_t::Zero(slack.size()), slack, dual, deltaSlack);
+      primalStepSizes[workerId] = std::min(primalStepSizes[workerId], ipm::fractionToBoundaryStepSize(slack, deltaSlack, 1.0));
+      dualStepSizes[workerId] = std::min(dualStepSizes[workerId], ipm::fractionToBoundaryStepSize(dual, deltaDual, 1.0));
+      complementarity[workerId] += slack.dot(dual);
+      numConstraints[workerId] += slack.size();
+    };
+
+    int i = timeIndex++;
+    while (i <= N) {
+      deltaSlackStateIneq[i] = ipm::retrieveSlackDirection(stateIneqConstraints_[i], deltaXAffine[i], barrierParam, slackStateIneq[i]);
+      affineDirections(slackStateIneq[i], dualStateIneq[i], deltaSlackStateIneq[i], deltaDualStateIneq[i]);
+      if (i < N) {
+        deltaSlackStateInputIneq[i] = ipm::retrieveSlackDirection(stateInputIneqConstraints_[i], deltaXAffine[i], deltaUAffine[i],
+                                                                  barrierParam, slackStateInputIneq[i]);
+        affineDirections(slackStateInputIneq[i], dualStateInputIneq[i], deltaSlackStateInputIneq[i], deltaDualStateInputIneq[i]);
+      }
+      i = timeIndex++;
+    }
+  });
+
+  const scalar_t primalStepSize = *std::min_element(primalStepSizes.begin(), primalStepSizes.end());
+  const scalar_t dualStepSize = *std::min_element(dualStepSizes.begin(), dualStepSizes.end());
+  const size_t totalNumConstraints = std::accumulate(numConstraints.begin(), numConstraints.end(), size_t(0));
+  const scalar_t averageComplementarity =
+      std::accumulate(complementarity.begin(), complementarity.end(), 0.0) / std::max(totalNumConstraints, size_t(1));
+
+  // Average complementarity after the affine step
+  scalar_t affineComplementarity = 0.0;
+  auto accumulateAffineComplementarity = [&](const vector_t& slack, const vector_t& dual, const vector_t& deltaSlack,
+                                             const vector_t& deltaDual) {
+    affineComplementarity += (slack + primalStepSize * deltaSlack).dot(dual + dualStepSize * deltaDual);
+  };
+  for (int i = 0; i < N; ++i) {
+    accumulateAffineComplementarity(slackStateIneq[i], dualStateIneq[i], deltaSlackStateIneq[i], deltaDualStateIneq[i]);
+    accumulateAffineComplementarity(slackStateInputIneq[i], dualStateInputIneq[i], deltaSlackStateInputIneq[i], deltaDualStateInputIneq[i]);
+  }
+  accumulateAffineComplementarity(slackStateIneq[N], dualStateIneq[N], deltaSlackStateIneq[N], deltaDualStateIneq[N]);
+  affineComplementarity /= std::max(totalNumConstraints, size_t(1));
+
+  // Mehrotra's heuristic for the centering parameter
+  if (totalNumConstraints > 0 && averageComplementarity > 0.0) {
+    const scalar_t centering = std::min(std::pow(affineComplementarity / averageComplementarity, 3), 1.0);
+    centeringBarrierParam = std::max(centering * averageComplementarity, settings_.targetBarrierParameter);
+  } else {
+    centeringBarrierParam = barrierParam;
+  }
+
+  // Corrector: the target sigma * mu - dslack_aff .* ddual_aff compensates the linearization error of the complementarity. Since the
+  // current target is zero, the targets are also the shifts.
+  for (int i = 0; i < N; ++i) {
+    targetStateIneq[i] = -deltaSlackStateIneq[i].cwiseProduct(deltaDualStateIneq[i]);
+    targetStateIneq[i].array() += centeringBarrierParam;
+    targetStateInputIneq[i] = -deltaSlackStateInputIneq[i].cwiseProduct(deltaDualStateInputIneq[i]);
+    targetStateInputIneq[i].array() += centeringBarrierParam;
+  }
+  targetStateIneq[N] = -deltaSlackStateIneq[N].cwiseProduct(deltaDualStateIneq[N]);
+  targetStateIneq[N].array() += centeringBarrierParam;
+  shiftComplementarityTargets();
+
+  status = hpipmInterface_.resolve(delta_x0, dynamics_, lagrangian_, deltaXSol, deltaUSol,
+                                   settings_.createValueFunction ? &costToGoGradient : nullptr);
+
+  // Restore the gradients condensed with barrierParam
+  for (int i = 0; i <= N; ++i) {
+    lagrangian_[i].dfdx.swap(lagrangianDfdx[i]);
+    lagrangian_[i].dfdu.swap(lagrangianDfdu[i]);
+  }
+
+  return status;
+}
+
 void IpmSolver::extractValueFunction(const std::vector<AnnotatedTime>& time, const vector_array_t& x, const vector_array_t& lmd,
                                      const vector_array_t& deltaXSol) {
   if (settings_.createValueFunction) {
@@ -591,14 +768,13 @@ void IpmSolver::extractValueFunction(const std::vector<AnnotatedTime>& time, con
 }
 
 PrimalSolution IpmSolver::toPrimalSolution(const std::vector<AnnotatedTime>& time, vector_array_t&& x, vector_array_t&& u) {
+  ModeSchedule modeSchedule = *modeScheduleSnapshot_;
   if (settings_.useFeedbackPolicy) {
-    ModeSchedule modeSchedule = this->getReferenceManager().getModeSchedule();
     matrix_array_t KMatrices = hpipmInterface_.getRiccatiFeedback(dynamics_[0], lagrangian_[0]);
     multiple_shooting::remapProjectedGain(constraintsProjection_, KMatrices);
     return multiple_shooting::toPrimalSolution(time, std::move(modeSchedule), std::move(x), std::move(u), std::move(KMatrices));
 
   } else {
-    ModeSchedule modeSchedule = this->getReferenceManager().getModeSchedule();
     return multiple_shooting::toPrimalSolution(time, std::move(modeSchedule), std::move(x), std::move(u));
   }
 }
@@ -343,4 +343,62 @@ TEST(test_circular_kinematics, solve_projected_EqConstraints_MixedIneqConstraint
   for (const auto e : shiftTime) {
     solver.run(startTime + e, initState, finalTime + e);
   }
-}
\ No newline at end of file
+}
+
+TEST(test_circular_kinematics, solve_projected_EqConstraints_IneqConstraints_PredictorCorrector) {
+  // optimal control problem
+  OptimalControlProblem problem = createCircularKinematicsProblem("/tmp/ocs2/ipm_test_generated");
+
+  // input box constraints
+  const vector_t umin = (vector_t(2) << -0.5, -0.5).finished();
+  const vector_t umax = (vector_t(2) << 0.5, 0.5).finished();
+  const vector_t e = (vector_t(4) << -umin, umax).finished();
+  const matrix_t C = matrix_t::Zero(4, 2);
+  const matrix_t D = (matrix_t(4, 2) << matrix_t::Identity(2, 2), -matrix_t::Identity(2, 2)).finished();
+  problem.inequalityConstraintPtr->add("ubound", std::make_unique<LinearStateInputConstraint>(e, C, D));
+
+  // Initializer
+  DefaultInitializer zeroInitializer(2);
+
+  // Solver settings
+  auto getSettings = [](bool usePredictorCorrector) {
+    ipm::Settings s;
+    s.dt = 0.01;
+    s.ipmIteration = 40;
+    s.useFeedbackPolicy = true;
+    s.printSolverStatistics = true;
+    s.printSolverStatus = true;
+    s.nThreads = 1;
+    s.initialBarrierParameter = 1.0e-02;
+    s.targetBarrierParameter = 1.0e-06;
+    s.usePredictorCorrector = usePredictorCorrector;
+    return s;
+  };
+
+  // Additional problem definitions
+  const scalar_t startTime = 0.0;
+  const scalar_t finalTime = 1.0;
+  const vector_t initState = (vector_t(2) << 1.0, 0.0).finished();  // radius 1.0
+
+  // Solve
+  IpmSolver solver(getSettings(false), problem, zeroInitializer);
+  solver.run(startTime, initState, finalTime);
+  IpmSolver solverPC(getSettings(true), problem, zeroInitializer);
+  solverPC.run(startTime, initState, finalTime);
+
+  const auto primalSolution = solverPC.primalSolution(finalTime);
+  for (const auto& u : primalSolution.inputTrajectory_) {
+    if (u.size() > 0) {
+      ASSERT_TRUE((u - umin).minCoeff() >= 0);
+      ASSERT_TRUE((umax - u).minCoeff() >= 0);
+    }
+  }
+
+  // Both variants converge to the same solution
+  const auto performance = solver.getPerformanceIndeces();
+  const auto performancePC = solverPC.getPerformanceIndeces();
+  ASSERT_LT(performancePC.dynamicsViolationSSE, 1e-6);
+  ASSERT_LT(performancePC.equalityConstraintsSSE, 1e-6);
+  ASSERT_NEAR(performancePC.cost, performance.cost, 1e-3 * std::abs(performance.cost));
+  ASSERT_LE(solverPC.getIterationsLog().size(), solver.getIterationsLog().size());
+}
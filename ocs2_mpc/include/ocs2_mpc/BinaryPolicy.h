@@ -0,0 +1,306 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <ocs2_oc/oc_data/PerformanceIndex.h>
+#include <ocs2_oc/oc_data/PrimalSolution.h>
+
+#include "ocs2_mpc/CommandData.h"
+
+namespace ocs2 {
+namespace binary_policy {
+
+/**
+ * A compact binary format for transmitting an MPC policy (PrimalSolution, CommandData, and PerformanceIndex) as one contiguous
+ * byte buffer. The buffer starts with a fixed-size Header followed by the payload sections in this order:
+ *
+ * performance indices | observation | target trajectories | mode schedule | primal trajectories | controller
+ *
+ * Times, event times, and performance indices are always stored as float64. The state, input, and feedforward (bias) data use
+ * Settings::trajectoryEncoding and the feedback gains use Settings::gainEncoding. All the trajectories must have node-wise uniform
+ * dimensions and the data is stored in the host byte order (little-endian on all supported platforms), matching the ROS serialization.
+ */
+
+/** Magic number at the start of every buffer: "OCSP" */
+constexpr uint32_t MAGIC = 0x5053434F;
+
+/** Version of the format. */
+constexpr uint16_t VERSION = 1;
+
+/** Encoding of the floating-point blocks. */
+enum class Encoding : uint8_t {
+  /** Lossless. */
+  FLOAT64 = 0,
+  /** Same precision as the mpc_flattened_controller message. */
+  FLOAT32 = 1,
+  /** IEEE 754 half precision. Values with magnitude larger than 65504 are rejected. */
+  FLOAT16 = 2,
+  /** IEEE 754 half precision of the difference to the previous node. Most useful for the slowly varying feedback gains. */
+  FLOAT16_DELTA = 3,
+};
+
+/** The encoding settings. */
+struct Settings {
+  /** Encoding of the state, input, and feedforward trajectories. */
+  Encoding trajectoryEncoding = Encoding::FLOAT32;
+  /** Encoding of the feedback gains of a LinearController. */
+  Encoding gainEncoding = Encoding::FLOAT32;
+};
+
+/** Fixed-size header at the start of the buffer. */
+struct Header {
+  uint32_t magic;
+  uint16_t version;
+  uint8_t controllerType;  // ControllerType::FEEDFORWARD or ControllerType::LINEAR
+  uint8_t trajectoryEncoding;
+  uint8_t gainEncoding;
+  uint8_t reserved[3];
+  uint32_t stateDim;
+  uint32_t inputDim;
+  uint32_t numNodes;            // size of PrimalSolution::timeTrajectory_
+  uint32_t numControllerNodes;  // size of the controller's time stamp
+  uint32_t numPostEventIndices;
+  uint32_t numModes;  // size of ModeSchedule::modeSequence
+  uint32_t observationMode;
+  uint32_t observationStateDim;
+  uint32_t observationInputDim;
+  uint32_t numTargetNodes;
+  uint32_t numTargetStates;
+  uint32_t numTargetInputs;
+  uint32_t targetStateDim;
+  uint32_t targetInputDim;
+  uint64_t payloadSize;  // number of bytes after the header
+};
+
+/**
+ * Computes the size of the encoded buffer.
+ *
+ * @param [in] commandData: The command data of the MPC.
+ * @param [in] primalSolution: The policy data of the MPC.
+ * @param [in] settings: The encoding settings.
+ * @return The number of bytes written by encode.
+ */
+size_t encodedSize(const CommandData& commandData, const PrimalSolution& primalSolution, const Settings& settings = Settings());
+
+/**
+ * Encodes the MPC policy. The buffer is resized to encodedSize() and its memory is reused between calls.
+ *
+ * @param [in] commandData: The command data of the MPC.
+ * @param [in] primalSolution: The policy data of the MPC. Its controller must be a FeedforwardController or a LinearController.
+ * @param [in] performanceIndices: The performance indices of the solver.
+ * @param [in] settings: The encoding settings.
+ * @param [out] buffer: The encoded policy.
+ */
+void encode(const CommandData& commandData, const PrimalSolution& primalSolution, const PerformanceIndex& performanceIndices,
+            const Settings& settings, std::vector<uint8_t>& buffer);
+
+/**
+ * Encodes the MPC policy in place into a pre-allocated buffer, e.g., a shared-memory slot.
+ *
+ * @param [in] commandData: The command data of the MPC.
+ * @param [in] primalSolution: The policy data of the MPC. Its controller must be a FeedforwardController or a LinearController.
+ * @param [in] performanceIndices: The performance indices of the solver.
+ * @param [in] settings: The encoding settings.
+ * @param [out] data: Pointer to the start of the buffer.
+ * @param [in] capacity: The size of the buffer. Throws std::runtime_error if it is smaller than encodedSize().
+ * @return The number of written bytes.
+ */
+size_t encode(const CommandData& commandData, const PrimalSolution& primalSolution, const PerformanceIndex& performanceIndices,
+              const Settings& settings, uint8_t* data, size_t capacity);
+
+/**
+ * Reads the header of an encoded buffer and checks its magic number, version, and size.
+ *
+ * @param [in] data: Pointer to the start of the buffer.
+ * @param [in] size: The size of the buffer in bytes.
+ * @return The header.
+ */
+Header readHeader(const uint8_t* data, size_t size);
+
+/**
+ * Decodes an MPC policy directly into the given objects. The trajectories of the output arguments are resized in place, so decoding
+ * repeatedly into the same objects does not allocate once their sizes have settled. The controller is reused if it already has the
+ * encoded type.
+ *
+ * @param [in] data: Pointer to the start of the buffer.
+ * @param [in] size: The size of the buffer in bytes.
+ * @param [out] commandData: The command data of the MPC.
+ * @param [out] primalSolution: The policy data of the MPC.
+ * @param [out] performanceIndices: The performance indices of the solver.
+ */
+void decode(const uint8_t* data, size_t size, CommandData& commandData, PrimalSolution& primalSolution,
+            PerformanceIndex& performanceIndices);
+
+/** Decodes an MPC policy from a buffer. */
+inline void decode(const std::vector<uint8_t>& buffer, CommandData& commandData, PrimalSolution& primalSolution,
+                   PerformanceIndex& performanceIndices) {
+  decode(buffer.data(), buffer.size(), commandData, primalSolution, performanceIndices);
+}
+
+/**
+ * Incremental policy updates. Consecutive MPC policies overlap in time and most of their nodes change only slightly. Therefore, the
+ * DeltaEncoder sends a full policy (key frame) only from time to time. The updates in between contain the command data, the
+ * performance indices, the mode schedule, and the complete time trajectories, but only those nodes which deviate by more than a
+ * tolerance from the last key frame interpolated at their time. This prediction also covers the shift of the horizon since the key
+ * frame. The DeltaDecoder reconstructs the skipped nodes with the same prediction from the last key frame.
+ *
+ * Each update refers to the last key frame and not to the previous update, so a lost update, e.g., dropped by a subscriber queue of
+ * size one, does not affect the following ones. Only after a lost key frame, the decoder rejects the updates until the next key
+ * frame, which is sent at least every DeltaSettings::keyFrameInterval updates. The updates grow as the policy drifts away from the
+ * key frame, until DeltaSettings::maxSizeRatio triggers a new key frame.
+ *
+ * An update starts with a Header with the DELTA_MAGIC and the dimensions of the complete policy, followed by a DeltaHeader and the
+ * payload sections of the full format. Before the state and the controller data, the indices of the transmitted nodes are stored as
+ * uint32 unless all nodes are transmitted.
+ */
+
+/** Magic number at the start of every incremental update: "OCSD" */
+constexpr uint32_t DELTA_MAGIC = 0x4453434F;
+
+/** Fixed-size header of an incremental update, directly after the Header. */
+struct DeltaHeader {
+  uint64_t sequence;                   // sequence number of the update, starting from 1
+  uint64_t baseSequence;               // sequence number of the key frame the update refers to, 0 for a key frame
+  uint32_t streamId;                   // random id of the encoder, which distinguishes a restarted MPC
+  uint32_t numChangedNodes;            // number of transmitted nodes of the primal trajectories
+  uint32_t numChangedControllerNodes;  // number of transmitted nodes of the controller
+  uint32_t reserved;
+};
+
+/** The settings of the incremental updates. */
+struct DeltaSettings {
+  /** A node of the state, input, or feedforward trajectories is transmitted if it deviates more than this from the prediction. */
+  scalar_t trajectoryTolerance = 1e-3;
+  /** A node of the feedback gains is transmitted if it deviates more than this from the prediction. */
+  scalar_t gainTolerance = 1e-2;
+  /** The maximum number of updates between two key frames. This bounds the outage after a lost key frame. */
+  size_t keyFrameInterval = 20;
+  /** A key frame is sent if an update would be larger than this ratio of it. */
+  scalar_t maxSizeRatio = 0.5;
+};
+
+/**
+ * Decodes the key frames and the incremental updates of a DeltaEncoder.
+ */
+class DeltaDecoder {
+ public:
+  /**
+   * Decodes a key frame or an incremental update directly into the given objects.
+   *
+   * @param [in] data: Pointer to the start of the buffer.
+   * @param [in] size: The size of the buffer in bytes.
+   * @param [out] commandData: The command data of the MPC.
+   * @param [out] primalSolution: The policy data of the MPC.
+   * @param [out] performanceIndices: The performance indices of the solver.
+   * @return false if the update refers to a key frame which has not been received or if it is older than the last decoded update. The
+   * outputs are not modified in this case.
+   */
+  bool decode(const uint8_t* data, size_t size, CommandData& commandData, PrimalSolution& primalSolution,
+              PerformanceIndex& performanceIndices);
+
+  /** Forgets the previous policy, such that the next updates are rejected until a new key frame arrives. */
+  void reset();
+
+  /** The last decoded key frame, which is the base of the next updates, or nullptr. */
+  const PrimalSolution* getKeyFrame() const { return basePtr_.get(); }
+
+ private:
+  std::unique_ptr<PrimalSolution> basePtr_;
+  Header baseHeader_;
+  DeltaHeader baseDeltaHeader_;
+  uint64_t lastSequence_ = 0;
+  std::vector<uint32_t> changedNodes_;
+  std::vector<uint32_t> changedControllerNodes_;
+};
+
+/**
+ * Encodes the MPC policies as key frames and incremental updates. See DeltaDecoder for the receiving side.
+ */
+class DeltaEncoder {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param [in] settings: The encoding settings of the transmitted nodes.
+   * @param [in] deltaSettings: The settings of the incremental updates.
+   */
+  DeltaEncoder(Settings settings, DeltaSettings deltaSettings);
+
+  /**
+   * Encodes the MPC policy either as a key frame or as an incremental update. The memory of the buffer is reused between calls.
+   *
+   * @param [in] commandData: The command data of the MPC.
+   * @param [in] primalSolution: The policy data of the MPC. Its controller must be a FeedforwardController or a LinearController.
+   * @param [in] performanceIndices: The performance indices of the solver.
+   * @param [out] buffer: The encoded policy.
+   * @return true if a key frame is written.
+   */
+  bool encode(const CommandData& commandData, const PrimalSolution& primalSolution, const PerformanceIndex& performanceIndices,
+              std::vector<uint8_t>& buffer);
+
+  /** Requests a key frame for the next policy, e.g., after the MPC has been reset. This method is thread-safe. */
+  void requestKeyFrame() { keyFrameRequested_ = true; }
+
+ private:
+  const Settings settings_;
+  const DeltaSettings deltaSettings_;
+  const uint32_t streamId_;
+  uint64_t sequence_ = 0;
+  uint64_t keyFrameSequence_ = 0;
+  Header baseHeader_;
+  size_t numUpdatesSinceKeyFrame_ = 0;
+  std::atomic_bool keyFrameRequested_{true};
+
+  // The state of the receiver. The prediction uses its last key frame which contains the quantization errors of the encoding.
+  DeltaDecoder mirror_;
+  CommandData mirrorCommandData_;
+  PrimalSolution mirrorPrimalSolution_;
+  PerformanceIndex mirrorPerformanceIndices_;
+
+  std::vector<uint32_t> changedNodes_;
+  std::vector<uint32_t> changedControllerNodes_;
+};
+
+/** Returns true if the buffer starts with the magic number of an incremental update. */
+bool isDelta(const uint8_t* data, size_t size);
+
+/** Converts a float to IEEE 754 half precision bits with round-to-nearest-even. */
+uint16_t floatToHalf(float value);
+
+/** Converts IEEE 754 half precision bits to a float. */
+float halfToFloat(uint16_t bits);
+
+}  // namespace binary_policy
+}  // namespace ocs2
@@ -29,12 +29,15 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <memory>
+
 #include <ocs2_core/Types.h>
 #include <ocs2_core/misc/Benchmark.h>
 
 #include <ocs2_oc/oc_solver/SolverBase.h>
 
 #include "ocs2_mpc/MPC_Settings.h"
+#include "ocs2_mpc/MpcRecord.h"
 
 namespace ocs2 {
 
@@ -79,6 +82,13 @@ class MPC_BASE {
   /** Gets the MPC settings. */
   const mpc::Settings& settings() const { return mpcSettings_; }
 
+  /**
+   * Sets a recorder which records the problem instance of every following run, see mpc_record::replay(). The recording copies the
+   * initial guess of the solver. Pass nullptr to stop recording.
+   * @note setRecorder() must not be called while the solver is running.
+   */
+  void setRecorder(std::unique_ptr<mpc_record::Recorder> recorderPtr) { recorderPtr_ = std::move(recorderPtr); }
+
  protected:
   /**
    * Solves the optimal control problem for the given state and time period ([initTime,finalTime]).
@@ -97,6 +107,11 @@ class MPC_BASE {
   const mpc::Settings mpcSettings_;
 
   benchmark::RepeatedTimer mpcTimer_;
+
+  std::unique_ptr<mpc_record::Recorder> recorderPtr_;
+  mpc_record::Instance recordedInstance_;
+  size_t recordedInitIteration_ = 0;
+  benchmark::RepeatedTimer recordTimer_;
 };
 
 }  // namespace ocs2
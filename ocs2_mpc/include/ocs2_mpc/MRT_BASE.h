@@ -45,6 +45,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_oc/oc_data/PrimalSolution.h>
 #include <ocs2_oc/rollout/RolloutBase.h>
 
+#include "ocs2_mpc/BinaryPolicy.h"
 #include "ocs2_mpc/CommandData.h"
 #include "ocs2_mpc/MrtObserver.h"
 #include "ocs2_mpc/SystemObservation.h"
@@ -162,6 +163,19 @@ class MRT_BASE {
   void moveToBuffer(std::unique_ptr<CommandData> commandDataPtr, std::unique_ptr<PrimalSolution> primalSolutionPtr,
                     std::unique_ptr<PerformanceIndex> performanceIndicesPtr);
 
+  /**
+   * Merges an incremental policy update of binary_policy::DeltaEncoder into the previously received policy and moves the result to the
+   * buffer. The received policy is kept separately, such that the modifications of the MRT observers do not leak into the next
+   * updates.
+   *
+   * @param [in] data: Pointer to the start of the encoded update.
+   * @param [in] size: The size of the encoded update in bytes.
+   * @return false if the update refers to a key frame which has not been received, e.g., because of a dropped message. The MPC
+   * resynchronizes with a full policy within binary_policy::DeltaSettings::keyFrameInterval updates. A dropped update which is not a
+   * key frame does not affect the following ones.
+   */
+  bool moveDeltaToBuffer(const uint8_t* data, size_t size);
+
  private:
   /** Calls modifyActiveSolution on all mrt observers. This function is called while holding a policyBufferMutex lock */
   void modifyActiveSolution(const CommandData& command, PrimalSolution& primalSolution);
@@ -183,6 +197,7 @@ class MRT_BASE {
 
   // thread safety
   mutable std::mutex bufferMutex_;  // for policy variables with the prefix (buffer*)
+  std::mutex policyDeltaMutex_;     // for policyDeltaDecoder_
   const size_t mrtTrylockWarningThreshold_ = 5;
   size_t mrtTrylockWarningCount_;
 
@@ -190,6 +205,9 @@ class MRT_BASE {
   std::unique_ptr<RolloutBase> rolloutPtr_;
 
   std::vector<std::shared_ptr<MrtObserver>> observerPtrArray_;
+
+  // the last received policy of the incremental policy updates
+  binary_policy::DeltaDecoder policyDeltaDecoder_;
 };
 
 }  // namespace ocs2
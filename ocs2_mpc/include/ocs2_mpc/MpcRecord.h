@@ -0,0 +1,130 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <ocs2_core/Types.h>
+#include <ocs2_core/reference/ModeSchedule.h>
+#include <ocs2_core/reference/TargetTrajectories.h>
+#include <ocs2_oc/oc_data/PerformanceIndex.h>
+#include <ocs2_oc/oc_data/PrimalSolution.h>
+#include <ocs2_oc/oc_solver/SolverBase.h>
+
+namespace ocs2 {
+namespace mpc_record {
+
+/**
+ * Recording and replay of MPC problem instances for offline, deterministic solver benchmarking.
+ *
+ * MPC_BASE::run() records the inputs of each solver run when a Recorder is set with MPC_BASE::setRecorder(): the initial time and
+ * state, the final time, the active TargetTrajectories and ModeSchedule, and the primal solution of the previous run which warm
+ * starts the solver. The file is a sequence of records. Each record has a fixed-size header followed by the mode schedule and the
+ * initial guess together with the observation and the target trajectories in the lossless binary_policy format.
+ *
+ * replay() feeds the loaded instances to any solver (SqpSolver, IpmSolver, SlpSolver, SLQ, ILQR). The solver is reset before every
+ * instance and warm started with the recorded initial guess, such that the result does not depend on the order of the instances.
+ * Only the primal solution is restored. The solver settings are not recorded, they are given by the solver which replays.
+ */
+
+/** Statistics of one solver run. */
+struct SolveStatistics {
+  scalar_t solveTimeInMilliseconds = 0.0;
+  size_t numIterations = 0;
+  /** The performance index of the solution. */
+  PerformanceIndex performanceIndex;
+};
+
+/** The inputs of one solver run. */
+struct Instance {
+  scalar_t initTime = 0.0;
+  scalar_t finalTime = 0.0;
+  vector_t initState;
+  TargetTrajectories targetTrajectories;
+  ModeSchedule modeSchedule;
+  /** Whether the solver is warm started with the initial guess. Otherwise it starts from its initializer. */
+  bool warmStart = false;
+  /** The primal solution of the previous run. Its controller is a FeedforwardController or a LinearController. */
+  PrimalSolution initialGuess;
+  /** The statistics of the recorded run. */
+  SolveStatistics recordedStatistics;
+};
+
+/**
+ * Appends the recorded instances to a binary file.
+ */
+class Recorder {
+ public:
+  /**
+   * Constructor. Throws std::runtime_error if the file cannot be opened.
+   *
+   * @param [in] filePath: The path of the file. An existing file is overwritten.
+   */
+  explicit Recorder(const std::string& filePath);
+
+  /** Writes the instance to the file. */
+  void write(const Instance& instance);
+
+  /** Writes the buffered records to the file. */
+  void flush() { file_.flush(); }
+
+ private:
+  std::ofstream file_;
+  std::vector<uint8_t> policyBuffer_;
+};
+
+/**
+ * Loads all the instances of a recorded file. Throws std::runtime_error if the file cannot be opened or is corrupted.
+ *
+ * @param [in] filePath: The path of the file.
+ * @return The recorded instances in their order of recording.
+ */
+std::vector<Instance> load(const std::string& filePath);
+
+/**
+ * Solves the recorded instances with the given solver. Before each run, the solver is reset and the recorded TargetTrajectories and
+ * ModeSchedule are set to its ReferenceManager. A ReferenceManager which modifies the references in preSolverRun(), e.g., from a
+ * gait schedule, should be replaced by a plain ReferenceManager for a deterministic replay.
+ *
+ * @param [in] solver: The solver.
+ * @param [in] instances: The recorded instances.
+ * @return The statistics of each instance.
+ */
+std::vector<SolveStatistics> replay(SolverBase& solver, const std::vector<Instance>& instances);
+
+/** Prints the statistics as one line. */
+std::ostream& operator<<(std::ostream& stream, const SolveStatistics& statistics);
+
+}  // namespace mpc_record
+}  // namespace ocs2
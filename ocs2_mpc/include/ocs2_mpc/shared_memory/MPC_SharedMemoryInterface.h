@@ -0,0 +1,160 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+#include <ocs2_core/misc/Benchmark.h>
+
+#include "ocs2_mpc/BinaryPolicy.h"
+#include "ocs2_mpc/CommandData.h"
+#include "ocs2_mpc/MPC_BASE.h"
+#include "ocs2_mpc/SystemObservation.h"
+#include "ocs2_mpc/shared_memory/SharedMemoryChannel.h"
+
+namespace ocs2 {
+namespace shared_memory {
+
+/** The settings of the shared-memory MPC-MRT transport. */
+struct Settings {
+  /** The maximum size of an encoded policy in bytes. */
+  size_t policyCapacity = 16 * 1024 * 1024;
+  /** The maximum size of an observation or a reset request in bytes. */
+  size_t observationCapacity = 1024 * 1024;
+  /** The number of slots in each ring. */
+  size_t numSlots = 3;
+  /** The encoding of the policy. Lossless by default, in which case encoding is a plain copy. */
+  binary_policy::Settings policyEncoding{binary_policy::Encoding::FLOAT64, binary_policy::Encoding::FLOAT64};
+};
+
+/** Returns the name of the channel which carries the policy from the MPC to the MRT. */
+inline std::string policyChannelName(const std::string& topicPrefix) {
+  return topicPrefix + "_mpc_policy";
+}
+
+/** Returns the name of the channel which carries the observations from the MRT to the MPC. */
+inline std::string observationChannelName(const std::string& topicPrefix) {
+  return topicPrefix + "_mpc_observation";
+}
+
+/**
+ * Returns the name of the channel which carries the reset requests from the MRT to the MPC. The requests have their own channel,
+ * such that a following observation cannot overwrite a reset request before the MPC reads it.
+ */
+inline std::string resetChannelName(const std::string& topicPrefix) {
+  return topicPrefix + "_mpc_reset";
+}
+
+}  // namespace shared_memory
+
+/**
+ * This class implements the MPC communication interface over shared memory for MPC and MRT processes on the same host. It is the
+ * counterpart of MRT_SharedMemoryInterface and has the same semantics as MPC_ROS_Interface. The policy is encoded in place into the
+ * shared memory, and the MRT decodes it in place, without any intermediate message.
+ *
+ * The MPC side owns the shared-memory segments, so it should be started first or the MRT should connect with a sufficient timeout.
+ */
+class MPC_SharedMemoryInterface {
+ public:
+  /**
+   * Constructor. Creates the shared-memory channels.
+   *
+   * @param [in] mpc: The underlying MPC class to be used.
+   * @param [in] topicPrefix: The robot's name, used as the prefix of the channel names.
+   * @param [in] settings: The transport settings.
+   */
+  explicit MPC_SharedMemoryInterface(MPC_BASE& mpc, const std::string& topicPrefix = "anonymousRobot",
+                                     shared_memory::Settings settings = shared_memory::Settings());
+
+  /**
+   * Resets the class to its instantiation state.
+   *
+   * @param [in] initTargetTrajectories: The initial desired cost trajectories.
+   */
+  void resetMpcNode(TargetTrajectories&& initTargetTrajectories);
+
+  /**
+   * Waits for the next message of the MRT and handles it. On an observation, the MPC is advanced and the policy is published. On a
+   * reset request, the MPC is reset. A pending reset request is handled before the observations, at the latest after the timeout.
+   *
+   * @param [in] timeout: The maximum waiting time.
+   * @return false on timeout.
+   */
+  bool spinOnce(std::chrono::microseconds timeout);
+
+  /**
+   * Handles the messages of the MRT until shutdown() is called.
+   */
+  void spin();
+
+  /**
+   * Stops spin(). Can be called from any thread.
+   */
+  void shutdown() { terminate_ = true; }
+
+ private:
+  /**
+   * Invokes the MPC with the given observation and publishes the optimized policy.
+   *
+   * @param [in] currentObservation: The observation.
+   */
+  void mpcObservationCallback(const SystemObservation& currentObservation);
+
+  /**
+   * Resets the MPC and acknowledges the request if the MRT sent a new reset request.
+   *
+   * @return true if a reset request was handled.
+   */
+  bool handleResetRequest();
+
+  MPC_BASE& mpc_;
+  const shared_memory::Settings settings_;
+
+  shared_memory::SharedMemoryChannel policyChannel_;
+  shared_memory::SharedMemoryChannel observationChannel_;
+  shared_memory::SharedMemoryChannel resetChannel_;
+  uint64_t lastObservationSequence_ = 0;
+  uint64_t lastResetSequence_ = 0;
+
+  // buffers reused between the MPC iterations
+  SystemObservation observation_;
+  TargetTrajectories targetTrajectories_;
+  CommandData commandData_;
+  PrimalSolution primalSolution_;
+  PerformanceIndex performanceIndices_;
+
+  bool resetRequestedEver_ = false;
+  std::atomic_bool terminate_{false};
+  benchmark::RepeatedTimer mpcTimer_;
+};
+
+}  // namespace ocs2
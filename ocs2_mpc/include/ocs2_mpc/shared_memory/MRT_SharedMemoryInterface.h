@@ -0,0 +1,83 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "ocs2_mpc/MRT_BASE.h"
+#include "ocs2_mpc/shared_memory/SharedMemoryChannel.h"
+
+namespace ocs2 {
+
+/**
+ * This class implements the MRT communication interface over shared memory for MPC and MRT processes on the same host. It is the
+ * counterpart of MPC_SharedMemoryInterface and has the same semantics as MRT_ROS_Interface.
+ */
+class MRT_SharedMemoryInterface final : public MRT_BASE {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param [in] topicPrefix: The robot's name, used as the prefix of the channel names.
+   */
+  explicit MRT_SharedMemoryInterface(std::string topicPrefix = "anonymousRobot");
+
+  ~MRT_SharedMemoryInterface() override = default;
+
+  /**
+   * Opens the shared-memory channels of the MPC. Throws std::runtime_error if the MPC does not create them within the timeout.
+   *
+   * @param [in] timeout: The maximum waiting time for the MPC process.
+   */
+  void launchNodes(std::chrono::microseconds timeout);
+
+  void resetMpcNode(const TargetTrajectories& initTargetTrajectories) override;
+
+  void setCurrentObservation(const SystemObservation& currentObservation) override;
+
+  /**
+   * Moves the latest policy of the MPC to the buffer if it has not been received yet. Call updatePolicy() afterwards to make it active.
+   *
+   * @param [in] timeout: The maximum waiting time for a new policy. Zero for not waiting.
+   * @return true if a new policy was received.
+   */
+  bool spinMRT(std::chrono::microseconds timeout = std::chrono::microseconds::zero());
+
+ private:
+  std::string topicPrefix_;
+  std::unique_ptr<shared_memory::SharedMemoryChannel> policyChannelPtr_;
+  std::unique_ptr<shared_memory::SharedMemoryChannel> observationChannelPtr_;
+  std::unique_ptr<shared_memory::SharedMemoryChannel> resetChannelPtr_;
+  uint64_t lastPolicySequence_ = 0;
+};
+
+}  // namespace ocs2
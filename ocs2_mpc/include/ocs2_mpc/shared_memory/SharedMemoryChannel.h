@@ -0,0 +1,142 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace ocs2 {
+namespace shared_memory {
+
+/**
+ * A single-producer, single-consumer "latest value" channel in a POSIX shared-memory segment, for communication between two
+ * processes on the same host.
+ *
+ * The segment holds a ring of fixed-capacity slots. A message is written in place into the next slot and published by
+ * incrementing the channel's sequence number, so the writer never blocks. Each slot is protected by a sequence lock: the reader
+ * accesses the latest slot in place and verifies afterwards that the writer did not overwrite it in the meantime, in which case it
+ * retries with the newer message. Intermediate messages are skipped if the reader is slower than the writer. A blocked reader is
+ * woken up with a futex, which costs no system call on the writer side if nobody waits.
+ *
+ * The segment is created and unlinked by the owner (created with the first constructor) and opened by the peer.
+ */
+class SharedMemoryChannel {
+ public:
+  /**
+   * Creates a new channel. An existing segment with the same name, e.g., from a crashed process, is replaced.
+   *
+   * @param [in] name: The name of the shared-memory segment, e.g., "robot_mpc_policy". It must not contain '/'.
+   * @param [in] slotCapacity: The maximum size of a message in bytes.
+   * @param [in] numSlots: The number of slots in the ring. At least two.
+   */
+  SharedMemoryChannel(const std::string& name, size_t slotCapacity, size_t numSlots);
+
+  /**
+   * Opens a channel created by another process.
+   *
+   * @param [in] name: The name of the shared-memory segment.
+   * @param [in] timeout: The time to wait for the owner to create the channel. Throws std::runtime_error on timeout.
+   */
+  SharedMemoryChannel(const std::string& name, std::chrono::microseconds timeout);
+
+  /** Unmaps the segment and unlinks it if this instance is the owner. */
+  ~SharedMemoryChannel();
+
+  SharedMemoryChannel(const SharedMemoryChannel&) = delete;
+  SharedMemoryChannel& operator=(const SharedMemoryChannel&) = delete;
+
+  /** The maximum size of a message in bytes. */
+  size_t slotCapacity() const;
+
+  /** The sequence number of the latest message. Zero if nothing has been written yet. */
+  uint64_t latestSequence() const;
+
+  /**
+   * Writes a message in place and publishes it. Only one process or thread may write to a channel.
+   *
+   * @param [in] writer: Writes the message into the given buffer of slotCapacity() bytes and returns its size.
+   * @return The sequence number of the message.
+   */
+  uint64_t write(const std::function<size_t(uint8_t* data, size_t capacity)>& writer);
+
+  /**
+   * Reads the latest message in place if it is newer than lastSequence. Only one process or thread may read from a channel.
+   *
+   * The reader may observe a partially overwritten message, in which case the call is repeated with the newer message. Therefore it
+   * should only write to its own outputs and must tolerate inconsistent data, e.g., by throwing.
+   *
+   * @param [in, out] lastSequence: The sequence number of the last read message, updated to the one of the read message.
+   * @param [in] reader: Reads the message of the given size.
+   * @return true if a new message was read.
+   */
+  bool read(uint64_t& lastSequence, const std::function<void(const uint8_t* data, size_t size)>& reader);
+
+  /**
+   * Blocks until a message newer than lastSequence is available.
+   *
+   * @param [in] lastSequence: The sequence number of the last read message.
+   * @param [in] timeout: The maximum waiting time.
+   * @return true if a newer message is available, false on timeout.
+   */
+  bool waitForMessage(uint64_t lastSequence, std::chrono::microseconds timeout) const;
+
+  /** Called by the reader to confirm that the message with the given sequence number has been processed. */
+  void acknowledge(uint64_t sequence);
+
+  /**
+   * Blocks until the reader acknowledged exactly the message with the given sequence number. The acknowledgement of any other
+   * message, e.g., of a newer one which overwrote it, does not count.
+   *
+   * @param [in] sequence: The sequence number of the written message.
+   * @param [in] timeout: The maximum waiting time.
+   * @return true if acknowledged, false on timeout.
+   */
+  bool waitForAcknowledge(uint64_t sequence, std::chrono::microseconds timeout) const;
+
+ private:
+  struct ControlBlock;
+  struct SlotHeader;
+
+  void map(int fileDescriptor, size_t size);
+  SlotHeader& slotHeader(uint64_t sequence) const;
+  uint8_t* slotData(uint64_t sequence) const;
+
+  std::string name_;
+  bool isOwner_;
+  uint8_t* segment_ = nullptr;
+  size_t segmentSize_ = 0;
+  ControlBlock* controlBlock_ = nullptr;
+};
+
+}  // namespace shared_memory
+}  // namespace ocs2
@@ -0,0 +1,81 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+#include <ocs2_core/reference/TargetTrajectories.h>
+
+#include "ocs2_mpc/SystemObservation.h"
+
+namespace ocs2 {
+namespace shared_memory {
+
+/**
+ * The messages sent from the MRT to the MPC over the shared-memory observation channel. The MPC policy is sent in the format of
+ * ocs2_mpc/BinaryPolicy.h.
+ */
+enum class MessageType : uint32_t {
+  UNKNOWN = 0,
+  OBSERVATION = 1,
+  RESET = 2,
+};
+
+/**
+ * Writes an observation message.
+ *
+ * @param [in] observation: The observation.
+ * @param [out] data: The message buffer.
+ * @param [in] capacity: The size of the buffer. Throws std::runtime_error if it is too small.
+ * @return The size of the message.
+ */
+size_t writeObservationMessage(const SystemObservation& observation, uint8_t* data, size_t capacity);
+
+/**
+ * Writes a reset request with the initial target trajectories.
+ *
+ * @param [in] targetTrajectories: The initial target trajectories.
+ * @param [out] data: The message buffer.
+ * @param [in] capacity: The size of the buffer. Throws std::runtime_error if it is too small.
+ * @return The size of the message.
+ */
+size_t writeResetMessage(const TargetTrajectories& targetTrajectories, uint8_t* data, size_t capacity);
+
+/** Returns the type of the message or MessageType::UNKNOWN. */
+MessageType readMessageType(const uint8_t* data, size_t size);
+
+/** Reads an observation message. Throws std::runtime_error if the message is malformed. */
+void readObservationMessage(const uint8_t* data, size_t size, SystemObservation& observation);
+
+/** Reads a reset request. Throws std::runtime_error if the message is malformed. */
+void readResetMessage(const uint8_t* data, size_t size, TargetTrajectories& targetTrajectories);
+
+}  // namespace shared_memory
+}  // namespace ocs2
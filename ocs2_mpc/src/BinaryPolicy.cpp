@@ -0,0 +1,1065 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_mpc/BinaryPolicy.h"
+
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#ifdef __F16C__
+#include <immintrin.h>
+#endif
+
+#include <ocs2_core/control/FeedforwardController.h>
+#include <ocs2_core/control/LinearController.h>
+#include <ocs2_core/misc/LinearInterpolation.h>
+
+namespace ocs2 {
+namespace binary_policy {
+
+static_assert(sizeof(Header) == 80, "binary_policy::Header must not contain padding.");
+
+namespace {
+
+constexpr size_t NUM_PERFORMANCE_INDICES = 8;
+
+/** Sequential writer into a pre-sized buffer. */
+class Writer {
+ public:
+  explicit Writer(uint8_t* data) : pos_(data) {}
+
+  template <typename T>
+  void write(const T* src, size_t n) {
+    std::memcpy(pos_, src, n * sizeof(T));
+    pos_ += n * sizeof(T);
+  }
+
+  template <typename T>
+  void writeValue(const T& value) {
+    write(&value, 1);
+  }
+
+  /** Returns the current position and advances it by the given number of bytes. */
+  uint8_t* advance(size_t numBytes) {
+    uint8_t* pos = pos_;
+    pos_ += numBytes;
+    return pos;
+  }
+
+  const uint8_t* position() const { return pos_; }
+
+ private:
+  uint8_t* pos_;
+};
+
+/** Sequential bounds-checked reader. */
+class Reader {
+ public:
+  Reader(const uint8_t* data, size_t size) : pos_(data), end_(data + size) {}
+
+  template <typename T>
+  void read(T* dst, size_t n) {
+    std::memcpy(dst, advance(n * sizeof(T)), n * sizeof(T));
+  }
+
+  /** Returns the current position and advances it by the given number of bytes. */
+  const uint8_t* advance(size_t numBytes) {
+    if (numBytes > static_cast<size_t>(end_ - pos_)) {
+      throw std::runtime_error("[binary_policy::decode] The buffer is truncated!");
+    }
+    const uint8_t* pos = pos_;
+    pos_ += numBytes;
+    return pos;
+  }
+
+  template <typename T>
+  T readValue() {
+    T value;
+    read(&value, 1);
+    return value;
+  }
+
+ private:
+  const uint8_t* pos_;
+  const uint8_t* end_;
+};
+
+size_t bytesPerValue(Encoding encoding) {
+  switch (encoding) {
+    case Encoding::FLOAT64:
+      return sizeof(double);
+    case Encoding::FLOAT32:
+      return sizeof(float);
+    case Encoding::FLOAT16:
+    case Encoding::FLOAT16_DELTA:
+      return sizeof(uint16_t);
+    default:
+      throw std::runtime_error("[binary_policy] Unknown encoding: " + std::to_string(static_cast<int>(encoding)));
+  }
+}
+
+/** IEEE 754 single to half precision with round-to-nearest-even. */
+inline uint16_t toHalfSoftware(float value) {
+  uint32_t f;
+  std::memcpy(&f, &value, sizeof(float));
+  const auto sign = static_cast<uint16_t>((f >> 16) & 0x8000);
+  const uint32_t absF = f & 0x7FFFFFFF;
+
+  if (absF >= 0x7F800000) {  // Inf or NaN
+    return sign | 0x7C00 | (absF > 0x7F800000 ? 0x0200 : 0);
+  }
+  if (absF >= 0x477FF000) {  // rounds to a magnitude of at least 65520
+    return sign | 0x7C00;
+  }
+  if (absF < 0x38800000) {  // subnormal half (below 2^-14)
+    if (absF < 0x33000000) {  // below 2^-25
+      return sign;
+    }
+    const uint32_t shift = 126 - (absF >> 23);
+    const uint32_t mantissa = (absF & 0x7FFFFF) | 0x800000;
+    uint32_t half = mantissa >> shift;
+    const uint32_t remainder = mantissa & ((1u << shift) - 1);
+    const uint32_t halfway = 1u << (shift - 1);
+    half += (remainder + (half & 1) > halfway) ? 1 : 0;  // may carry into the smallest normal which is the correct result
+    return sign | static_cast<uint16_t>(half);
+  }
+
+  // normal: rebias the exponent from 127 to 15
+  uint32_t half = (absF >> 13) - ((127 - 15) << 10);
+  const uint32_t remainder = absF & 0x1FFF;
+  half += (remainder + (half & 1) > 0x1000) ? 1 : 0;  // round to nearest, ties to even
+  return sign | static_cast<uint16_t>(half);
+}
+
+/** IEEE 754 half to single precision. */
+inline float fromHalfSoftware(uint16_t bits) {
+  const uint32_t sign = static_cast<uint32_t>(bits & 0x8000) << 16;
+  const uint32_t exponent = (bits >> 10) & 0x1F;
+  const uint32_t mantissa = bits & 0x3FF;
+
+  uint32_t f;
+  if (exponent == 0x1F) {  // Inf or NaN
+    f = sign | 0x7F800000 | (mantissa << 13);
+  } else if (exponent != 0) {
+    f = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+  } else {  // zero or subnormal
+    const float magnitude = std::ldexp(static_cast<float>(mantissa), -24);
+    return (sign != 0) ? -magnitude : magnitude;
+  }
+
+  float value;
+  std::memcpy(&value, &f, sizeof(float));
+  return value;
+}
+
+/** Returns the common dimension of all the vectors and throws if they differ. */
+size_t uniformSize(const vector_array_t& array, size_t defaultSize, const std::string& name) {
+  const size_t size = array.empty() ? defaultSize : array.front().size();
+  for (const auto& v : array) {
+    if (v.size() != size) {
+      throw std::runtime_error("[binary_policy::encode] All vectors of " + name + " must have the same size!");
+    }
+  }
+  return size;
+}
+
+uint32_t toUint32(size_t value, const std::string& name) {
+  if (value > UINT32_MAX) {
+    throw std::runtime_error("[binary_policy::encode] " + name + " is too large!");
+  }
+  return static_cast<uint32_t>(value);
+}
+
+/** Size of the payload without the data of the nodes. */
+uint64_t metaPayloadSize(const Header& header) {
+  const uint64_t numEventTimes = header.numModes > 0 ? header.numModes - 1 : 0;
+
+  uint64_t size = NUM_PERFORMANCE_INDICES * sizeof(scalar_t);
+  size += (1 + uint64_t(header.observationStateDim) + header.observationInputDim) * sizeof(scalar_t);
+  size += (header.numTargetNodes + uint64_t(header.numTargetStates) * header.targetStateDim +
+           uint64_t(header.numTargetInputs) * header.targetInputDim) *
+          sizeof(scalar_t);
+  size += numEventTimes * sizeof(scalar_t) + uint64_t(header.numModes) * sizeof(uint32_t);
+  size += uint64_t(header.numNodes) * sizeof(scalar_t) + uint64_t(header.numPostEventIndices) * sizeof(uint32_t);
+  size += uint64_t(header.numControllerNodes) * sizeof(scalar_t);
+  return size;
+}
+
+/** Size of the data of the given number of nodes. */
+uint64_t nodePayloadSize(const Header& header, uint64_t numNodes, uint64_t numControllerNodes) {
+  const auto trajectoryBytes = bytesPerValue(static_cast<Encoding>(header.trajectoryEncoding));
+  const auto gainBytes = bytesPerValue(static_cast<Encoding>(header.gainEncoding));
+
+  uint64_t size = numNodes * (header.stateDim + header.inputDim) * trajectoryBytes;
+  size += numControllerNodes * header.inputDim * trajectoryBytes;
+  if (header.controllerType == static_cast<uint8_t>(ControllerType::LINEAR)) {
+    size += numControllerNodes * header.inputDim * header.stateDim * gainBytes;
+  }
+  return size;
+}
+
+uint64_t computePayloadSize(const Header& header) {
+  return metaPayloadSize(header) + nodePayloadSize(header, header.numNodes, header.numControllerNodes);
+}
+
+uint64_t computeDeltaPayloadSize(const Header& header, const DeltaHeader& deltaHeader) {
+  uint64_t size = sizeof(DeltaHeader) + metaPayloadSize(header);
+  size += nodePayloadSize(header, deltaHeader.numChangedNodes, deltaHeader.numChangedControllerNodes);
+  if (deltaHeader.numChangedNodes < header.numNodes) {
+    size += uint64_t(deltaHeader.numChangedNodes) * sizeof(uint32_t);
+  }
+  if (deltaHeader.numChangedControllerNodes < header.numControllerNodes) {
+    size += uint64_t(deltaHeader.numChangedControllerNodes) * sizeof(uint32_t);
+  }
+  return size;
+}
+
+/** The data of a FeedforwardController or a LinearController. The gains are nullptr for a FeedforwardController. */
+struct ConstControllerData {
+  const scalar_array_t* time;
+  const vector_array_t* inputs;
+  const matrix_array_t* gains;
+};
+
+ConstControllerData getControllerData(const ControllerBase& controller) {
+  switch (controller.getType()) {
+    case ControllerType::FEEDFORWARD: {
+      const auto& feedforwardController = static_cast<const FeedforwardController&>(controller);
+      return {&feedforwardController.timeStamp_, &feedforwardController.uffArray_, nullptr};
+    }
+    case ControllerType::LINEAR: {
+      const auto& linearController = static_cast<const LinearController&>(controller);
+      return {&linearController.timeStamp_, &linearController.biasArray_, &linearController.gainArray_};
+    }
+    default:
+      throw std::runtime_error("[binary_policy::encode] Only FeedforwardController and LinearController are supported!");
+  }
+}
+
+struct ControllerData {
+  scalar_array_t* time;
+  vector_array_t* inputs;
+  matrix_array_t* gains;
+};
+
+/** Returns the data of the controller of the given type. The existing controller is reused if it has this type. */
+ControllerData getOrCreateController(PrimalSolution& primalSolution, uint8_t controllerType) {
+  if (controllerType == static_cast<uint8_t>(ControllerType::FEEDFORWARD)) {
+    auto* controllerPtr = dynamic_cast<FeedforwardController*>(primalSolution.controllerPtr_.get());
+    if (controllerPtr == nullptr) {
+      controllerPtr = new FeedforwardController();
+      primalSolution.controllerPtr_.reset(controllerPtr);
+    }
+    return {&controllerPtr->timeStamp_, &controllerPtr->uffArray_, nullptr};
+  } else {
+    auto* controllerPtr = dynamic_cast<LinearController*>(primalSolution.controllerPtr_.get());
+    if (controllerPtr == nullptr) {
+      controllerPtr = new LinearController();
+      primalSolution.controllerPtr_.reset(controllerPtr);
+    }
+    controllerPtr->deltaBiasArray_.clear();
+    return {&controllerPtr->timeStamp_, &controllerPtr->biasArray_, &controllerPtr->gainArray_};
+  }
+}
+
+Header makeHeader(const CommandData& commandData, const PrimalSolution& primalSolution, const Settings& settings) {
+  if (primalSolution.controllerPtr_ == nullptr) {
+    throw std::runtime_error("[binary_policy::encode] The primal solution has no controller!");
+  }
+  bytesPerValue(settings.trajectoryEncoding);  // throws on an unknown encoding
+  bytesPerValue(settings.gainEncoding);
+
+  Header header;
+  std::memset(&header, 0, sizeof(Header));
+  header.magic = MAGIC;
+  header.version = VERSION;
+  header.trajectoryEncoding = static_cast<uint8_t>(settings.trajectoryEncoding);
+  header.gainEncoding = static_cast<uint8_t>(settings.gainEncoding);
+
+  const auto controllerData = getControllerData(*primalSolution.controllerPtr_);
+  const auto* controllerTime = controllerData.time;
+  const auto* controllerInputs = controllerData.inputs;
+  const auto* controllerGains = controllerData.gains;
+  header.controllerType = static_cast<uint8_t>(primalSolution.controllerPtr_->getType());
+
+  const size_t N = primalSolution.timeTrajectory_.size();
+  if (primalSolution.stateTrajectory_.size() != N || primalSolution.inputTrajectory_.size() != N) {
+    throw std::runtime_error("[binary_policy::encode] The state and input trajectories must have the same length as the time!");
+  }
+  if (controllerInputs->size() != controllerTime->size() ||
+      (controllerGains != nullptr && controllerGains->size() != controllerTime->size())) {
+    throw std::runtime_error("[binary_policy::encode] The controller data must have the same length as its time stamp!");
+  }
+  header.numNodes = toUint32(N, "numNodes");
+  header.numControllerNodes = toUint32(controllerTime->size(), "numControllerNodes");
+  header.numPostEventIndices = toUint32(primalSolution.postEventIndices_.size(), "numPostEventIndices");
+
+  const size_t inputDim = uniformSize(controllerInputs->empty() ? primalSolution.inputTrajectory_ : *controllerInputs, 0, "inputs");
+  size_t stateDim = uniformSize(primalSolution.stateTrajectory_, 0, "stateTrajectory");
+  if (N == 0 && controllerGains != nullptr && !controllerGains->empty()) {
+    stateDim = controllerGains->front().cols();
+  }
+  uniformSize(primalSolution.inputTrajectory_, inputDim, "inputTrajectory");
+  uniformSize(*controllerInputs, inputDim, "controller");
+  if (controllerGains != nullptr) {
+    for (const auto& gain : *controllerGains) {
+      if (gain.rows() != inputDim || gain.cols() != stateDim) {
+        throw std::runtime_error("[binary_policy::encode] All gains must be of size inputDim x stateDim!");
+      }
+    }
+  }
+  header.stateDim = toUint32(stateDim, "stateDim");
+  header.inputDim = toUint32(inputDim, "inputDim");
+
+  const auto& modeSchedule = primalSolution.modeSchedule_;
+  if (modeSchedule.eventTimes.size() + 1 != modeSchedule.modeSequence.size() &&
+      !(modeSchedule.eventTimes.empty() && modeSchedule.modeSequence.empty())) {
+    throw std::runtime_error("[binary_policy::encode] The mode schedule must have one more mode than event times!");
+  }
+  header.numModes = toUint32(modeSchedule.modeSequence.size(), "numModes");
+
+  const auto& observation = commandData.mpcInitObservation_;
+  header.observationMode = toUint32(observation.mode, "observation mode");
+  header.observationStateDim = toUint32(observation.state.size(), "observation stateDim");
+  header.observationInputDim = toUint32(observation.input.size(), "observation inputDim");
+
+  const auto& targetTrajectories = commandData.mpcTargetTrajectories_;
+  header.numTargetNodes = toUint32(targetTrajectories.timeTrajectory.size(), "numTargetNodes");
+  header.numTargetStates = toUint32(targetTrajectories.stateTrajectory.size(), "numTargetStates");
+  header.numTargetInputs = toUint32(targetTrajectories.inputTrajectory.size(), "numTargetInputs");
+  header.targetStateDim = toUint32(uniformSize(targetTrajectories.stateTrajectory, 0, "target states"), "targetStateDim");
+  header.targetInputDim = toUint32(uniformSize(targetTrajectories.inputTrajectory, 0, "target inputs"), "targetInputDim");
+
+  header.payloadSize = computePayloadSize(header);
+  return header;
+}
+
+/** Uses the F16C instructions if enabled, e.g., with -march=native. Both variants give identical results for non-NaN values. */
+inline uint16_t toHalf(float value) {
+#ifdef __F16C__
+  return _cvtss_sh(value, _MM_FROUND_TO_NEAREST_INT);
+#else
+  return toHalfSoftware(value);
+#endif
+}
+
+inline float fromHalf(uint16_t bits) {
+#ifdef __F16C__
+  return _cvtsh_ss(bits);
+#else
+  return fromHalfSoftware(bits);
+#endif
+}
+
+/** Throws if a finite value overflowed to a float16 infinity. */
+inline void checkHalfOverflow(bool overflow) {
+  if (overflow) {
+    throw std::runtime_error("[binary_policy::encode] A value is out of the float16 range. Use Encoding::FLOAT32 instead.");
+  }
+}
+
+inline bool isHalfOverflow(uint16_t bits, scalar_t value) {
+  return (bits & 0x7FFF) == 0x7C00 && std::isfinite(value);
+}
+
+template <typename Array>
+void writeArray(Writer& writer, Encoding encoding, const Array& array) {
+  switch (encoding) {
+    case Encoding::FLOAT64:
+      for (const auto& a : array) {
+        writer.write(a.data(), a.size());
+      }
+      break;
+    case Encoding::FLOAT32:
+      for (const auto& a : array) {
+        const scalar_t* values = a.data();
+        const size_t n = a.size();
+        uint8_t* dst = writer.advance(n * sizeof(float));
+        for (size_t i = 0; i < n; i++) {
+          const auto value = static_cast<float>(values[i]);
+          std::memcpy(dst + i * sizeof(float), &value, sizeof(float));
+        }
+      }
+      break;
+    case Encoding::FLOAT16: {
+      bool overflow = false;
+      for (const auto& a : array) {
+        const scalar_t* values = a.data();
+        const size_t n = a.size();
+        uint8_t* dst = writer.advance(n * sizeof(uint16_t));
+        for (size_t i = 0; i < n; i++) {
+          const uint16_t bits = toHalf(static_cast<float>(values[i]));
+          overflow |= isHalfOverflow(bits, values[i]);
+          std::memcpy(dst + i * sizeof(uint16_t), &bits, sizeof(uint16_t));
+        }
+      }
+      checkHalfOverflow(overflow);
+      break;
+    }
+    case Encoding::FLOAT16_DELTA: {
+      // The difference is taken to the previously decoded value, such that the quantization error does not accumulate.
+      bool overflow = false;
+      vector_t previous = vector_t::Zero(array.empty() ? 0 : array.front().size());
+      scalar_t* previousValues = previous.data();
+      for (const auto& a : array) {
+        const scalar_t* values = a.data();
+        const size_t n = a.size();
+        uint8_t* dst = writer.advance(n * sizeof(uint16_t));
+        for (size_t i = 0; i < n; i++) {
+          const scalar_t delta = values[i] - previousValues[i];
+          const uint16_t bits = toHalf(static_cast<float>(delta));
+          overflow |= isHalfOverflow(bits, delta);
+          previousValues[i] += static_cast<scalar_t>(fromHalf(bits));
+          std::memcpy(dst + i * sizeof(uint16_t), &bits, sizeof(uint16_t));
+        }
+      }
+      checkHalfOverflow(overflow);
+      break;
+    }
+  }
+}
+
+template <typename Array>
+void readArray(Reader& reader, Encoding encoding, Array&& array) {
+  switch (encoding) {
+    case Encoding::FLOAT64:
+      for (auto& a : array) {
+        reader.read(a.data(), a.size());
+      }
+      break;
+    case Encoding::FLOAT32:
+      for (auto& a : array) {
+        scalar_t* values = a.data();
+        const size_t n = a.size();
+        const uint8_t* src = reader.advance(n * sizeof(float));
+        for (size_t i = 0; i < n; i++) {
+          float value;
+          std::memcpy(&value, src + i * sizeof(float), sizeof(float));
+          values[i] = static_cast<scalar_t>(value);
+        }
+      }
+      break;
+    case Encoding::FLOAT16:
+      for (auto& a : array) {
+        scalar_t* values = a.data();
+        const size_t n = a.size();
+        const uint8_t* src = reader.advance(n * sizeof(uint16_t));
+        for (size_t i = 0; i < n; i++) {
+          uint16_t bits;
+          std::memcpy(&bits, src + i * sizeof(uint16_t), sizeof(uint16_t));
+          values[i] = static_cast<scalar_t>(fromHalf(bits));
+        }
+      }
+      break;
+    case Encoding::FLOAT16_DELTA: {
+      const scalar_t* previousValues = nullptr;
+      for (auto& a : array) {
+        scalar_t* values = a.data();
+        const size_t n = a.size();
+        const uint8_t* src = reader.advance(n * sizeof(uint16_t));
+        for (size_t i = 0; i < n; i++) {
+          uint16_t bits;
+          std::memcpy(&bits, src + i * sizeof(uint16_t), sizeof(uint16_t));
+          const auto delta = static_cast<scalar_t>(fromHalf(bits));
+          values[i] = (previousValues != nullptr) ? previousValues[i] + delta : delta;
+        }
+        previousValues = values;
+      }
+      break;
+    }
+  }
+}
+
+void resizeArray(vector_array_t& array, size_t size, size_t dim) {
+  array.resize(size);
+  for (auto& v : array) {
+    v.resize(dim);
+  }
+}
+
+void resizeArray(matrix_array_t& array, size_t size, size_t rows, size_t cols) {
+  array.resize(size);
+  for (auto& m : array) {
+    m.resize(rows, cols);
+  }
+}
+
+/** Reads the header and checks everything but its payload size. */
+Header readHeaderFields(const uint8_t* data, size_t size, uint32_t magic, const std::string& caller) {
+  if (size < sizeof(Header)) {
+    throw std::runtime_error("[binary_policy::" + caller + "] The buffer is smaller than the header!");
+  }
+  Header header;
+  std::memcpy(&header, data, sizeof(Header));
+
+  if (header.magic != magic) {
+    throw std::runtime_error("[binary_policy::" + caller + "] The buffer is not a binary policy of the expected kind!");
+  }
+  if (header.version != VERSION) {
+    throw std::runtime_error("[binary_policy::" + caller + "] Unsupported version: " + std::to_string(header.version));
+  }
+  if (header.controllerType != static_cast<uint8_t>(ControllerType::FEEDFORWARD) &&
+      header.controllerType != static_cast<uint8_t>(ControllerType::LINEAR)) {
+    throw std::runtime_error("[binary_policy::" + caller + "] Unknown controllerType!");
+  }
+  bytesPerValue(static_cast<Encoding>(header.trajectoryEncoding));  // throws on an unknown encoding
+  bytesPerValue(static_cast<Encoding>(header.gainEncoding));
+  return header;
+}
+
+/** Whether a policy with the base header can be used to predict the nodes of a policy with the other header. */
+bool isCompatible(const Header& base, const Header& other) {
+  return base.controllerType == other.controllerType && base.trajectoryEncoding == other.trajectoryEncoding &&
+         base.gainEncoding == other.gainEncoding && base.stateDim == other.stateDim && base.inputDim == other.inputDim;
+}
+
+/** A view on the selected elements of an array. It is used to write and read only the transmitted nodes. */
+template <typename Array>
+class IndexedView {
+ public:
+  IndexedView(Array& array, const std::vector<uint32_t>& indices) : array_(array), indices_(indices) {}
+
+  class iterator {
+   public:
+    iterator(Array& array, const uint32_t* pos) : array_(&array), pos_(pos) {}
+    auto operator*() const -> decltype(std::declval<Array&>()[0]) { return (*array_)[*pos_]; }
+    iterator& operator++() {
+      ++pos_;
+      return *this;
+    }
+    bool operator!=(const iterator& other) const { return pos_ != other.pos_; }
+
+   private:
+    Array* array_;
+    const uint32_t* pos_;
+  };
+
+  iterator begin() const { return iterator(array_, indices_.data()); }
+  iterator end() const { return iterator(array_, indices_.data() + indices_.size()); }
+  bool empty() const { return indices_.empty(); }
+  auto front() const -> decltype(std::declval<Array&>()[0]) { return array_[indices_.front()]; }
+
+ private:
+  Array& array_;
+  const std::vector<uint32_t>& indices_;
+};
+
+template <typename Array>
+IndexedView<Array> makeView(Array& array, const std::vector<uint32_t>& indices) {
+  return IndexedView<Array>(array, indices);
+}
+
+/** The largest deviation of the value from the linear interpolation of the base data. */
+template <typename Data, typename Alloc>
+scalar_t predictionError(const LinearInterpolation::index_alpha_t& indexAlpha, const std::vector<Data, Alloc>& base, const Data& value) {
+  if (value.size() == 0) {
+    return 0.0;
+  } else if (base.size() == 1) {
+    return (base.front() - value).cwiseAbs().maxCoeff();
+  } else {
+    const auto i = indexAlpha.first;
+    const auto alpha = indexAlpha.second;
+    return (alpha * base[i] + (1.0 - alpha) * base[i + 1] - value).cwiseAbs().maxCoeff();
+  }
+}
+
+/** Linear interpolation of the base data, with zero order extrapolation. Same as LinearInterpolation but without allocation. */
+template <typename Data, typename Alloc>
+void predict(const LinearInterpolation::index_alpha_t& indexAlpha, const std::vector<Data, Alloc>& base, Data& value) {
+  if (base.size() == 1) {
+    value = base.front();
+  } else {
+    const auto i = indexAlpha.first;
+    const auto alpha = indexAlpha.second;
+    value.noalias() = alpha * base[i] + (1.0 - alpha) * base[i + 1];
+  }
+}
+
+/** Writes the performance indices, the observation, the target trajectories, the mode schedule, and the primal time trajectory. */
+void writeMetaSections(Writer& writer, const CommandData& commandData, const PrimalSolution& primalSolution,
+                       const PerformanceIndex& performanceIndices) {
+  // performance indices
+  const scalar_t indices[NUM_PERFORMANCE_INDICES] = {performanceIndices.merit,
+                                                     performanceIndices.cost,
+                                                     performanceIndices.dualFeasibilitiesSSE,
+                                                     performanceIndices.dynamicsViolationSSE,
+                                                     performanceIndices.equalityConstraintsSSE,
+                                                     performanceIndices.inequalityConstraintsSSE,
+                                                     performanceIndices.equalityLagrangian,
+                                                     performanceIndices.inequalityLagrangian};
+  writer.write(indices, NUM_PERFORMANCE_INDICES);
+
+  // observation
+  const auto& observation = commandData.mpcInitObservation_;
+  writer.writeValue(observation.time);
+  writer.write(observation.state.data(), observation.state.size());
+  writer.write(observation.input.data(), observation.input.size());
+
+  // target trajectories
+  const auto& targetTrajectories = commandData.mpcTargetTrajectories_;
+  writer.write(targetTrajectories.timeTrajectory.data(), targetTrajectories.timeTrajectory.size());
+  writeArray(writer, Encoding::FLOAT64, targetTrajectories.stateTrajectory);
+  writeArray(writer, Encoding::FLOAT64, targetTrajectories.inputTrajectory);
+
+  // mode schedule
+  const auto& modeSchedule = primalSolution.modeSchedule_;
+  writer.write(modeSchedule.eventTimes.data(), modeSchedule.eventTimes.size());
+  for (const auto mode : modeSchedule.modeSequence) {
+    writer.writeValue(static_cast<uint32_t>(mode));
+  }
+
+  // primal time trajectory
+  writer.write(primalSolution.timeTrajectory_.data(), primalSolution.timeTrajectory_.size());
+  for (const auto index : primalSolution.postEventIndices_) {
+    writer.writeValue(static_cast<uint32_t>(index));
+  }
+}
+
+/** Reads the sections of writeMetaSections. */
+void readMetaSections(Reader& reader, const Header& header, CommandData& commandData, PrimalSolution& primalSolution,
+                      PerformanceIndex& performanceIndices) {
+  // performance indices
+  scalar_t indices[NUM_PERFORMANCE_INDICES];
+  reader.read(indices, NUM_PERFORMANCE_INDICES);
+  performanceIndices.merit = indices[0];
+  performanceIndices.cost = indices[1];
+  performanceIndices.dualFeasibilitiesSSE = indices[2];
+  performanceIndices.dynamicsViolationSSE = indices[3];
+  performanceIndices.equalityConstraintsSSE = indices[4];
+  performanceIndices.inequalityConstraintsSSE = indices[5];
+  performanceIndices.equalityLagrangian = indices[6];
+  performanceIndices.inequalityLagrangian = indices[7];
+
+  // observation
+  auto& observation = commandData.mpcInitObservation_;
+  observation.mode = header.observationMode;
+  observation.time = reader.readValue<scalar_t>();
+  observation.state.resize(header.observationStateDim);
+  reader.read(observation.state.data(), observation.state.size());
+  observation.input.resize(header.observationInputDim);
+  reader.read(observation.input.data(), observation.input.size());
+
+  // target trajectories
+  auto& targetTrajectories = commandData.mpcTargetTrajectories_;
+  targetTrajectories.timeTrajectory.resize(header.numTargetNodes);
+  reader.read(targetTrajectories.timeTrajectory.data(), targetTrajectories.timeTrajectory.size());
+  resizeArray(targetTrajectories.stateTrajectory, header.numTargetStates, header.targetStateDim);
+  readArray(reader, Encoding::FLOAT64, targetTrajectories.stateTrajectory);
+  resizeArray(targetTrajectories.inputTrajectory, header.numTargetInputs, header.targetInputDim);
+  readArray(reader, Encoding::FLOAT64, targetTrajectories.inputTrajectory);
+
+  // mode schedule
+  auto& modeSchedule = primalSolution.modeSchedule_;
+  modeSchedule.eventTimes.resize(header.numModes > 0 ? header.numModes - 1 : 0);
+  reader.read(modeSchedule.eventTimes.data(), modeSchedule.eventTimes.size());
+  modeSchedule.modeSequence.resize(header.numModes);
+  for (auto& mode : modeSchedule.modeSequence) {
+    mode = reader.readValue<uint32_t>();
+  }
+
+  // primal time trajectory
+  primalSolution.timeTrajectory_.resize(header.numNodes);
+  reader.read(primalSolution.timeTrajectory_.data(), primalSolution.timeTrajectory_.size());
+  primalSolution.postEventIndices_.resize(header.numPostEventIndices);
+  for (auto& index : primalSolution.postEventIndices_) {
+    index = reader.readValue<uint32_t>();
+  }
+}
+
+/** Reads the indices of the transmitted nodes, or fills all the indices if every node is transmitted. */
+void readNodeIndices(Reader& reader, uint32_t numChanged, uint32_t numNodes, std::vector<uint32_t>& indices) {
+  indices.resize(numChanged);
+  if (numChanged == numNodes) {
+    std::iota(indices.begin(), indices.end(), 0);
+    return;
+  }
+  reader.read(indices.data(), indices.size());
+  for (size_t i = 0; i < indices.size(); i++) {
+    if (indices[i] >= numNodes || (i > 0 && indices[i] <= indices[i - 1])) {
+      throw std::runtime_error("[binary_policy::DeltaDecoder] Invalid node indices!");
+    }
+  }
+}
+
+/** Calls the function with the interpolation coefficients of each node which is not in the sorted indices. */
+template <typename Function>
+void forEachSkippedNode(const scalar_array_t& time, const scalar_array_t& baseTime, const std::vector<uint32_t>& indices,
+                        Function function) {
+  auto indexIt = indices.cbegin();
+  LinearInterpolation::Cursor cursor;
+  for (size_t k = 0; k < time.size(); k++) {
+    if (indexIt != indices.cend() && *indexIt == k) {
+      ++indexIt;
+    } else if (baseTime.empty()) {
+      throw std::runtime_error("[binary_policy::DeltaDecoder] The previous policy has no nodes to predict from!");
+    } else {
+      function(k, LinearInterpolation::timeSegment(time[k], baseTime, cursor));
+    }
+  }
+}
+
+/** Copies the policy and reuses the memory of the destination. */
+void copyPolicy(const PrimalSolution& source, uint8_t controllerType, PrimalSolution& destination) {
+  destination.timeTrajectory_ = source.timeTrajectory_;
+  destination.stateTrajectory_ = source.stateTrajectory_;
+  destination.inputTrajectory_ = source.inputTrajectory_;
+  destination.postEventIndices_ = source.postEventIndices_;
+  destination.modeSchedule_ = source.modeSchedule_;
+
+  const auto sourceController = getControllerData(*source.controllerPtr_);
+  const auto destinationController = getOrCreateController(destination, controllerType);
+  *destinationController.time = *sourceController.time;
+  *destinationController.inputs = *sourceController.inputs;
+  if (sourceController.gains != nullptr) {
+    *destinationController.gains = *sourceController.gains;
+  }
+}
+
+}  // unnamed namespace
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+uint16_t floatToHalf(float value) {
+  return toHalf(value);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+float halfToFloat(uint16_t bits) {
+  return fromHalf(bits);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+size_t encodedSize(const CommandData& commandData, const PrimalSolution& primalSolution, const Settings& settings) {
+  return sizeof(Header) + makeHeader(commandData, primalSolution, settings).payloadSize;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+size_t encode(const CommandData& commandData, const PrimalSolution& primalSolution, const PerformanceIndex& performanceIndices,
+              const Settings& settings, uint8_t* data, size_t capacity) {
+  const Header header = makeHeader(commandData, primalSolution, settings);
+  const size_t size = sizeof(Header) + header.payloadSize;
+  if (size > capacity) {
+    throw std::runtime_error("[binary_policy::encode] The policy needs " + std::to_string(size) + " bytes but the buffer has only " +
+                             std::to_string(capacity) + " bytes!");
+  }
+
+  Writer writer(data);
+  writer.writeValue(header);
+  writeMetaSections(writer, commandData, primalSolution, performanceIndices);
+
+  // primal trajectories
+  writeArray(writer, settings.trajectoryEncoding, primalSolution.stateTrajectory_);
+  writeArray(writer, settings.trajectoryEncoding, primalSolution.inputTrajectory_);
+
+  // controller
+  const auto controllerData = getControllerData(*primalSolution.controllerPtr_);
+  writer.write(controllerData.time->data(), controllerData.time->size());
+  writeArray(writer, settings.trajectoryEncoding, *controllerData.inputs);
+  if (controllerData.gains != nullptr) {
+    writeArray(writer, settings.gainEncoding, *controllerData.gains);
+  }
+
+  assert(writer.position() == data + size);
+  return size;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void encode(const CommandData& commandData, const PrimalSolution& primalSolution, const PerformanceIndex& performanceIndices,
+            const Settings& settings, std::vector<uint8_t>& buffer) {
+  buffer.resize(encodedSize(commandData, primalSolution, settings));
+  encode(commandData, primalSolution, performanceIndices, settings, buffer.data(), buffer.size());
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+Header readHeader(const uint8_t* data, size_t size) {
+  const Header header = readHeaderFields(data, size, MAGIC, "readHeader");
+  if (header.payloadSize != computePayloadSize(header) || size - sizeof(Header) != header.payloadSize) {
+    throw std::runtime_error("[binary_policy::readHeader] The buffer size does not match the header!");
+  }
+  return header;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void decode(const uint8_t* data, size_t size, CommandData& commandData, PrimalSolution& primalSolution,
+            PerformanceIndex& performanceIndices) {
+  const Header header = readHeader(data, size);
+  const auto trajectoryEncoding = static_cast<Encoding>(header.trajectoryEncoding);
+  const auto gainEncoding = static_cast<Encoding>(header.gainEncoding);
+  Reader reader(data + sizeof(Header), header.payloadSize);
+  readMetaSections(reader, header, commandData, primalSolution, performanceIndices);
+
+  // primal trajectories
+  resizeArray(primalSolution.stateTrajectory_, header.numNodes, header.stateDim);
+  readArray(reader, trajectoryEncoding, primalSolution.stateTrajectory_);
+  resizeArray(primalSolution.inputTrajectory_, header.numNodes, header.inputDim);
+  readArray(reader, trajectoryEncoding, primalSolution.inputTrajectory_);
+
+  // controller
+  const auto controllerData = getOrCreateController(primalSolution, header.controllerType);
+  controllerData.time->resize(header.numControllerNodes);
+  reader.read(controllerData.time->data(), controllerData.time->size());
+  resizeArray(*controllerData.inputs, header.numControllerNodes, header.inputDim);
+  readArray(reader, trajectoryEncoding, *controllerData.inputs);
+  if (controllerData.gains != nullptr) {
+    resizeArray(*controllerData.gains, header.numControllerNodes, header.inputDim, header.stateDim);
+    readArray(reader, gainEncoding, *controllerData.gains);
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+bool isDelta(const uint8_t* data, size_t size) {
+  uint32_t magic = 0;
+  if (size >= sizeof(magic)) {
+    std::memcpy(&magic, data, sizeof(magic));
+  }
+  return magic == DELTA_MAGIC;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+bool DeltaDecoder::decode(const uint8_t* data, size_t size, CommandData& commandData, PrimalSolution& primalSolution,
+                          PerformanceIndex& performanceIndices) {
+  const Header header = readHeaderFields(data, size, DELTA_MAGIC, "DeltaDecoder");
+  if (size < sizeof(Header) + sizeof(DeltaHeader)) {
+    throw std::runtime_error("[binary_policy::DeltaDecoder] The buffer is truncated!");
+  }
+  DeltaHeader deltaHeader;
+  std::memcpy(&deltaHeader, data + sizeof(Header), sizeof(DeltaHeader));
+  if (deltaHeader.numChangedNodes > header.numNodes || deltaHeader.numChangedControllerNodes > header.numControllerNodes ||
+      header.payloadSize != computeDeltaPayloadSize(header, deltaHeader) || size - sizeof(Header) != header.payloadSize) {
+    throw std::runtime_error("[binary_policy::DeltaDecoder] The buffer size does not match the header!");
+  }
+
+  const bool isKeyFrame = deltaHeader.baseSequence == 0;
+  if (isKeyFrame) {
+    if (deltaHeader.numChangedNodes != header.numNodes || deltaHeader.numChangedControllerNodes != header.numControllerNodes) {
+      throw std::runtime_error("[binary_policy::DeltaDecoder] A key frame must contain all the nodes!");
+    }
+  } else if (basePtr_ == nullptr || deltaHeader.baseSequence != baseDeltaHeader_.sequence ||
+             deltaHeader.streamId != baseDeltaHeader_.streamId || deltaHeader.sequence <= lastSequence_ ||
+             !isCompatible(baseHeader_, header)) {
+    return false;
+  }
+
+  const auto trajectoryEncoding = static_cast<Encoding>(header.trajectoryEncoding);
+  const auto gainEncoding = static_cast<Encoding>(header.gainEncoding);
+  Reader reader(data + sizeof(Header) + sizeof(DeltaHeader), header.payloadSize - sizeof(DeltaHeader));
+  readMetaSections(reader, header, commandData, primalSolution, performanceIndices);
+
+  // primal trajectories
+  readNodeIndices(reader, deltaHeader.numChangedNodes, header.numNodes, changedNodes_);
+  resizeArray(primalSolution.stateTrajectory_, header.numNodes, header.stateDim);
+  resizeArray(primalSolution.inputTrajectory_, header.numNodes, header.inputDim);
+  if (!isKeyFrame) {
+    const auto& base = *basePtr_;
+    forEachSkippedNode(primalSolution.timeTrajectory_, base.timeTrajectory_, changedNodes_,
+                       [&](size_t k, const LinearInterpolation::index_alpha_t& indexAlpha) {
+                         predict(indexAlpha, base.stateTrajectory_, primalSolution.stateTrajectory_[k]);
+                         predict(indexAlpha, base.inputTrajectory_, primalSolution.inputTrajectory_[k]);
+                       });
+  }
+  readArray(reader, trajectoryEncoding, makeView(primalSolution.stateTrajectory_, changedNodes_));
+  readArray(reader, trajectoryEncoding, makeView(primalSolution.inputTrajectory_, changedNodes_));
+
+  // controller
+  const auto controllerData = getOrCreateController(primalSolution, header.controllerType);
+  controllerData.time->resize(header.numControllerNodes);
+  reader.read(controllerData.time->data(), controllerData.time->size());
+  readNodeIndices(reader, deltaHeader.numChangedControllerNodes, header.numControllerNodes, changedControllerNodes_);
+  resizeArray(*controllerData.inputs, header.numControllerNodes, header.inputDim);
+  if (controllerData.gains != nullptr) {
+    resizeArray(*controllerData.gains, header.numControllerNodes, header.inputDim, header.stateDim);
+  }
+  if (!isKeyFrame) {
+    const auto baseController = getControllerData(*basePtr_->controllerPtr_);
+    forEachSkippedNode(*controllerData.time, *baseController.time, changedControllerNodes_,
+                       [&](size_t k, const LinearInterpolation::index_alpha_t& indexAlpha) {
+                         predict(indexAlpha, *baseController.inputs, (*controllerData.inputs)[k]);
+                         if (controllerData.gains != nullptr) {
+                           predict(indexAlpha, *baseController.gains, (*controllerData.gains)[k]);
+                         }
+                       });
+  }
+  readArray(reader, trajectoryEncoding, makeView(*controllerData.inputs, changedControllerNodes_));
+  if (controllerData.gains != nullptr) {
+    readArray(reader, gainEncoding, makeView(*controllerData.gains, changedControllerNodes_));
+  }
+
+  // a key frame is the base of the next updates
+  if (isKeyFrame) {
+    if (basePtr_ == nullptr) {
+      basePtr_.reset(new PrimalSolution);
+    }
+    copyPolicy(primalSolution, header.controllerType, *basePtr_);
+    baseHeader_ = header;
+    baseDeltaHeader_ = deltaHeader;
+  }
+  lastSequence_ = deltaHeader.sequence;
+  return true;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void DeltaDecoder::reset() {
+  basePtr_.reset();
+  lastSequence_ = 0;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+DeltaEncoder::DeltaEncoder(Settings settings, DeltaSettings deltaSettings)
+    : settings_(settings), deltaSettings_(deltaSettings), streamId_(std::random_device()()) {}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+bool DeltaEncoder::encode(const CommandData& commandData, const PrimalSolution& primalSolution,
+                          const PerformanceIndex& performanceIndices, std::vector<uint8_t>& buffer) {
+  Header header = makeHeader(commandData, primalSolution, settings_);
+  header.magic = DELTA_MAGIC;
+  const auto controllerData = getControllerData(*primalSolution.controllerPtr_);
+  const auto* basePtr = mirror_.getKeyFrame();
+
+  DeltaHeader deltaHeader;
+  std::memset(&deltaHeader, 0, sizeof(DeltaHeader));
+  deltaHeader.streamId = streamId_;
+
+  bool isKeyFrame = keyFrameRequested_.exchange(false) || basePtr == nullptr ||
+                    numUpdatesSinceKeyFrame_ >= deltaSettings_.keyFrameInterval || !isCompatible(baseHeader_, header);
+  if (!isKeyFrame) {
+    // The nodes which deviate from the prediction. The search stops as soon as the update exceeds the size limit.
+    const auto& base = *basePtr;
+    const auto baseController = getControllerData(*base.controllerPtr_);
+    const auto sizeLimit = static_cast<uint64_t>(deltaSettings_.maxSizeRatio * (sizeof(DeltaHeader) + computePayloadSize(header)));
+    const auto nodeSize = nodePayloadSize(header, 1, 0) + sizeof(uint32_t);
+    const auto controllerNodeSize = nodePayloadSize(header, 0, 1) + sizeof(uint32_t);
+    uint64_t deltaSize = sizeof(DeltaHeader) + metaPayloadSize(header);
+
+    changedControllerNodes_.clear();
+    LinearInterpolation::Cursor controllerCursor;
+    for (size_t k = 0; k < controllerData.time->size() && deltaSize <= sizeLimit; k++) {
+      const auto indexAlpha = LinearInterpolation::timeSegment((*controllerData.time)[k], *baseController.time, controllerCursor);
+      if (baseController.time->empty() ||
+          predictionError(indexAlpha, *baseController.inputs, (*controllerData.inputs)[k]) > deltaSettings_.trajectoryTolerance ||
+          (controllerData.gains != nullptr &&
+           predictionError(indexAlpha, *baseController.gains, (*controllerData.gains)[k]) > deltaSettings_.gainTolerance)) {
+        changedControllerNodes_.push_back(k);
+        deltaSize += controllerNodeSize;
+      }
+    }
+
+    changedNodes_.clear();
+    LinearInterpolation::Cursor cursor;
+    for (size_t k = 0; k < primalSolution.timeTrajectory_.size() && deltaSize <= sizeLimit; k++) {
+      const auto indexAlpha = LinearInterpolation::timeSegment(primalSolution.timeTrajectory_[k], base.timeTrajectory_, cursor);
+      if (base.timeTrajectory_.empty() ||
+          predictionError(indexAlpha, base.stateTrajectory_, primalSolution.stateTrajectory_[k]) > deltaSettings_.trajectoryTolerance ||
+          predictionError(indexAlpha, base.inputTrajectory_, primalSolution.inputTrajectory_[k]) > deltaSettings_.trajectoryTolerance) {
+        changedNodes_.push_back(k);
+        deltaSize += nodeSize;
+      }
+    }
+
+    deltaHeader.numChangedNodes = changedNodes_.size();
+    deltaHeader.numChangedControllerNodes = changedControllerNodes_.size();
+    isKeyFrame = deltaSize > sizeLimit;
+  }
+
+  if (isKeyFrame) {
+    changedNodes_.resize(primalSolution.timeTrajectory_.size());
+    std::iota(changedNodes_.begin(), changedNodes_.end(), 0);
+    changedControllerNodes_.resize(controllerData.time->size());
+    std::iota(changedControllerNodes_.begin(), changedControllerNodes_.end(), 0);
+    deltaHeader.numChangedNodes = header.numNodes;
+    deltaHeader.numChangedControllerNodes = header.numControllerNodes;
+  }
+  deltaHeader.sequence = ++sequence_;
+  deltaHeader.baseSequence = isKeyFrame ? 0 : keyFrameSequence_;
+  header.payloadSize = computeDeltaPayloadSize(header, deltaHeader);
+  buffer.resize(sizeof(Header) + header.payloadSize);
+
+  Writer writer(buffer.data());
+  writer.writeValue(header);
+  writer.writeValue(deltaHeader);
+  writeMetaSections(writer, commandData, primalSolution, performanceIndices);
+
+  // primal trajectories
+  if (deltaHeader.numChangedNodes < header.numNodes) {
+    writer.write(changedNodes_.data(), changedNodes_.size());
+  }
+  writeArray(writer, settings_.trajectoryEncoding, makeView(primalSolution.stateTrajectory_, changedNodes_));
+  writeArray(writer, settings_.trajectoryEncoding, makeView(primalSolution.inputTrajectory_, changedNodes_));
+
+  // controller
+  writer.write(controllerData.time->data(), controllerData.time->size());
+  if (deltaHeader.numChangedControllerNodes < header.numControllerNodes) {
+    writer.write(changedControllerNodes_.data(), changedControllerNodes_.size());
+  }
+  writeArray(writer, settings_.trajectoryEncoding, makeView(*controllerData.inputs, changedControllerNodes_));
+  if (controllerData.gains != nullptr) {
+    writeArray(writer, settings_.gainEncoding, makeView(*controllerData.gains, changedControllerNodes_));
+  }
+  assert(writer.position() == buffer.data() + buffer.size());
+
+  // decode the key frame to predict the next policies with the same data as the receiver
+  if (isKeyFrame) {
+    mirror_.decode(buffer.data(), buffer.size(), mirrorCommandData_, mirrorPrimalSolution_, mirrorPerformanceIndices_);
+    baseHeader_ = header;
+    keyFrameSequence_ = deltaHeader.sequence;
+  }
+  numUpdatesSinceKeyFrame_ = isKeyFrame ? 0 : numUpdatesSinceKeyFrame_ + 1;
+  return isKeyFrame;
+}
+
+}  // namespace binary_policy
+}  // namespace ocs2
@@ -71,9 +71,35 @@ bool MPC_BASE::run(scalar_t currentTime, const vector_t& currentState) {
     mpcTimer_.startTimer();
   }
 
+  // the initial guess of a warm start
+  if (recorderPtr_ != nullptr) {
+    recordedInstance_.warmStart = !initRun_ && !mpcSettings_.coldStart_;
+    if (recordedInstance_.warmStart) {
+      getSolverPtr()->getPrimalSolution(getSolverPtr()->getFinalTime(), &recordedInstance_.initialGuess);
+    }
+    // the solvers count the iterations since their last reset, which is done by calculateController() on a cold start
+    recordedInitIteration_ = mpcSettings_.coldStart_ ? 0 : getSolverPtr()->getNumIterations();
+    recordTimer_.startTimer();
+  }
+
   // calculate the MPC policy
   calculateController(currentTime, currentState, finalTime);
 
+  // the references are active until the next run
+  if (recorderPtr_ != nullptr) {
+    recordTimer_.endTimer();
+    const auto* solverPtr = getSolverPtr();
+    recordedInstance_.initTime = currentTime;
+    recordedInstance_.finalTime = finalTime;
+    recordedInstance_.initState = currentState;
+    recordedInstance_.targetTrajectories = solverPtr->getReferenceManager().getTargetTrajectories();
+    recordedInstance_.modeSchedule = solverPtr->getReferenceManager().getModeSchedule();
+    recordedInstance_.recordedStatistics.solveTimeInMilliseconds = recordTimer_.getLastIntervalInMilliseconds();
+    recordedInstance_.recordedStatistics.numIterations = solverPtr->getNumIterations() - recordedInitIteration_;
+    recordedInstance_.recordedStatistics.performanceIndex = solverPtr->getPerformanceIndeces();
+    recorderPtr_->write(recordedInstance_);
+  }
+
   // set initRun flag to false
   initRun_ = false;
 
@@ -44,6 +44,11 @@ MRT_BASE::MRT_BASE() {
 /******************************************************************************************************/
 /******************************************************************************************************/
 void MRT_BASE::reset() {
+  {
+    std::lock_guard<std::mutex> lock(policyDeltaMutex_);
+    policyDeltaDecoder_.reset();
+  }
+
   std::lock_guard<std::mutex> lock(bufferMutex_);
 
   policyReceivedEver_ = false;
@@ -209,6 +214,24 @@ void MRT_BASE::moveToBuffer(std::unique_ptr<CommandData> commandDataPtr, std::un
   policyReceivedEver_ = true;
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+bool MRT_BASE::moveDeltaToBuffer(const uint8_t* data, size_t size) {
+  auto commandDataPtr = std::make_unique<CommandData>();
+  auto primalSolutionPtr = std::make_unique<PrimalSolution>();
+  auto performanceIndicesPtr = std::make_unique<PerformanceIndex>();
+  {
+    std::lock_guard<std::mutex> lock(policyDeltaMutex_);
+    if (!policyDeltaDecoder_.decode(data, size, *commandDataPtr, *primalSolutionPtr, *performanceIndicesPtr)) {
+      return false;
+    }
+  }
+
+  moveToBuffer(std::move(commandDataPtr), std::move(primalSolutionPtr), std::move(performanceIndicesPtr));
+  return true;
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -0,0 +1,229 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_mpc/MpcRecord.h"
+
+#include <cstring>
+#include <iomanip>
+#include <stdexcept>
+
+#include <ocs2_core/control/FeedforwardController.h>
+#include <ocs2_core/misc/Benchmark.h>
+
+#include "ocs2_mpc/BinaryPolicy.h"
+#include "ocs2_mpc/CommandData.h"
+
+namespace ocs2 {
+namespace mpc_record {
+
+namespace {
+
+/** Magic number at the start of every record: "OCSI" */
+constexpr uint32_t MAGIC = 0x4953434F;
+
+/** Version of the format. */
+constexpr uint16_t VERSION = 1;
+
+/** Fixed-size header at the start of every record. */
+struct RecordHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint8_t warmStart;
+  uint8_t reserved;
+  uint32_t numModes;  // size of ModeSchedule::modeSequence
+  uint32_t numIterations;
+  scalar_t finalTime;
+  scalar_t solveTimeInMilliseconds;
+  uint64_t policySize;  // size of the binary_policy buffer
+};
+
+static_assert(sizeof(RecordHeader) == 40, "mpc_record::RecordHeader must not contain padding.");
+
+/** The initial guess of a cold start, since binary_policy requires a controller. */
+PrimalSolution emptyPrimalSolution() {
+  PrimalSolution primalSolution;
+  primalSolution.controllerPtr_.reset(new FeedforwardController);
+  return primalSolution;
+}
+
+template <typename T>
+void writeValues(std::ofstream& file, const T* data, size_t size) {
+  file.write(reinterpret_cast<const char*>(data), size * sizeof(T));
+}
+
+template <typename T>
+void readValues(std::ifstream& file, T* data, size_t size) {
+  if (!file.read(reinterpret_cast<char*>(data), size * sizeof(T))) {
+    throw std::runtime_error("[mpc_record::load] The file is truncated!");
+  }
+}
+
+}  // unnamed namespace
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+Recorder::Recorder(const std::string& filePath) : file_(filePath, std::ios::binary | std::ios::trunc) {
+  if (!file_) {
+    throw std::runtime_error("[mpc_record::Recorder] Cannot open the file " + filePath);
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void Recorder::write(const Instance& instance) {
+  static const PrimalSolution coldStart = emptyPrimalSolution();
+
+  CommandData commandData;
+  commandData.mpcInitObservation_.time = instance.initTime;
+  commandData.mpcInitObservation_.state = instance.initState;
+  commandData.mpcTargetTrajectories_ = instance.targetTrajectories;
+  binary_policy::Settings settings;
+  settings.trajectoryEncoding = binary_policy::Encoding::FLOAT64;
+  settings.gainEncoding = binary_policy::Encoding::FLOAT64;
+  binary_policy::encode(commandData, instance.warmStart ? instance.initialGuess : coldStart,
+                        instance.recordedStatistics.performanceIndex, settings, policyBuffer_);
+
+  const auto& modeSchedule = instance.modeSchedule;
+  if (modeSchedule.modeSequence.size() != modeSchedule.eventTimes.size() + 1) {
+    throw std::runtime_error("[mpc_record::Recorder] The mode schedule must have one mode more than event times!");
+  }
+  std::vector<uint32_t> modeSequence(modeSchedule.modeSequence.begin(), modeSchedule.modeSequence.end());
+
+  RecordHeader header;
+  std::memset(&header, 0, sizeof(RecordHeader));
+  header.magic = MAGIC;
+  header.version = VERSION;
+  header.warmStart = instance.warmStart ? 1 : 0;
+  header.numModes = modeSequence.size();
+  header.numIterations = instance.recordedStatistics.numIterations;
+  header.finalTime = instance.finalTime;
+  header.solveTimeInMilliseconds = instance.recordedStatistics.solveTimeInMilliseconds;
+  header.policySize = policyBuffer_.size();
+
+  writeValues(file_, &header, 1);
+  writeValues(file_, modeSchedule.eventTimes.data(), modeSchedule.eventTimes.size());
+  writeValues(file_, modeSequence.data(), modeSequence.size());
+  writeValues(file_, policyBuffer_.data(), policyBuffer_.size());
+  if (!file_) {
+    throw std::runtime_error("[mpc_record::Recorder] Writing to the file failed!");
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+std::vector<Instance> load(const std::string& filePath) {
+  std::ifstream file(filePath, std::ios::binary);
+  if (!file) {
+    throw std::runtime_error("[mpc_record::load] Cannot open the file " + filePath);
+  }
+
+  std::vector<Instance> instances;
+  std::vector<uint8_t> policyBuffer;
+  std::vector<uint32_t> modeSequence;
+  CommandData commandData;
+  while (file.peek() != std::ifstream::traits_type::eof()) {
+    RecordHeader header;
+    readValues(file, &header, 1);
+    if (header.magic != MAGIC || header.version != VERSION) {
+      throw std::runtime_error("[mpc_record::load] The file is not a record of this version!");
+    } else if (header.numModes == 0) {
+      throw std::runtime_error("[mpc_record::load] The mode schedule is empty!");
+    }
+
+    Instance instance;
+    instance.finalTime = header.finalTime;
+    instance.warmStart = header.warmStart != 0;
+    instance.recordedStatistics.numIterations = header.numIterations;
+    instance.recordedStatistics.solveTimeInMilliseconds = header.solveTimeInMilliseconds;
+
+    auto& modeSchedule = instance.modeSchedule;
+    modeSchedule.eventTimes.resize(header.numModes - 1);
+    readValues(file, modeSchedule.eventTimes.data(), modeSchedule.eventTimes.size());
+    modeSequence.resize(header.numModes);
+    readValues(file, modeSequence.data(), modeSequence.size());
+    modeSchedule.modeSequence.assign(modeSequence.begin(), modeSequence.end());
+
+    policyBuffer.resize(header.policySize);
+    readValues(file, policyBuffer.data(), policyBuffer.size());
+    binary_policy::decode(policyBuffer, commandData, instance.initialGuess, instance.recordedStatistics.performanceIndex);
+    instance.initTime = commandData.mpcInitObservation_.time;
+    instance.initState = std::move(commandData.mpcInitObservation_.state);
+    instance.targetTrajectories = std::move(commandData.mpcTargetTrajectories_);
+    if (!instance.warmStart) {
+      instance.initialGuess.clear();
+    }
+
+    instances.push_back(std::move(instance));
+  }
+  return instances;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+std::vector<SolveStatistics> replay(SolverBase& solver, const std::vector<Instance>& instances) {
+  std::vector<SolveStatistics> statistics;
+  statistics.reserve(instances.size());
+  benchmark::RepeatedTimer timer;
+  for (const auto& instance : instances) {
+    solver.reset();
+    solver.getReferenceManager().setTargetTrajectories(instance.targetTrajectories);
+    solver.getReferenceManager().setModeSchedule(instance.modeSchedule);
+
+    timer.startTimer();
+    if (instance.warmStart) {
+      solver.run(instance.initTime, instance.initState, instance.finalTime, instance.initialGuess);
+    } else {
+      solver.run(instance.initTime, instance.initState, instance.finalTime);
+    }
+    timer.endTimer();
+
+    statistics.emplace_back();
+    statistics.back().solveTimeInMilliseconds = timer.getLastIntervalInMilliseconds();
+    statistics.back().numIterations = solver.getNumIterations();
+    statistics.back().performanceIndex = solver.getPerformanceIndeces();
+  }
+  return statistics;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+std::ostream& operator<<(std::ostream& stream, const SolveStatistics& statistics) {
+  stream << "solve time: " << std::setw(10) << statistics.solveTimeInMilliseconds << " [ms]"
+         << ", iterations: " << std::setw(3) << statistics.numIterations << ", merit: " << statistics.performanceIndex.merit
+         << ", dynamics violation SSE: " << statistics.performanceIndex.dynamicsViolationSSE;
+  return stream;
+}
+
+}  // namespace mpc_record
+}  // namespace ocs2
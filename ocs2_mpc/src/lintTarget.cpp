@@ -1,11 +1,18 @@
 #include <ocs2_mpc/MPC_BASE.h>
 #include <ocs2_mpc/MPC_MRT_Interface.h>
 #include <ocs2_mpc/MPC_Settings.h>
+#include <ocs2_mpc/MpcRecord.h>
 #include <ocs2_mpc/MRT_BASE.h>
 
+#include <ocs2_mpc/BinaryPolicy.h>
 #include <ocs2_mpc/CommandData.h>
 #include <ocs2_mpc/SystemObservation.h>
 
+#include <ocs2_mpc/shared_memory/MPC_SharedMemoryInterface.h>
+#include <ocs2_mpc/shared_memory/MRT_SharedMemoryInterface.h>
+#include <ocs2_mpc/shared_memory/SharedMemoryChannel.h>
+#include <ocs2_mpc/shared_memory/SharedMemoryMessages.h>
+
 // dummy target for clang toolchain
 int main() {
   return 0;
@@ -0,0 +1,183 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_mpc/shared_memory/MPC_SharedMemoryInterface.h"
+
+#include <iostream>
+
+#include "ocs2_mpc/shared_memory/SharedMemoryMessages.h"
+
+namespace ocs2 {
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+MPC_SharedMemoryInterface::MPC_SharedMemoryInterface(MPC_BASE& mpc, const std::string& topicPrefix, shared_memory::Settings settings)
+    : mpc_(mpc),
+      settings_(std::move(settings)),
+      policyChannel_(shared_memory::policyChannelName(topicPrefix), settings_.policyCapacity, settings_.numSlots),
+      observationChannel_(shared_memory::observationChannelName(topicPrefix), settings_.observationCapacity, settings_.numSlots),
+      resetChannel_(shared_memory::resetChannelName(topicPrefix), settings_.observationCapacity, settings_.numSlots) {}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MPC_SharedMemoryInterface::resetMpcNode(TargetTrajectories&& initTargetTrajectories) {
+  mpc_.reset();
+  mpc_.getSolverPtr()->getReferenceManager().setTargetTrajectories(std::move(initTargetTrajectories));
+  mpcTimer_.reset();
+  resetRequestedEver_ = true;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+bool MPC_SharedMemoryInterface::spinOnce(std::chrono::microseconds timeout) {
+  if (handleResetRequest()) {
+    return true;
+  }
+  if (!observationChannel_.waitForMessage(lastObservationSequence_, timeout)) {
+    return handleResetRequest();
+  }
+
+  auto messageType = shared_memory::MessageType::UNKNOWN;
+  const bool isNew = observationChannel_.read(lastObservationSequence_, [&](const uint8_t* data, size_t size) {
+    messageType = shared_memory::readMessageType(data, size);
+    if (messageType == shared_memory::MessageType::OBSERVATION) {
+      shared_memory::readObservationMessage(data, size, observation_);
+    }
+  });
+  if (!isNew) {
+    return true;
+  }
+
+  if (messageType == shared_memory::MessageType::OBSERVATION) {
+    mpcObservationCallback(observation_);
+  } else {
+    std::cerr << "[MPC_SharedMemoryInterface::spinOnce] Received a message of unknown type on the observation channel!\n";
+  }
+
+  return true;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+bool MPC_SharedMemoryInterface::handleResetRequest() {
+  auto messageType = shared_memory::MessageType::UNKNOWN;
+  const bool isNew = resetChannel_.read(lastResetSequence_, [&](const uint8_t* data, size_t size) {
+    messageType = shared_memory::readMessageType(data, size);
+    if (messageType == shared_memory::MessageType::RESET) {
+      shared_memory::readResetMessage(data, size, targetTrajectories_);
+    }
+  });
+  if (!isNew) {
+    return false;
+  }
+
+  if (messageType == shared_memory::MessageType::RESET) {
+    resetMpcNode(std::move(targetTrajectories_));
+    std::cerr << "\n#####################################################"
+              << "\n#####################################################"
+              << "\n#################  MPC is reset.  ###################"
+              << "\n#####################################################"
+              << "\n#####################################################\n";
+    resetChannel_.acknowledge(lastResetSequence_);
+  } else {
+    std::cerr << "[MPC_SharedMemoryInterface::spinOnce] Received a message of unknown type on the reset channel!\n";
+  }
+  return true;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MPC_SharedMemoryInterface::spin() {
+  terminate_ = false;
+  while (!terminate_) {
+    spinOnce(std::chrono::milliseconds(100));
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MPC_SharedMemoryInterface::mpcObservationCallback(const SystemObservation& currentObservation) {
+  if (!resetRequestedEver_) {
+    std::cerr << "[MPC_SharedMemoryInterface] MPC should be reset first. Either call resetMpcNode() or request a reset from the MRT.\n";
+    return;
+  }
+
+  // measure the delay in running MPC
+  mpcTimer_.startTimer();
+
+  // run MPC
+  bool controllerIsUpdated = mpc_.run(currentObservation.time, currentObservation.state);
+  if (!controllerIsUpdated) {
+    return;
+  }
+
+  // get solution
+  scalar_t finalTime = currentObservation.time + mpc_.settings().solutionTimeWindow_;
+  if (mpc_.settings().solutionTimeWindow_ < 0) {
+    finalTime = mpc_.getSolverPtr()->getFinalTime();
+  }
+  mpc_.getSolverPtr()->getPrimalSolution(finalTime, &primalSolution_);
+  commandData_.mpcInitObservation_ = currentObservation;
+  commandData_.mpcTargetTrajectories_ = mpc_.getSolverPtr()->getReferenceManager().getTargetTrajectories();
+  performanceIndices_ = mpc_.getSolverPtr()->getPerformanceIndeces();
+
+  // publish the policy by encoding it in place into the shared memory
+  policyChannel_.write([&](uint8_t* data, size_t capacity) {
+    return binary_policy::encode(commandData_, primalSolution_, performanceIndices_, settings_.policyEncoding, data, capacity);
+  });
+
+  // measure the delay for sending the policy
+  mpcTimer_.endTimer();
+
+  // check MPC delay and solution window compatibility
+  scalar_t timeWindow = mpc_.settings().solutionTimeWindow_;
+  if (mpc_.settings().solutionTimeWindow_ < 0) {
+    timeWindow = mpc_.getSolverPtr()->getFinalTime() - currentObservation.time;
+  }
+  if (timeWindow < 2.0 * mpcTimer_.getAverageInMilliseconds() * 1e-3) {
+    std::cerr << "WARNING: The solution time window might be shorter than the MPC delay!\n";
+  }
+
+  // display
+  if (mpc_.settings().debugPrint_) {
+    std::cerr << '\n';
+    std::cerr << "\n### MPC_SharedMemory Benchmarking";
+    std::cerr << "\n###   Maximum : " << mpcTimer_.getMaxIntervalInMilliseconds() << "[ms].";
+    std::cerr << "\n###   Average : " << mpcTimer_.getAverageInMilliseconds() << "[ms].";
+    std::cerr << "\n###   Latest  : " << mpcTimer_.getLastIntervalInMilliseconds() << "[ms]." << std::endl;
+  }
+}
+
+}  // namespace ocs2
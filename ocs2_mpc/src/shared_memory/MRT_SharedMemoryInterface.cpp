@@ -0,0 +1,115 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_mpc/shared_memory/MRT_SharedMemoryInterface.h"
+
+#include <iostream>
+#include <stdexcept>
+
+#include "ocs2_mpc/BinaryPolicy.h"
+#include "ocs2_mpc/shared_memory/MPC_SharedMemoryInterface.h"
+#include "ocs2_mpc/shared_memory/SharedMemoryMessages.h"
+
+namespace ocs2 {
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+MRT_SharedMemoryInterface::MRT_SharedMemoryInterface(std::string topicPrefix) : topicPrefix_(std::move(topicPrefix)) {}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MRT_SharedMemoryInterface::launchNodes(std::chrono::microseconds timeout) {
+  this->reset();
+  lastPolicySequence_ = 0;
+  policyChannelPtr_.reset(new shared_memory::SharedMemoryChannel(shared_memory::policyChannelName(topicPrefix_), timeout));
+  observationChannelPtr_.reset(new shared_memory::SharedMemoryChannel(shared_memory::observationChannelName(topicPrefix_), timeout));
+  resetChannelPtr_.reset(new shared_memory::SharedMemoryChannel(shared_memory::resetChannelName(topicPrefix_), timeout));
+  // a policy which is already in the channel belongs to a previous MRT session
+  lastPolicySequence_ = policyChannelPtr_->latestSequence();
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MRT_SharedMemoryInterface::resetMpcNode(const TargetTrajectories& initTargetTrajectories) {
+  if (resetChannelPtr_ == nullptr) {
+    throw std::runtime_error("[MRT_SharedMemoryInterface::resetMpcNode] Call launchNodes() first!");
+  }
+  this->reset();
+
+  const uint64_t sequence = resetChannelPtr_->write([&](uint8_t* data, size_t capacity) {
+    return shared_memory::writeResetMessage(initTargetTrajectories, data, capacity);
+  });
+
+  while (!resetChannelPtr_->waitForAcknowledge(sequence, std::chrono::seconds(5))) {
+    std::cerr << "[MRT_SharedMemoryInterface::resetMpcNode] MPC did not respond to the reset request, waiting...\n";
+  }
+  std::cerr << "MPC node has been reset.\n";
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MRT_SharedMemoryInterface::setCurrentObservation(const SystemObservation& currentObservation) {
+  if (observationChannelPtr_ == nullptr) {
+    throw std::runtime_error("[MRT_SharedMemoryInterface::setCurrentObservation] Call launchNodes() first!");
+  }
+  observationChannelPtr_->write([&](uint8_t* data, size_t capacity) {
+    return shared_memory::writeObservationMessage(currentObservation, data, capacity);
+  });
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+bool MRT_SharedMemoryInterface::spinMRT(std::chrono::microseconds timeout) {
+  if (policyChannelPtr_ == nullptr) {
+    throw std::runtime_error("[MRT_SharedMemoryInterface::spinMRT] Call launchNodes() first!");
+  }
+  if (timeout > std::chrono::microseconds::zero() && !policyChannelPtr_->waitForMessage(lastPolicySequence_, timeout)) {
+    return false;
+  }
+
+  // decode the policy in place from the shared memory
+  auto commandPtr = std::make_unique<CommandData>();
+  auto primalSolutionPtr = std::make_unique<PrimalSolution>();
+  auto performanceIndicesPtr = std::make_unique<PerformanceIndex>();
+  const bool isNew = policyChannelPtr_->read(lastPolicySequence_, [&](const uint8_t* data, size_t size) {
+    binary_policy::decode(data, size, *commandPtr, *primalSolutionPtr, *performanceIndicesPtr);
+  });
+
+  if (isNew) {
+    this->moveToBuffer(std::move(commandPtr), std::move(primalSolutionPtr), std::move(performanceIndicesPtr));
+  }
+  return isNew;
+}
+
+}  // namespace ocs2
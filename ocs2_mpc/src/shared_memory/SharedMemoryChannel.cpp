@@ -0,0 +1,357 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_mpc/shared_memory/SharedMemoryChannel.h"
+
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <thread>
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace ocs2 {
+namespace shared_memory {
+
+namespace {
+
+constexpr uint32_t MAGIC = 0x4F435348;  // "HSCO"
+constexpr uint32_t VERSION = 1;
+constexpr size_t ALIGNMENT = 64;  // cache line
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "The futex word must be a plain 32-bit integer.");
+static_assert(ATOMIC_INT_LOCK_FREE == 2 && ATOMIC_LLONG_LOCK_FREE == 2, "Inter-process atomics must be lock-free.");
+
+size_t alignUp(size_t size) {
+  return (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+}
+
+std::string errorMessage(const std::string& what, const std::string& name) {
+  return "[SharedMemoryChannel] " + what + " '" + name + "' failed: " + std::strerror(errno);
+}
+
+void futexWait(std::atomic<uint32_t>& word, uint32_t expected, std::chrono::nanoseconds timeout) {
+  const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+  timespec relativeTimeout;
+  relativeTimeout.tv_sec = seconds.count();
+  relativeTimeout.tv_nsec = (timeout - seconds).count();
+  // returns immediately if the word differs from expected, spurious wake-ups are handled by the caller
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT, expected, &relativeTimeout, nullptr, 0);
+}
+
+void futexWakeAll(std::atomic<uint32_t>& word) {
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+
+/** Increments the futex word and wakes up the waiters, if any. */
+void notify(std::atomic<uint32_t>& word, std::atomic<uint32_t>& numWaiters) {
+  word.fetch_add(1);
+  if (numWaiters.load() > 0) {
+    futexWakeAll(word);
+  }
+}
+
+/** Waits on the futex word until isReady() returns true or the timeout expires. */
+template <typename Condition>
+bool waitUntil(std::atomic<uint32_t>& word, std::atomic<uint32_t>& numWaiters, Condition isReady, std::chrono::microseconds timeout) {
+  if (isReady()) {
+    return true;
+  }
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  numWaiters.fetch_add(1);
+  bool ready = false;
+  while (true) {
+    // load the word before checking the condition, such that a notification in between makes the futex wait return immediately
+    const uint32_t expected = word.load();
+    ready = isReady();
+    const auto remaining = deadline - std::chrono::steady_clock::now();
+    if (ready || remaining <= std::chrono::nanoseconds::zero()) {
+      break;
+    }
+    futexWait(word, expected, remaining);
+  }
+  numWaiters.fetch_sub(1);
+  return ready;
+}
+
+}  // unnamed namespace
+
+/** The control block at the start of the segment. */
+struct SharedMemoryChannel::ControlBlock {
+  std::atomic<uint32_t> magic;  // set by the owner once the segment is initialized
+  uint32_t version;
+  uint64_t slotCapacity;
+  uint64_t slotStride;
+  uint64_t numSlots;
+
+  alignas(ALIGNMENT) std::atomic<uint64_t> latestSequence;
+  std::atomic<uint32_t> messageFutex;
+  std::atomic<uint32_t> messageWaiters;
+
+  alignas(ALIGNMENT) std::atomic<uint64_t> acknowledgedSequence;
+  std::atomic<uint32_t> acknowledgeFutex;
+  std::atomic<uint32_t> acknowledgeWaiters;
+};
+
+/** The header of each slot, followed by the message. */
+struct SharedMemoryChannel::SlotHeader {
+  std::atomic<uint64_t> sequence;  // zero while the slot is being written
+  uint64_t size;
+};
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+SharedMemoryChannel::SharedMemoryChannel(const std::string& name, size_t slotCapacity, size_t numSlots)
+    : name_("/" + name), isOwner_(true) {
+  if (numSlots < 2) {
+    throw std::runtime_error("[SharedMemoryChannel] The number of slots must be at least two!");
+  }
+
+  shm_unlink(name_.c_str());  // remove a stale segment
+  const int fileDescriptor = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fileDescriptor < 0) {
+    throw std::runtime_error(errorMessage("Creating", name_));
+  }
+
+  const size_t slotStride = alignUp(sizeof(SlotHeader)) + alignUp(slotCapacity);
+  const size_t size = alignUp(sizeof(ControlBlock)) + numSlots * slotStride;
+  if (ftruncate(fileDescriptor, static_cast<off_t>(size)) != 0) {
+    close(fileDescriptor);
+    shm_unlink(name_.c_str());
+    throw std::runtime_error(errorMessage("Resizing", name_));
+  }
+  map(fileDescriptor, size);
+
+  // the new segment is zero initialized
+  controlBlock_ = new (segment_) ControlBlock();
+  controlBlock_->version = VERSION;
+  controlBlock_->slotCapacity = slotCapacity;
+  controlBlock_->slotStride = slotStride;
+  controlBlock_->numSlots = numSlots;
+  for (size_t i = 0; i < numSlots; i++) {
+    new (segment_ + alignUp(sizeof(ControlBlock)) + i * slotStride) SlotHeader();
+  }
+  controlBlock_->magic.store(MAGIC, std::memory_order_release);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+SharedMemoryChannel::SharedMemoryChannel(const std::string& name, std::chrono::microseconds timeout) : name_("/" + name), isOwner_(false) {
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  const auto retry = [&](const std::string& what) {
+    if (std::chrono::steady_clock::now() > deadline) {
+      throw std::runtime_error("[SharedMemoryChannel] Timeout while opening '" + name_ + "': " + what);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  };
+
+  while (true) {
+    const int fileDescriptor = shm_open(name_.c_str(), O_RDWR, 0);
+    if (fileDescriptor < 0) {
+      retry("the channel does not exist.");
+      continue;
+    }
+
+    struct stat status;
+    if (fstat(fileDescriptor, &status) != 0 || static_cast<size_t>(status.st_size) < sizeof(ControlBlock)) {
+      close(fileDescriptor);
+      retry("the channel is not initialized.");
+      continue;
+    }
+    map(fileDescriptor, status.st_size);
+
+    controlBlock_ = reinterpret_cast<ControlBlock*>(segment_);
+    if (controlBlock_->magic.load(std::memory_order_acquire) != MAGIC) {
+      munmap(segment_, segmentSize_);
+      segment_ = nullptr;
+      retry("the channel is not initialized.");
+      continue;
+    }
+    if (controlBlock_->version != VERSION ||
+        segmentSize_ < alignUp(sizeof(ControlBlock)) + controlBlock_->numSlots * controlBlock_->slotStride) {
+      throw std::runtime_error("[SharedMemoryChannel] The channel '" + name_ + "' has an incompatible layout!");
+    }
+    return;
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+SharedMemoryChannel::~SharedMemoryChannel() {
+  if (segment_ != nullptr) {
+    munmap(segment_, segmentSize_);
+  }
+  if (isOwner_) {
+    shm_unlink(name_.c_str());
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void SharedMemoryChannel::map(int fileDescriptor, size_t size) {
+  void* address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+  close(fileDescriptor);
+  if (address == MAP_FAILED) {
+    throw std::runtime_error(errorMessage("Mapping", name_));
+  }
+  segment_ = static_cast<uint8_t*>(address);
+  segmentSize_ = size;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+SharedMemoryChannel::SlotHeader& SharedMemoryChannel::slotHeader(uint64_t sequence) const {
+  const size_t slotIndex = sequence % controlBlock_->numSlots;
+  return *reinterpret_cast<SlotHeader*>(segment_ + alignUp(sizeof(ControlBlock)) + slotIndex * controlBlock_->slotStride);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+uint8_t* SharedMemoryChannel::slotData(uint64_t sequence) const {
+  return reinterpret_cast<uint8_t*>(&slotHeader(sequence)) + alignUp(sizeof(SlotHeader));
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+size_t SharedMemoryChannel::slotCapacity() const {
+  return controlBlock_->slotCapacity;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+uint64_t SharedMemoryChannel::latestSequence() const {
+  return controlBlock_->latestSequence.load(std::memory_order_acquire);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+uint64_t SharedMemoryChannel::write(const std::function<size_t(uint8_t* data, size_t capacity)>& writer) {
+  auto& controlBlock = *controlBlock_;
+  const uint64_t sequence = controlBlock.latestSequence.load(std::memory_order_relaxed) + 1;
+  auto& slot = slotHeader(sequence);
+
+  // mark the slot as being written
+  slot.sequence.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  const size_t size = writer(slotData(sequence), controlBlock.slotCapacity);
+  if (size > controlBlock.slotCapacity) {
+    throw std::runtime_error("[SharedMemoryChannel::write] The message does not fit into the slot of '" + name_ + "'!");
+  }
+  slot.size = size;
+
+  // publish
+  slot.sequence.store(sequence, std::memory_order_release);
+  controlBlock.latestSequence.store(sequence);
+  notify(controlBlock.messageFutex, controlBlock.messageWaiters);
+  return sequence;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+bool SharedMemoryChannel::read(uint64_t& lastSequence, const std::function<void(const uint8_t* data, size_t size)>& reader) {
+  while (true) {
+    const uint64_t sequence = latestSequence();
+    if (sequence == 0 || sequence == lastSequence) {
+      return false;
+    }
+
+    auto& slot = slotHeader(sequence);
+    if (slot.sequence.load(std::memory_order_acquire) != sequence) {
+      continue;  // already overwritten, retry with the newer message
+    }
+    const size_t size = slot.size;
+
+    // the message is only valid if the slot has not been touched by the writer while reading
+    const auto isConsistent = [&]() {
+      std::atomic_thread_fence(std::memory_order_acquire);
+      return slot.sequence.load(std::memory_order_relaxed) == sequence;
+    };
+    try {
+      if (size <= controlBlock_->slotCapacity) {
+        reader(slotData(sequence), size);
+      }
+    } catch (...) {
+      if (isConsistent()) {
+        throw;
+      }
+      continue;
+    }
+    if (size <= controlBlock_->slotCapacity && isConsistent()) {
+      lastSequence = sequence;
+      return true;
+    }
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+bool SharedMemoryChannel::waitForMessage(uint64_t lastSequence, std::chrono::microseconds timeout) const {
+  return waitUntil(
+      controlBlock_->messageFutex, controlBlock_->messageWaiters, [&]() { return latestSequence() != lastSequence; }, timeout);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void SharedMemoryChannel::acknowledge(uint64_t sequence) {
+  controlBlock_->acknowledgedSequence.store(sequence);
+  notify(controlBlock_->acknowledgeFutex, controlBlock_->acknowledgeWaiters);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+bool SharedMemoryChannel::waitForAcknowledge(uint64_t sequence, std::chrono::microseconds timeout) const {
+  return waitUntil(
+      controlBlock_->acknowledgeFutex, controlBlock_->acknowledgeWaiters,
+      [&]() { return controlBlock_->acknowledgedSequence.load() == sequence; }, timeout);
+}
+
+}  // namespace shared_memory
+}  // namespace ocs2
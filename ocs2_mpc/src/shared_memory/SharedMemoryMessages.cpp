@@ -0,0 +1,187 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_mpc/shared_memory/SharedMemoryMessages.h"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace ocs2 {
+namespace shared_memory {
+
+namespace {
+
+/** Sequential bounds-checked access to a message buffer. */
+template <typename Byte>
+class Cursor {
+ public:
+  Cursor(Byte* data, size_t size) : pos_(data), end_(data + size) {}
+
+  template <typename T>
+  void write(const T* src, size_t n) {
+    std::memcpy(advance(n * sizeof(T)), src, n * sizeof(T));
+  }
+
+  template <typename T>
+  void read(T* dst, size_t n) {
+    std::memcpy(dst, advance(n * sizeof(T)), n * sizeof(T));
+  }
+
+  template <typename T>
+  T readValue() {
+    T value;
+    read(&value, 1);
+    return value;
+  }
+
+  void writeVector(const vector_t& v) {
+    const auto size = static_cast<uint32_t>(v.size());
+    write(&size, 1);
+    write(v.data(), v.size());
+  }
+
+  void readVector(vector_t& v) {
+    const auto size = readValue<uint32_t>();
+    if (size > static_cast<size_t>(end_ - pos_) / sizeof(scalar_t)) {
+      throw std::runtime_error("[shared_memory] The message is truncated!");
+    }
+    v.resize(size);
+    read(v.data(), size);
+  }
+
+  size_t size(const Byte* begin) const { return pos_ - begin; }
+
+ private:
+  Byte* advance(size_t numBytes) {
+    if (numBytes > static_cast<size_t>(end_ - pos_)) {
+      throw std::runtime_error("[shared_memory] The message does not fit into the buffer!");
+    }
+    Byte* pos = pos_;
+    pos_ += numBytes;
+    return pos;
+  }
+
+  Byte* pos_;
+  Byte* end_;
+};
+
+}  // unnamed namespace
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+size_t writeObservationMessage(const SystemObservation& observation, uint8_t* data, size_t capacity) {
+  Cursor<uint8_t> cursor(data, capacity);
+  const auto type = MessageType::OBSERVATION;
+  const auto mode = static_cast<uint64_t>(observation.mode);
+  cursor.write(&type, 1);
+  cursor.write(&mode, 1);
+  cursor.write(&observation.time, 1);
+  cursor.writeVector(observation.state);
+  cursor.writeVector(observation.input);
+  return cursor.size(data);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+size_t writeResetMessage(const TargetTrajectories& targetTrajectories, uint8_t* data, size_t capacity) {
+  Cursor<uint8_t> cursor(data, capacity);
+  const auto type = MessageType::RESET;
+  const auto numTimes = static_cast<uint32_t>(targetTrajectories.timeTrajectory.size());
+  const auto numStates = static_cast<uint32_t>(targetTrajectories.stateTrajectory.size());
+  const auto numInputs = static_cast<uint32_t>(targetTrajectories.inputTrajectory.size());
+  cursor.write(&type, 1);
+  cursor.write(&numTimes, 1);
+  cursor.write(&numStates, 1);
+  cursor.write(&numInputs, 1);
+  cursor.write(targetTrajectories.timeTrajectory.data(), numTimes);
+  for (const auto& state : targetTrajectories.stateTrajectory) {
+    cursor.writeVector(state);
+  }
+  for (const auto& input : targetTrajectories.inputTrajectory) {
+    cursor.writeVector(input);
+  }
+  return cursor.size(data);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+MessageType readMessageType(const uint8_t* data, size_t size) {
+  if (size < sizeof(MessageType)) {
+    return MessageType::UNKNOWN;
+  }
+  MessageType type;
+  std::memcpy(&type, data, sizeof(MessageType));
+  return (type == MessageType::OBSERVATION || type == MessageType::RESET) ? type : MessageType::UNKNOWN;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void readObservationMessage(const uint8_t* data, size_t size, SystemObservation& observation) {
+  Cursor<const uint8_t> cursor(data, size);
+  if (cursor.readValue<MessageType>() != MessageType::OBSERVATION) {
+    throw std::runtime_error("[shared_memory::readObservationMessage] Not an observation message!");
+  }
+  observation.mode = static_cast<size_t>(cursor.readValue<uint64_t>());
+  observation.time = cursor.readValue<scalar_t>();
+  cursor.readVector(observation.state);
+  cursor.readVector(observation.input);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void readResetMessage(const uint8_t* data, size_t size, TargetTrajectories& targetTrajectories) {
+  Cursor<const uint8_t> cursor(data, size);
+  if (cursor.readValue<MessageType>() != MessageType::RESET) {
+    throw std::runtime_error("[shared_memory::readResetMessage] Not a reset message!");
+  }
+  const auto numTimes = cursor.readValue<uint32_t>();
+  const auto numStates = cursor.readValue<uint32_t>();
+  const auto numInputs = cursor.readValue<uint32_t>();
+  if (numTimes + size_t(numStates) + numInputs > size) {
+    throw std::runtime_error("[shared_memory::readResetMessage] The message is truncated!");
+  }
+  targetTrajectories.timeTrajectory.resize(numTimes);
+  cursor.read(targetTrajectories.timeTrajectory.data(), numTimes);
+  targetTrajectories.stateTrajectory.resize(numStates);
+  for (auto& state : targetTrajectories.stateTrajectory) {
+    cursor.readVector(state);
+  }
+  targetTrajectories.inputTrajectory.resize(numInputs);
+  for (auto& input : targetTrajectories.inputTrajectory) {
+    cursor.readVector(input);
+  }
+}
+
+}  // namespace shared_memory
+}  // namespace ocs2
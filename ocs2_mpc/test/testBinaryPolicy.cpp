@@ -0,0 +1,438 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+
+#include <ocs2_core/control/FeedforwardController.h>
+#include <ocs2_core/control/LinearController.h>
+
+#include "ocs2_mpc/BinaryPolicy.h"
+#include "ocs2_mpc/MRT_BASE.h"
+
+using namespace ocs2;
+
+namespace {
+
+constexpr size_t STATE_DIM = 6;
+constexpr size_t INPUT_DIM = 3;
+constexpr size_t NUM_NODES = 20;
+
+CommandData getCommandData() {
+  CommandData commandData;
+  commandData.mpcInitObservation_.time = 0.25;
+  commandData.mpcInitObservation_.mode = 3;
+  commandData.mpcInitObservation_.state = vector_t::Random(STATE_DIM);
+  commandData.mpcInitObservation_.input = vector_t::Random(INPUT_DIM);
+  commandData.mpcTargetTrajectories_ =
+      TargetTrajectories({0.0, 1.0}, {vector_t::Random(STATE_DIM), vector_t::Random(STATE_DIM)}, {vector_t::Zero(INPUT_DIM)});
+  return commandData;
+}
+
+PrimalSolution getPrimalSolution(bool linearController) {
+  PrimalSolution primalSolution;
+  primalSolution.modeSchedule_ = ModeSchedule({0.5, 1.0}, {1, 2, 3});
+  primalSolution.postEventIndices_ = {5, 12};
+  // slowly varying gains, as produced by a Riccati recursion
+  const matrix_t gainBase = 50.0 * matrix_t::Random(INPUT_DIM, STATE_DIM);
+  const matrix_t gainRate = matrix_t::Random(INPUT_DIM, STATE_DIM);
+  matrix_array_t gains;
+  vector_array_t biases;
+  for (size_t k = 0; k < NUM_NODES; k++) {
+    const scalar_t t = 0.25 + 0.05 * k;
+    primalSolution.timeTrajectory_.push_back(t);
+    primalSolution.stateTrajectory_.push_back(vector_t::Random(STATE_DIM));
+    primalSolution.inputTrajectory_.push_back(vector_t::Random(INPUT_DIM));
+    biases.push_back(vector_t::Random(INPUT_DIM));
+    gains.push_back(gainBase + std::sin(t) * gainRate);
+  }
+  if (linearController) {
+    primalSolution.controllerPtr_.reset(new LinearController(primalSolution.timeTrajectory_, std::move(biases), std::move(gains)));
+  } else {
+    primalSolution.controllerPtr_.reset(new FeedforwardController(primalSolution.timeTrajectory_, std::move(biases)));
+  }
+  return primalSolution;
+}
+
+PerformanceIndex getPerformanceIndex() {
+  PerformanceIndex performanceIndex;
+  performanceIndex.merit = 1.0;
+  performanceIndex.cost = 2.0;
+  performanceIndex.dynamicsViolationSSE = 3.0;
+  performanceIndex.inequalityLagrangian = 4.0;
+  return performanceIndex;
+}
+
+scalar_t maxError(const vector_array_t& lhs, const vector_array_t& rhs) {
+  scalar_t error = 0.0;
+  for (size_t i = 0; i < lhs.size(); i++) {
+    error = std::max(error, (lhs[i] - rhs[i]).lpNorm<Eigen::Infinity>());
+  }
+  return error;
+}
+
+scalar_t maxError(const matrix_array_t& lhs, const matrix_array_t& rhs) {
+  scalar_t error = 0.0;
+  for (size_t i = 0; i < lhs.size(); i++) {
+    error = std::max(error, (lhs[i] - rhs[i]).lpNorm<Eigen::Infinity>());
+  }
+  return error;
+}
+
+/** Encodes and decodes the policy, checks the exactly transmitted fields, and returns the max error on the gains. */
+scalar_t roundTrip(const PrimalSolution& primalSolution, const binary_policy::Settings& settings, scalar_t trajectoryTolerance) {
+  const auto commandData = getCommandData();
+  const auto performanceIndex = getPerformanceIndex();
+
+  std::vector<uint8_t> buffer;
+  binary_policy::encode(commandData, primalSolution, performanceIndex, settings, buffer);
+  EXPECT_EQ(buffer.size(), binary_policy::encodedSize(commandData, primalSolution, settings));
+
+  CommandData decodedCommand;
+  PrimalSolution decodedSolution;
+  PerformanceIndex decodedPerformanceIndex;
+  binary_policy::decode(buffer, decodedCommand, decodedSolution, decodedPerformanceIndex);
+
+  EXPECT_TRUE(decodedPerformanceIndex.isApprox(performanceIndex, 0.0));
+  EXPECT_EQ(decodedCommand.mpcInitObservation_.time, commandData.mpcInitObservation_.time);
+  EXPECT_EQ(decodedCommand.mpcInitObservation_.mode, commandData.mpcInitObservation_.mode);
+  EXPECT_TRUE(decodedCommand.mpcInitObservation_.state == commandData.mpcInitObservation_.state);
+  EXPECT_TRUE(decodedCommand.mpcInitObservation_.input == commandData.mpcInitObservation_.input);
+  EXPECT_TRUE(decodedCommand.mpcTargetTrajectories_ == commandData.mpcTargetTrajectories_);
+  EXPECT_EQ(decodedSolution.modeSchedule_.eventTimes, primalSolution.modeSchedule_.eventTimes);
+  EXPECT_EQ(decodedSolution.modeSchedule_.modeSequence, primalSolution.modeSchedule_.modeSequence);
+  EXPECT_EQ(decodedSolution.timeTrajectory_, primalSolution.timeTrajectory_);
+  EXPECT_EQ(decodedSolution.postEventIndices_, primalSolution.postEventIndices_);
+  EXPECT_LE(maxError(decodedSolution.stateTrajectory_, primalSolution.stateTrajectory_), trajectoryTolerance);
+  EXPECT_LE(maxError(decodedSolution.inputTrajectory_, primalSolution.inputTrajectory_), trajectoryTolerance);
+
+  EXPECT_EQ(decodedSolution.controllerPtr_->getType(), primalSolution.controllerPtr_->getType());
+  if (primalSolution.controllerPtr_->getType() == ControllerType::FEEDFORWARD) {
+    const auto& controller = static_cast<const FeedforwardController&>(*primalSolution.controllerPtr_);
+    const auto& decodedController = static_cast<const FeedforwardController&>(*decodedSolution.controllerPtr_);
+    EXPECT_EQ(decodedController.timeStamp_, controller.timeStamp_);
+    EXPECT_LE(maxError(decodedController.uffArray_, controller.uffArray_), trajectoryTolerance);
+    return 0.0;
+  } else {
+    const auto& controller = static_cast<const LinearController&>(*primalSolution.controllerPtr_);
+    const auto& decodedController = static_cast<const LinearController&>(*decodedSolution.controllerPtr_);
+    EXPECT_EQ(decodedController.timeStamp_, controller.timeStamp_);
+    EXPECT_LE(maxError(decodedController.biasArray_, controller.biasArray_), trajectoryTolerance);
+    return maxError(decodedController.gainArray_, controller.gainArray_);
+  }
+}
+
+/** A smooth policy on the horizon [initTime, initTime + (NUM_NODES - 1) * timeStep]. */
+PrimalSolution getSmoothPrimalSolution(scalar_t initTime, scalar_t timeStep) {
+  PrimalSolution primalSolution;
+  primalSolution.modeSchedule_ = ModeSchedule({initTime + 0.5}, {1, 2});
+  matrix_array_t gains;
+  vector_array_t biases;
+  for (size_t k = 0; k < NUM_NODES; k++) {
+    const scalar_t t = initTime + timeStep * k;
+    primalSolution.timeTrajectory_.push_back(t);
+    primalSolution.stateTrajectory_.push_back(vector_t::LinSpaced(STATE_DIM, 0.0, 1.0).array() + std::sin(t));
+    primalSolution.inputTrajectory_.push_back(vector_t::LinSpaced(INPUT_DIM, 0.0, 1.0).array() + std::cos(t));
+    biases.push_back(vector_t::Constant(INPUT_DIM, std::sin(2.0 * t)));
+    gains.push_back(matrix_t::Constant(INPUT_DIM, STATE_DIM, 10.0 * std::cos(t)));
+  }
+  primalSolution.controllerPtr_.reset(new LinearController(primalSolution.timeTrajectory_, std::move(biases), std::move(gains)));
+  return primalSolution;
+}
+
+/** Checks that the decoded policy matches the encoded one within the tolerances. */
+void expectWithinTolerance(const PrimalSolution& decoded, const PrimalSolution& expected, const binary_policy::DeltaSettings& settings) {
+  constexpr scalar_t precision = 1e-12;
+  EXPECT_EQ(decoded.timeTrajectory_, expected.timeTrajectory_);
+  EXPECT_LE(maxError(decoded.stateTrajectory_, expected.stateTrajectory_), settings.trajectoryTolerance + precision);
+  EXPECT_LE(maxError(decoded.inputTrajectory_, expected.inputTrajectory_), settings.trajectoryTolerance + precision);
+  const auto& controller = static_cast<const LinearController&>(*expected.controllerPtr_);
+  const auto& decodedController = static_cast<const LinearController&>(*decoded.controllerPtr_);
+  EXPECT_EQ(decodedController.timeStamp_, controller.timeStamp_);
+  EXPECT_LE(maxError(decodedController.biasArray_, controller.biasArray_), settings.trajectoryTolerance + precision);
+  EXPECT_LE(maxError(decodedController.gainArray_, controller.gainArray_), settings.gainTolerance + precision);
+}
+
+class DeltaMRT final : public MRT_BASE {
+ public:
+  void resetMpcNode(const TargetTrajectories&) override {}
+  void setCurrentObservation(const SystemObservation&) override {}
+  using MRT_BASE::moveDeltaToBuffer;
+};
+
+}  // unnamed namespace
+
+TEST(testBinaryPolicy, halfConversion) {
+  EXPECT_EQ(binary_policy::floatToHalf(1.0f), 0x3C00);
+  EXPECT_EQ(binary_policy::floatToHalf(-2.0f), 0xC000);
+  EXPECT_EQ(binary_policy::floatToHalf(65504.0f), 0x7BFF);
+  EXPECT_EQ(binary_policy::floatToHalf(65520.0f), 0x7C00);
+  EXPECT_EQ(binary_policy::floatToHalf(std::ldexp(1.0f, -24)), 0x0001);
+  EXPECT_EQ(binary_policy::floatToHalf(std::ldexp(1.0f, -25)), 0x0000);  // tie to even
+  EXPECT_EQ(binary_policy::floatToHalf(1.0f + std::ldexp(1.0f, -11)), 0x3C00);  // tie to even
+  EXPECT_EQ(binary_policy::floatToHalf(1.0f + 3.0f * std::ldexp(1.0f, -11)), 0x3C02);  // tie to even
+  EXPECT_TRUE(std::isnan(binary_policy::halfToFloat(binary_policy::floatToHalf(NAN))));
+
+  // all finite half values are represented exactly by a float
+  for (uint32_t bits = 0; bits <= 0xFFFF; bits++) {
+    if ((bits & 0x7C00) != 0x7C00) {
+      EXPECT_EQ(binary_policy::floatToHalf(binary_policy::halfToFloat(bits)), bits);
+    }
+  }
+}
+
+TEST(testBinaryPolicy, linearController) {
+  const auto primalSolution = getPrimalSolution(true);
+  const scalar_t gainMagnitude = 51.0;
+
+  binary_policy::Settings settings;
+  settings.trajectoryEncoding = binary_policy::Encoding::FLOAT64;
+  settings.gainEncoding = binary_policy::Encoding::FLOAT64;
+  EXPECT_EQ(roundTrip(primalSolution, settings, 0.0), 0.0);
+
+  settings.trajectoryEncoding = binary_policy::Encoding::FLOAT32;
+  settings.gainEncoding = binary_policy::Encoding::FLOAT32;
+  EXPECT_LE(roundTrip(primalSolution, settings, 1e-7), gainMagnitude * 1e-7);
+
+  settings.gainEncoding = binary_policy::Encoding::FLOAT16;
+  const scalar_t float16Error = roundTrip(primalSolution, settings, 1e-7);
+  EXPECT_LE(float16Error, gainMagnitude * 1e-3);
+
+  // the deltas of slowly varying gains are small, which float16 represents more accurately
+  settings.gainEncoding = binary_policy::Encoding::FLOAT16_DELTA;
+  const scalar_t deltaError = roundTrip(primalSolution, settings, 1e-7);
+  EXPECT_LT(deltaError, float16Error);
+
+  settings.trajectoryEncoding = binary_policy::Encoding::FLOAT16;
+  roundTrip(primalSolution, settings, 1e-3);
+}
+
+TEST(testBinaryPolicy, feedforwardController) {
+  binary_policy::Settings settings;
+  settings.trajectoryEncoding = binary_policy::Encoding::FLOAT64;
+  roundTrip(getPrimalSolution(false), settings, 0.0);
+}
+
+TEST(testBinaryPolicy, size) {
+  const auto commandData = getCommandData();
+  const auto primalSolution = getPrimalSolution(true);
+
+  binary_policy::Settings settings;
+  const size_t float32Size = binary_policy::encodedSize(commandData, primalSolution, settings);
+  settings.gainEncoding = binary_policy::Encoding::FLOAT16;
+  const size_t float16Size = binary_policy::encodedSize(commandData, primalSolution, settings);
+  EXPECT_EQ(float32Size - float16Size, NUM_NODES * INPUT_DIM * STATE_DIM * (sizeof(float) - sizeof(uint16_t)));
+}
+
+TEST(testBinaryPolicy, decodeInPlace) {
+  const auto commandData = getCommandData();
+  const auto performanceIndex = getPerformanceIndex();
+  auto primalSolution = getPrimalSolution(true);
+
+  std::vector<uint8_t> buffer;
+  binary_policy::encode(commandData, primalSolution, performanceIndex, binary_policy::Settings(), buffer);
+
+  CommandData decodedCommand;
+  PrimalSolution decodedSolution;
+  PerformanceIndex decodedPerformanceIndex;
+  binary_policy::decode(buffer, decodedCommand, decodedSolution, decodedPerformanceIndex);
+  const auto* controllerPtr = decodedSolution.controllerPtr_.get();
+  const auto* statePtr = decodedSolution.stateTrajectory_.back().data();
+  const auto* gainPtr = static_cast<const LinearController*>(controllerPtr)->gainArray_.back().data();
+
+  // decoding a policy of the same size reuses the memory
+  primalSolution.stateTrajectory_.back().setZero();
+  binary_policy::encode(commandData, primalSolution, performanceIndex, binary_policy::Settings(), buffer);
+  binary_policy::decode(buffer, decodedCommand, decodedSolution, decodedPerformanceIndex);
+  EXPECT_EQ(decodedSolution.controllerPtr_.get(), controllerPtr);
+  EXPECT_EQ(decodedSolution.stateTrajectory_.back().data(), statePtr);
+  EXPECT_EQ(static_cast<const LinearController*>(controllerPtr)->gainArray_.back().data(), gainPtr);
+  EXPECT_TRUE(decodedSolution.stateTrajectory_.back().isZero());
+}
+
+TEST(testBinaryPolicy, invalidBuffer) {
+  const auto commandData = getCommandData();
+  const auto primalSolution = getPrimalSolution(true);
+
+  std::vector<uint8_t> buffer;
+  binary_policy::encode(commandData, primalSolution, getPerformanceIndex(), binary_policy::Settings(), buffer);
+
+  CommandData decodedCommand;
+  PrimalSolution decodedSolution;
+  PerformanceIndex decodedPerformanceIndex;
+
+  auto truncated = buffer;
+  truncated.pop_back();
+  EXPECT_THROW(binary_policy::decode(truncated, decodedCommand, decodedSolution, decodedPerformanceIndex), std::runtime_error);
+
+  auto wrongMagic = buffer;
+  wrongMagic[0] ^= 0xFF;
+  EXPECT_THROW(binary_policy::decode(wrongMagic, decodedCommand, decodedSolution, decodedPerformanceIndex), std::runtime_error);
+
+  auto wrongDimension = buffer;
+  wrongDimension[offsetof(binary_policy::Header, stateDim)] += 1;
+  EXPECT_THROW(binary_policy::decode(wrongDimension, decodedCommand, decodedSolution, decodedPerformanceIndex), std::runtime_error);
+}
+
+TEST(testBinaryPolicy, deltaShiftedHorizon) {
+  constexpr scalar_t timeStep = 0.05;
+  const auto commandData = getCommandData();
+  const auto performanceIndex = getPerformanceIndex();
+  binary_policy::Settings settings;
+  settings.trajectoryEncoding = binary_policy::Encoding::FLOAT64;
+  settings.gainEncoding = binary_policy::Encoding::FLOAT64;
+  const binary_policy::DeltaSettings deltaSettings;
+  binary_policy::DeltaEncoder encoder(settings, deltaSettings);
+  binary_policy::DeltaDecoder decoder;
+
+  std::vector<uint8_t> buffer;
+  CommandData decodedCommand;
+  PrimalSolution decodedSolution;
+  PerformanceIndex decodedPerformanceIndex;
+
+  const auto keyFrame = getSmoothPrimalSolution(0.0, timeStep);
+  EXPECT_TRUE(encoder.encode(commandData, keyFrame, performanceIndex, buffer));
+  EXPECT_TRUE(binary_policy::isDelta(buffer.data(), buffer.size()));
+  const size_t keyFrameSize = buffer.size();
+  ASSERT_TRUE(decoder.decode(buffer.data(), buffer.size(), decodedCommand, decodedSolution, decodedPerformanceIndex));
+  expectWithinTolerance(decodedSolution, keyFrame, binary_policy::DeltaSettings{0.0, 0.0});
+
+  // shifted by whole nodes: only the nodes beyond the previous horizon are sent
+  const auto shifted = getSmoothPrimalSolution(3.0 * timeStep, timeStep);
+  EXPECT_FALSE(encoder.encode(commandData, shifted, performanceIndex, buffer));
+  EXPECT_LT(buffer.size(), keyFrameSize / 3);
+  ASSERT_TRUE(decoder.decode(buffer.data(), buffer.size(), decodedCommand, decodedSolution, decodedPerformanceIndex));
+  expectWithinTolerance(decodedSolution, shifted, deltaSettings);
+  EXPECT_TRUE(decodedCommand.mpcTargetTrajectories_ == commandData.mpcTargetTrajectories_);
+  EXPECT_EQ(decodedSolution.modeSchedule_.eventTimes, shifted.modeSchedule_.eventTimes);
+
+  // shifted in between the nodes: the interpolation error of the smooth policy is below the tolerance
+  auto perturbed = getSmoothPrimalSolution(3.0 * timeStep + 0.01, timeStep);
+  perturbed.stateTrajectory_[5].array() += 0.1;
+  EXPECT_FALSE(encoder.encode(commandData, perturbed, performanceIndex, buffer));
+  ASSERT_TRUE(decoder.decode(buffer.data(), buffer.size(), decodedCommand, decodedSolution, decodedPerformanceIndex));
+  expectWithinTolerance(decodedSolution, perturbed, deltaSettings);
+  EXPECT_TRUE(decodedSolution.stateTrajectory_[5] == perturbed.stateTrajectory_[5]);
+
+  // a shift beyond the previous horizon is sent as a key frame
+  EXPECT_TRUE(encoder.encode(commandData, getSmoothPrimalSolution(10.0, timeStep), performanceIndex, buffer));
+}
+
+TEST(testBinaryPolicy, deltaDroppedUpdates) {
+  constexpr scalar_t timeStep = 0.05;
+  const auto commandData = getCommandData();
+  const auto performanceIndex = getPerformanceIndex();
+  binary_policy::DeltaSettings deltaSettings;
+  deltaSettings.keyFrameInterval = 3;
+  binary_policy::DeltaEncoder encoder(binary_policy::Settings(), deltaSettings);
+
+  std::vector<std::vector<uint8_t>> buffers(6);
+  std::vector<bool> isKeyFrame;
+  for (size_t i = 0; i < buffers.size(); i++) {
+    isKeyFrame.push_back(encoder.encode(commandData, getSmoothPrimalSolution(i * timeStep, timeStep), performanceIndex, buffers[i]));
+  }
+  EXPECT_EQ(isKeyFrame, std::vector<bool>({true, false, false, false, true, false}));
+
+  CommandData decodedCommand;
+  PrimalSolution decodedSolution;
+  PerformanceIndex decodedPerformanceIndex;
+  const auto decode = [&](binary_policy::DeltaDecoder& decoder, size_t i) {
+    return decoder.decode(buffers[i].data(), buffers[i].size(), decodedCommand, decodedSolution, decodedPerformanceIndex);
+  };
+
+  // each update refers to the last key frame, so a dropped update does not affect the following ones
+  binary_policy::DeltaDecoder decoder;
+  EXPECT_TRUE(decode(decoder, 0));
+  EXPECT_TRUE(decode(decoder, 1));
+  EXPECT_TRUE(decode(decoder, 3));
+  expectWithinTolerance(decodedSolution, getSmoothPrimalSolution(3 * timeStep, timeStep),
+                        binary_policy::DeltaSettings{deltaSettings.trajectoryTolerance + 1e-6, deltaSettings.gainTolerance + 1e-5});
+  EXPECT_TRUE(decode(decoder, 4));
+  EXPECT_TRUE(decode(decoder, 5));
+  EXPECT_FALSE(decode(decoder, 1));
+
+  // after a dropped key frame, the decoder waits for the next one
+  binary_policy::DeltaDecoder droppedKeyFrameDecoder;
+  EXPECT_TRUE(decode(droppedKeyFrameDecoder, 0));
+  EXPECT_TRUE(decode(droppedKeyFrameDecoder, 2));
+  EXPECT_FALSE(decode(droppedKeyFrameDecoder, 5));
+
+  // an update is not applied twice and not after a newer one
+  binary_policy::DeltaDecoder lateDecoder;
+  EXPECT_FALSE(decode(lateDecoder, 1));
+  EXPECT_TRUE(decode(lateDecoder, 0));
+  EXPECT_TRUE(decode(lateDecoder, 2));
+  EXPECT_FALSE(decode(lateDecoder, 2));
+  EXPECT_FALSE(decode(lateDecoder, 1));
+  EXPECT_TRUE(decode(lateDecoder, 3));
+
+  // the key frame of another encoder does not match
+  binary_policy::DeltaEncoder restartedEncoder(binary_policy::Settings(), deltaSettings);
+  std::vector<uint8_t> buffer;
+  EXPECT_TRUE(restartedEncoder.encode(commandData, getSmoothPrimalSolution(0.0, timeStep), performanceIndex, buffer));
+  EXPECT_TRUE(decoder.decode(buffer.data(), buffer.size(), decodedCommand, decodedSolution, decodedPerformanceIndex));
+  EXPECT_FALSE(decode(decoder, 1));
+
+  // a requested key frame
+  encoder.requestKeyFrame();
+  EXPECT_TRUE(encoder.encode(commandData, getSmoothPrimalSolution(0.0, timeStep), performanceIndex, buffer));
+}
+
+TEST(testBinaryPolicy, deltaMergeInMRT) {
+  constexpr scalar_t timeStep = 0.05;
+  const auto commandData = getCommandData();
+  const auto performanceIndex = getPerformanceIndex();
+  const binary_policy::DeltaSettings deltaSettings;
+  binary_policy::DeltaEncoder encoder(binary_policy::Settings(), deltaSettings);
+  DeltaMRT mrt;
+
+  std::vector<uint8_t> buffer;
+  encoder.encode(commandData, getSmoothPrimalSolution(0.0, timeStep), performanceIndex, buffer);
+  encoder.encode(commandData, getSmoothPrimalSolution(timeStep, timeStep), performanceIndex, buffer);
+  EXPECT_FALSE(mrt.moveDeltaToBuffer(buffer.data(), buffer.size()));
+  EXPECT_FALSE(mrt.initialPolicyReceived());
+
+  encoder.requestKeyFrame();
+  for (size_t i = 0; i < 3; i++) {
+    const auto primalSolution = getSmoothPrimalSolution(i * timeStep, timeStep);
+    encoder.encode(commandData, primalSolution, performanceIndex, buffer);
+    EXPECT_TRUE(mrt.moveDeltaToBuffer(buffer.data(), buffer.size()));
+    EXPECT_TRUE(mrt.updatePolicy());
+    // float32 encoding of the transmitted nodes
+    expectWithinTolerance(mrt.getPolicy(), primalSolution, binary_policy::DeltaSettings{deltaSettings.trajectoryTolerance + 1e-6,
+                                                                                        deltaSettings.gainTolerance + 1e-5});
+    EXPECT_TRUE(mrt.getPerformanceIndices().isApprox(performanceIndex, 0.0));
+  }
+
+  // the MRT forgets the key frame on reset
+  mrt.reset();
+  EXPECT_FALSE(mrt.moveDeltaToBuffer(buffer.data(), buffer.size()));
+}
@@ -0,0 +1,149 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+
+#include <ocs2_core/control/LinearController.h>
+
+#include "ocs2_mpc/MpcRecord.h"
+
+using namespace ocs2;
+
+namespace {
+
+constexpr size_t STATE_DIM = 4;
+constexpr size_t INPUT_DIM = 2;
+const std::string FILE_PATH = "/tmp/ocs2_mpc_record_test.bin";
+
+mpc_record::Instance getInstance(bool warmStart) {
+  mpc_record::Instance instance;
+  instance.initTime = 0.3;
+  instance.finalTime = 1.3;
+  instance.initState = vector_t::Random(STATE_DIM);
+  instance.targetTrajectories = TargetTrajectories({0.0, 2.0}, {vector_t::Random(STATE_DIM), vector_t::Random(STATE_DIM)},
+                                                   {vector_t::Random(INPUT_DIM), vector_t::Random(INPUT_DIM)});
+  instance.modeSchedule = ModeSchedule({0.5, 0.9}, {0, 1, 0});
+  instance.recordedStatistics.solveTimeInMilliseconds = 4.5;
+  instance.recordedStatistics.numIterations = 3;
+  instance.recordedStatistics.performanceIndex.merit = 12.0;
+  instance.recordedStatistics.performanceIndex.dynamicsViolationSSE = 1e-7;
+
+  instance.warmStart = warmStart;
+  if (warmStart) {
+    auto& guess = instance.initialGuess;
+    guess.modeSchedule_ = ModeSchedule({0.5}, {0, 1});
+    guess.postEventIndices_ = {4};
+    matrix_array_t gains;
+    vector_array_t biases;
+    for (size_t k = 0; k < 10; k++) {
+      guess.timeTrajectory_.push_back(0.2 + 0.1 * k);
+      guess.stateTrajectory_.push_back(vector_t::Random(STATE_DIM));
+      guess.inputTrajectory_.push_back(vector_t::Random(INPUT_DIM));
+      biases.push_back(vector_t::Random(INPUT_DIM));
+      gains.push_back(matrix_t::Random(INPUT_DIM, STATE_DIM));
+    }
+    guess.controllerPtr_.reset(new LinearController(guess.timeTrajectory_, std::move(biases), std::move(gains)));
+  }
+  return instance;
+}
+
+void expectEqual(const mpc_record::Instance& loaded, const mpc_record::Instance& recorded) {
+  EXPECT_EQ(loaded.initTime, recorded.initTime);
+  EXPECT_EQ(loaded.finalTime, recorded.finalTime);
+  EXPECT_TRUE(loaded.initState == recorded.initState);
+  EXPECT_EQ(loaded.targetTrajectories.timeTrajectory, recorded.targetTrajectories.timeTrajectory);
+  EXPECT_EQ(loaded.targetTrajectories.stateTrajectory, recorded.targetTrajectories.stateTrajectory);
+  EXPECT_EQ(loaded.targetTrajectories.inputTrajectory, recorded.targetTrajectories.inputTrajectory);
+  EXPECT_EQ(loaded.modeSchedule.eventTimes, recorded.modeSchedule.eventTimes);
+  EXPECT_EQ(loaded.modeSchedule.modeSequence, recorded.modeSchedule.modeSequence);
+  EXPECT_EQ(loaded.recordedStatistics.solveTimeInMilliseconds, recorded.recordedStatistics.solveTimeInMilliseconds);
+  EXPECT_EQ(loaded.recordedStatistics.numIterations, recorded.recordedStatistics.numIterations);
+  EXPECT_TRUE(loaded.recordedStatistics.performanceIndex.isApprox(recorded.recordedStatistics.performanceIndex, 0.0));
+
+  ASSERT_EQ(loaded.warmStart, recorded.warmStart);
+  const auto& guess = loaded.initialGuess;
+  if (!recorded.warmStart) {
+    EXPECT_TRUE(guess.timeTrajectory_.empty());
+    return;
+  }
+  EXPECT_EQ(guess.timeTrajectory_, recorded.initialGuess.timeTrajectory_);
+  EXPECT_EQ(guess.postEventIndices_, recorded.initialGuess.postEventIndices_);
+  EXPECT_EQ(guess.modeSchedule_.eventTimes, recorded.initialGuess.modeSchedule_.eventTimes);
+  EXPECT_EQ(guess.stateTrajectory_, recorded.initialGuess.stateTrajectory_);
+  EXPECT_EQ(guess.inputTrajectory_, recorded.initialGuess.inputTrajectory_);
+  const auto& controller = dynamic_cast<const LinearController&>(*guess.controllerPtr_);
+  const auto& recordedController = static_cast<const LinearController&>(*recorded.initialGuess.controllerPtr_);
+  EXPECT_EQ(controller.timeStamp_, recordedController.timeStamp_);
+  EXPECT_EQ(controller.biasArray_, recordedController.biasArray_);
+  EXPECT_EQ(controller.gainArray_, recordedController.gainArray_);
+}
+
+}  // unnamed namespace
+
+TEST(testMpcRecord, roundTrip) {
+  const std::vector<mpc_record::Instance> recorded = {getInstance(false), getInstance(true), getInstance(true)};
+  {
+    mpc_record::Recorder recorder(FILE_PATH);
+    for (const auto& instance : recorded) {
+      recorder.write(instance);
+    }
+  }
+
+  const auto loaded = mpc_record::load(FILE_PATH);
+  ASSERT_EQ(loaded.size(), recorded.size());
+  for (size_t i = 0; i < loaded.size(); i++) {
+    expectEqual(loaded[i], recorded[i]);
+  }
+  std::remove(FILE_PATH.c_str());
+}
+
+TEST(testMpcRecord, corruptedFile) {
+  EXPECT_THROW(mpc_record::load("/tmp/ocs2_mpc_record_missing.bin"), std::runtime_error);
+
+  {
+    mpc_record::Recorder recorder(FILE_PATH);
+    recorder.write(getInstance(true));
+  }
+  // truncate the last record
+  std::ifstream input(FILE_PATH, std::ios::binary);
+  std::vector<char> content((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+  input.close();
+  std::ofstream output(FILE_PATH, std::ios::binary | std::ios::trunc);
+  output.write(content.data(), content.size() - 8);
+  output.close();
+  EXPECT_THROW(mpc_record::load(FILE_PATH), std::runtime_error);
+
+  // not a record
+  std::ofstream(FILE_PATH, std::ios::binary | std::ios::trunc) << "not a record of the mpc problem instances";
+  EXPECT_THROW(mpc_record::load(FILE_PATH), std::runtime_error);
+  std::remove(FILE_PATH.c_str());
+}
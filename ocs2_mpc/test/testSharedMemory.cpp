@@ -0,0 +1,253 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <ocs2_core/control/FeedforwardController.h>
+
+#include "ocs2_mpc/BinaryPolicy.h"
+#include "ocs2_mpc/shared_memory/MPC_SharedMemoryInterface.h"
+#include "ocs2_mpc/shared_memory/MRT_SharedMemoryInterface.h"
+#include "ocs2_mpc/shared_memory/SharedMemoryChannel.h"
+#include "ocs2_mpc/shared_memory/SharedMemoryMessages.h"
+
+using namespace ocs2;
+using shared_memory::SharedMemoryChannel;
+
+namespace {
+
+std::string uniqueName(const std::string& name) {
+  return "ocs2_test_" + name + "_" + std::to_string(getpid());
+}
+
+/** Fills the message with the given value. */
+size_t writePattern(uint64_t value, size_t numWords, uint8_t* data, size_t capacity) {
+  std::vector<uint64_t> words(numWords, value);
+  std::memcpy(data, words.data(), numWords * sizeof(uint64_t));
+  return numWords * sizeof(uint64_t);
+}
+
+/** Returns the value of the message or zero if the message is not uniform. */
+uint64_t readPattern(const uint8_t* data, size_t size) {
+  std::vector<uint64_t> words(size / sizeof(uint64_t));
+  std::memcpy(words.data(), data, words.size() * sizeof(uint64_t));
+  for (const auto word : words) {
+    if (word != words.front()) {
+      return 0;
+    }
+  }
+  return words.front();
+}
+
+/** Waits for the child process and returns its exit code. */
+int waitForChild(pid_t pid) {
+  int status = 0;
+  waitpid(pid, &status, 0);
+  return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+}  // unnamed namespace
+
+TEST(testSharedMemoryChannel, latestValue) {
+  const auto name = uniqueName("latest_value");
+  SharedMemoryChannel writer(name, 1024, 3);
+  SharedMemoryChannel reader(name, std::chrono::seconds(1));
+  EXPECT_EQ(reader.slotCapacity(), 1024);
+
+  uint64_t lastSequence = 0;
+  EXPECT_FALSE(reader.read(lastSequence, [](const uint8_t*, size_t) {}));
+  EXPECT_FALSE(reader.waitForMessage(lastSequence, std::chrono::milliseconds(1)));
+
+  // the reader only gets the latest message
+  for (uint64_t i = 1; i <= 5; i++) {
+    writer.write([&](uint8_t* data, size_t capacity) { return writePattern(i, 10, data, capacity); });
+  }
+  EXPECT_TRUE(reader.waitForMessage(lastSequence, std::chrono::milliseconds(1)));
+  uint64_t value = 0;
+  EXPECT_TRUE(reader.read(lastSequence, [&](const uint8_t* data, size_t size) { value = readPattern(data, size); }));
+  EXPECT_EQ(value, 5);
+  EXPECT_EQ(lastSequence, 5);
+  EXPECT_FALSE(reader.read(lastSequence, [](const uint8_t*, size_t) {}));
+
+  // acknowledge
+  EXPECT_FALSE(writer.waitForAcknowledge(5, std::chrono::milliseconds(1)));
+  reader.acknowledge(lastSequence);
+  EXPECT_TRUE(writer.waitForAcknowledge(5, std::chrono::milliseconds(1)));
+
+  // the acknowledgement of a newer message does not acknowledge the overwritten ones
+  EXPECT_FALSE(writer.waitForAcknowledge(4, std::chrono::milliseconds(1)));
+
+  // too large messages
+  EXPECT_THROW(writer.write([](uint8_t* data, size_t capacity) { return capacity + 1; }), std::runtime_error);
+}
+
+TEST(testSharedMemoryChannel, openTimeout) {
+  EXPECT_THROW(SharedMemoryChannel(uniqueName("does_not_exist"), std::chrono::milliseconds(10)), std::runtime_error);
+}
+
+TEST(testSharedMemoryChannel, twoProcesses) {
+  constexpr uint64_t numMessages = 20000;
+  constexpr size_t numWords = 512;
+  const auto name = uniqueName("two_processes");
+  const auto echoName = uniqueName("two_processes_echo");
+  SharedMemoryChannel channel(name, numWords * sizeof(uint64_t), 3);
+  SharedMemoryChannel echoChannel(echoName, sizeof(uint64_t), 3);
+
+  const pid_t pid = fork();
+  if (pid == 0) {
+    // child: checks that every read message is consistent and echoes it back
+    int exitCode = 0;
+    try {
+      SharedMemoryChannel reader(name, std::chrono::seconds(1));
+      SharedMemoryChannel writer(echoName, std::chrono::seconds(1));
+      uint64_t lastSequence = 0;
+      uint64_t value = 0;
+      while (value < numMessages) {
+        if (!reader.waitForMessage(lastSequence, std::chrono::seconds(5))) {
+          exitCode = 1;
+          break;
+        }
+        uint64_t newValue = 0;
+        reader.read(lastSequence, [&](const uint8_t* data, size_t size) { newValue = readPattern(data, size); });
+        if (newValue <= value || newValue != lastSequence) {
+          exitCode = 2;
+          break;
+        }
+        value = newValue;
+        writer.write([&](uint8_t* data, size_t capacity) { return writePattern(value, 1, data, capacity); });
+      }
+    } catch (...) {
+      exitCode = 3;
+    }
+    _exit(exitCode);  // skip the destructors of the parent's objects
+  }
+
+  // parent: alternates between bursts and ping-pong with the child
+  uint64_t lastEchoSequence = 0;
+  for (uint64_t i = 1; i <= numMessages; i++) {
+    channel.write([&](uint8_t* data, size_t capacity) { return writePattern(i, numWords, data, capacity); });
+    if (i % 100 == 0) {
+      uint64_t echo = 0;
+      while (echo != i && echoChannel.waitForMessage(lastEchoSequence, std::chrono::seconds(5))) {
+        echoChannel.read(lastEchoSequence, [&](const uint8_t* data, size_t size) { echo = readPattern(data, size); });
+      }
+      ASSERT_EQ(echo, i);
+    }
+  }
+  EXPECT_EQ(waitForChild(pid), 0);
+}
+
+TEST(testSharedMemoryInterface, mrtWithMpcProcess) {
+  constexpr size_t numObservations = 5;
+  const std::string topicPrefix = uniqueName("robot");
+  const TargetTrajectories initTargetTrajectories({0.0}, {vector_t::Ones(2)}, {vector_t::Zero(1)});
+
+  // the MPC side owns the channels
+  shared_memory::Settings settings;
+  SharedMemoryChannel policyChannel(shared_memory::policyChannelName(topicPrefix), settings.policyCapacity, settings.numSlots);
+  SharedMemoryChannel observationChannel(shared_memory::observationChannelName(topicPrefix), settings.observationCapacity,
+                                         settings.numSlots);
+  SharedMemoryChannel resetChannel(shared_memory::resetChannelName(topicPrefix), settings.observationCapacity, settings.numSlots);
+
+  const pid_t pid = fork();
+  if (pid == 0) {
+    // child: a dummy MPC which returns the observed state as the feedforward input
+    int exitCode = 0;
+    try {
+      // the reset request arrives on its own channel and is acknowledged before any observation is handled
+      uint64_t lastResetSequence = 0;
+      TargetTrajectories targetTrajectories;
+      if (!resetChannel.waitForMessage(lastResetSequence, std::chrono::seconds(5))) {
+        throw std::runtime_error("The MRT did not request a reset.");
+      }
+      resetChannel.read(lastResetSequence,
+                        [&](const uint8_t* data, size_t size) { shared_memory::readResetMessage(data, size, targetTrajectories); });
+      const bool isReset = targetTrajectories == initTargetTrajectories;
+      resetChannel.acknowledge(lastResetSequence);
+
+      uint64_t lastSequence = 0;
+      size_t numReceivedObservations = 0;
+      while (numReceivedObservations < numObservations && observationChannel.waitForMessage(lastSequence, std::chrono::seconds(5))) {
+        SystemObservation observation;
+        observationChannel.read(lastSequence,
+                                [&](const uint8_t* data, size_t size) { shared_memory::readObservationMessage(data, size, observation); });
+
+        if (isReset) {
+          numReceivedObservations++;
+          PrimalSolution primalSolution;
+          primalSolution.timeTrajectory_ = {observation.time, observation.time + 1.0};
+          primalSolution.stateTrajectory_ = {observation.state, observation.state};
+          primalSolution.inputTrajectory_ = {observation.state.head(1), observation.state.head(1)};
+          primalSolution.controllerPtr_.reset(new FeedforwardController(primalSolution.timeTrajectory_, primalSolution.inputTrajectory_));
+          CommandData commandData;
+          commandData.mpcInitObservation_ = observation;
+          commandData.mpcTargetTrajectories_ = targetTrajectories;
+          policyChannel.write([&](uint8_t* data, size_t capacity) {
+            return binary_policy::encode(commandData, primalSolution, PerformanceIndex(), settings.policyEncoding, data, capacity);
+          });
+        }
+      }
+      exitCode = (numReceivedObservations == numObservations) ? 0 : 1;
+    } catch (...) {
+      exitCode = 2;
+    }
+    _exit(exitCode);
+  }
+
+  MRT_SharedMemoryInterface mrt(topicPrefix);
+  mrt.launchNodes(std::chrono::seconds(1));
+  mrt.resetMpcNode(initTargetTrajectories);
+
+  for (size_t i = 0; i < numObservations; i++) {
+    SystemObservation observation;
+    observation.time = static_cast<scalar_t>(i);
+    observation.state = vector_t::Constant(2, static_cast<scalar_t>(i));
+    observation.input = vector_t::Zero(1);
+    mrt.setCurrentObservation(observation);
+
+    ASSERT_TRUE(mrt.spinMRT(std::chrono::seconds(5)));
+    ASSERT_TRUE(mrt.updatePolicy());
+    EXPECT_EQ(mrt.getCommand().mpcInitObservation_.time, observation.time);
+
+    vector_t mpcState, mpcInput;
+    size_t mode;
+    mrt.evaluatePolicy(observation.time + 0.5, observation.state, mpcState, mpcInput, mode);
+    EXPECT_TRUE(mpcState.isApprox(observation.state));
+    EXPECT_DOUBLE_EQ(mpcInput(0), static_cast<scalar_t>(i));
+  }
+  EXPECT_EQ(waitForChild(pid), 0);
+}
@@ -136,6 +136,14 @@ scalar_t computeCost(const OptimalControlProblem& problem, const scalar_t& time,
 ScalarFunctionQuadraticApproximation approximateCost(const OptimalControlProblem& problem, const scalar_t& time, const vector_t& state,
                                                      const vector_t& input);
 
+/**
+ * Accumulates the quadratic approximation of the total intermediate cost (i.e. cost + softConstraints) into the given buffer in a
+ * single pass over all the terms. The buffer should be sized for the state and input, e.g. by setZero(nx, nu), which reuses the
+ * memory of a buffer of the same size. It is assumed that the precomputation request is already made.
+ */
+void accumulateCost(const OptimalControlProblem& problem, const scalar_t& time, const vector_t& state, const vector_t& input,
+                    ScalarFunctionQuadraticApproximation& cost);
+
 /**
  * Compute the total preJump cost (i.e. cost + softConstraints). It is assumed that the precomputation request is already made.
  */
@@ -0,0 +1,108 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <Eigen/Sparse>
+
+#include <ocs2_core/Types.h>
+#include <ocs2_core/thread_support/ThreadPool.h>
+
+#include "ocs2_oc/oc_problem/OcpSize.h"
+
+namespace ocs2 {
+
+/**
+ * Assembles the sparse KKT matrices of getConstraintMatrixSparse and getCostMatrixSparse (see OcpToKkt.h) in two phases.
+ *
+ * The symbolic phase (resize) computes the compressed column structure of G and H once per OcpSize. The stage blocks are stored as
+ * dense blocks, i.e., zero entries of the data are kept as explicit zeros, and the identity parts of the dynamics are diagonal.
+ * The numeric phase (getConstraintMatrix, getCostMatrix) scatters the stage data in parallel directly into the value array of the
+ * matrices. The output matrices keep their structure between calls, so they can be scaled in place (e.g. precondition::kktMatrixInPlace)
+ * or handed to a sparse QP backend which caches a symbolic factorization.
+ */
+class SparseKktAssembler {
+ public:
+  /**
+   * Computes the sparsity patterns of G and H. The call is skipped if the size is unchanged.
+   * @param[in] ocpSize: The size of optimal control problem.
+   */
+  void resize(const OcpSize& ocpSize);
+
+  /**
+   * Fills G and g as getConstraintMatrixSparse. If G does not have the structure of this assembler (e.g. it is empty), the structure
+   * is assigned first. Otherwise, only the values are overwritten.
+   *
+   * @param[in] threadPool: The external thread pool.
+   * @param[in] x0: The initial state.
+   * @param[in] dynamics: Linear approximation of the dynamics over the time horizon.
+   * @param[in] constraints: Linear approximation of the constraints over the time horizon. Pass nullptr if there is no constraints.
+   * @param[in] scalingVectorsPtr: Vector representatoin for the identity parts of the dynamics inside the constraint matrix. Pass nullptr
+   *                               to get them filled with identity matrices.
+   * @param[out] G: The jacobian of the concatenated constraints w.r.t. Z.
+   * @param[out] g: The concatenated constraints value.
+   */
+  void getConstraintMatrix(ThreadPool& threadPool, const vector_t& x0, const std::vector<VectorFunctionLinearApproximation>& dynamics,
+                           const std::vector<VectorFunctionLinearApproximation>* constraints, const vector_array_t* scalingVectorsPtr,
+                           Eigen::SparseMatrix<scalar_t>& G, vector_t& g) const;
+
+  /**
+   * Fills H and h as getCostMatrixSparse. If H does not have the structure of this assembler (e.g. it is empty), the structure is
+   * assigned first. Otherwise, only the values are overwritten.
+   *
+   * @param[in] threadPool: The external thread pool.
+   * @param[in] x0: The initial state.
+   * @param[in] cost: Quadratic approximation of the cost over the time horizon.
+   * @param[out] H: The concatenated hessian matrix w.r.t. Z.
+   * @param[out] h: The concatenated jacobian vector w.r.t. Z.
+   */
+  void getCostMatrix(ThreadPool& threadPool, const vector_t& x0, const std::vector<ScalarFunctionQuadraticApproximation>& cost,
+                     Eigen::SparseMatrix<scalar_t>& H, vector_t& h) const;
+
+  const OcpSize& size() const { return ocpSize_; }
+
+ private:
+  /** Structure of G with or without the general equality constraints. */
+  struct ConstraintPattern {
+    Eigen::SparseMatrix<scalar_t> matrix;
+    std::vector<int> dynamicsRow;    // First row of the dynamics of stage k
+    std::vector<int> constraintRow;  // First row of the general equality constraints of stage k
+  };
+
+  static void resizeConstraintPattern(const OcpSize& ocpSize, bool withConstraints, ConstraintPattern& pattern);
+  static void assignPattern(const Eigen::SparseMatrix<scalar_t>& pattern, Eigen::SparseMatrix<scalar_t>& matrix);
+
+  OcpSize ocpSize_;
+  std::vector<int> stageColumn_;  // First column of the decision variables [u_{k}; x_{k+1}] of stage k in Z
+  ConstraintPattern dynamicsPattern_;
+  ConstraintPattern dynamicsAndConstraintsPattern_;
+  Eigen::SparseMatrix<scalar_t> costPattern_;
+};
+
+}  // namespace ocs2
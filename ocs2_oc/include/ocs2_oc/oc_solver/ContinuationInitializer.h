@@ -0,0 +1,99 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <memory>
+
+#include <ocs2_core/Types.h>
+#include <ocs2_core/dynamics/SystemDynamicsBase.h>
+#include <ocs2_core/initialization/Initializer.h>
+#include <ocs2_core/integration/SensitivityIntegrator.h>
+
+#include "ocs2_oc/oc_data/PrimalSolution.h"
+
+namespace ocs2 {
+
+/**
+ * An Initializer for warm starting a solver on a shifted horizon. Beyond the end of the previous solution, it continues the final
+ * feedback policy of that solution, u = u_f + K_f (x - x_f), and propagates the state through the system dynamics. Here (t_f, x_f, u_f)
+ * is the final node of the previous solution and K_f is the final gain of its controller (no feedback for a feedforward controller).
+ *
+ * The policy is only continued within the mode of its final node, i.e. up to the next event time. Before a policy is set, outside its
+ * mode, or after clearPolicy(), the wrapped initializer is used.
+ */
+class ContinuationInitializer final : public Initializer {
+ public:
+  /**
+   * Constructor
+   *
+   * @param [in] initializer: The initializer which is used where the policy is not continued.
+   * @param [in] dynamics: The system dynamics for propagating the state under the continued policy.
+   * @param [in] integratorType: The integration scheme of a propagation step.
+   */
+  ContinuationInitializer(const Initializer& initializer, const SystemDynamicsBase& dynamics,
+                          SensitivityIntegratorType integratorType = SensitivityIntegratorType::RK4);
+
+  ~ContinuationInitializer() override = default;
+
+  ContinuationInitializer* clone() const override { return new ContinuationInitializer(*this); }
+
+  /**
+   * Sets the policy to be continued from the final node of the given solution. The solution should be adjusted to the current
+   * ModeSchedule. An empty solution clears the policy.
+   *
+   * @param [in] primalSolution: The previous solution.
+   */
+  void setPolicy(const PrimalSolution& primalSolution);
+
+  /** Clears the policy such that only the wrapped initializer is used. */
+  void clearPolicy() { hasPolicy_ = false; }
+
+  /** Whether a policy is continued. */
+  bool hasPolicy() const { return hasPolicy_; }
+
+  void compute(scalar_t time, const vector_t& state, scalar_t nextTime, vector_t& input, vector_t& nextState) override;
+
+ private:
+  ContinuationInitializer(const ContinuationInitializer& other);
+
+  std::unique_ptr<Initializer> initializerPtr_;
+  std::unique_ptr<SystemDynamicsBase> dynamicsPtr_;
+  SensitivityIntegratorType integratorType_;
+  DynamicsDiscretizer discretizer_;
+
+  bool hasPolicy_ = false;
+  scalar_t policyStartTime_ = 0.0;  // start of the mode of the final node
+  scalar_t policyFinalTime_ = 0.0;  // end of the mode of the final node
+  vector_t finalState_;
+  vector_t finalInput_;
+  matrix_t finalGain_;
+};
+
+}  // namespace ocs2
@@ -94,6 +94,32 @@ void ocpDataInPlaceInParallel(ThreadPool& threadPool, const vector_t& x0, const
                               std::vector<ScalarFunctionQuadraticApproximation>& cost, vector_array_t& DOut, vector_array_t& EOut,
                               vector_array_t& scalingVectors, scalar_t& cOut);
 
+/**
+ * Same as ocpDataInPlaceInParallel, but warm starts from the factors of a previous call, e.g. the previous SQP/SLP iteration or
+ * MPC cycle. The previous factors are applied in a single step, followed by correction sweeps. The sweeps stop once at least
+ * minIteration sweeps are done and the factors of the next sweep deviate from one by at most the tolerance, i.e., the data is
+ * equilibrated as well as a cold start would leave it. If the sizes of the given factors do not match ocpSize, it falls back to a
+ * cold start with maxIteration sweeps.
+ *
+ * @param [in] threadPool : The external thread pool.
+ * @param [in] x0 : The initial state.
+ * @param [in] ocpSize : The size of the oc problem.
+ * @param [in] minIteration : Minimum number of correction sweeps.
+ * @param [in] maxIteration : Maximum number of correction sweeps.
+ * @param [in] tolerance : Tolerance on the largest deviation of the next sweep's factors from one.
+ * @param [in, out] dynamics : The dynamics array of all time points.
+ * @param [in, out] cost : The cost array of all time points.
+ * @param [in, out] DInOut : The previous matrix D as the input and the new one as the output.
+ * @param [in, out] EInOut : The previous matrix E as the input and the new one as the output.
+ * @param [out] scalingVectors : Vector representation for the identity parts of the dynamics constraints inside the constraint matrix.
+ * @param [in, out] cInOut : The previous scaling factor c as the input and the new one as the output.
+ * @return The number of performed sweeps.
+ */
+int ocpDataInPlaceInParallelWarmStart(ThreadPool& threadPool, const vector_t& x0, const OcpSize& ocpSize, int minIteration,
+                                      int maxIteration, scalar_t tolerance, std::vector<VectorFunctionLinearApproximation>& dynamics,
+                                      std::vector<ScalarFunctionQuadraticApproximation>& cost, vector_array_t& DInOut,
+                                      vector_array_t& EInOut, vector_array_t& scalingVectors, scalar_t& cInOut);
+
 /**
  * Calculates the pre-conditioning factors D, E, and c, and scale the input dynamics, and cost data in place in place.
  *
@@ -0,0 +1,85 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <ocs2_core/thread_support/ThreadPool.h>
+
+#include "ocs2_oc/oc_problem/SparseKktAssembler.h"
+#include "ocs2_oc/qp_backend/AdmmSettings.h"
+#include "ocs2_oc/qp_backend/AdmmSolver.h"
+#include "ocs2_oc/qp_backend/OcpQpBackend.h"
+
+namespace ocs2 {
+
+/**
+ * QP backend which assembles the sparse KKT matrices of the QP (see OcpToKkt.h) with a fixed pattern, pre-conditions them with
+ * precondition::kktMatrixInPlace, and solves them with AdmmSolver. The symbolic analysis of the KKT system is done once per OcpSize
+ * and the previous primal and dual solution is used as the initial guess.
+ */
+class AdmmQpBackend final : public OcpQpBackend {
+ public:
+  /**
+   * Constructor.
+   * @param[in] settings: ADMM settings
+   * @param[in] threadPool: The thread pool used to assemble the KKT matrices. It should outlive this object.
+   */
+  AdmmQpBackend(admm::Settings settings, ThreadPool& threadPool);
+
+  ~AdmmQpBackend() override = default;
+
+  std::string name() const override { return "ADMM"; }
+
+  void resize(const OcpSize& ocpSize) override;
+
+  Status solve(const vector_t& x0, const std::vector<VectorFunctionLinearApproximation>& dynamics,
+               const std::vector<ScalarFunctionQuadraticApproximation>& cost,
+               const std::vector<VectorFunctionLinearApproximation>* constraints, vector_array_t& stateTrajectory,
+               vector_array_t& inputTrajectory) override;
+
+  size_t getNumIterations() const override { return solver_.getNumIterations(); }
+
+  const AdmmSolver& getSolver() const { return solver_; }
+
+ private:
+  ThreadPool& threadPool_;
+  SparseKktAssembler assembler_;
+  AdmmSolver solver_;
+
+  // KKT data and pre-conditioning factors
+  Eigen::SparseMatrix<scalar_t> H_, G_;
+  vector_t h_, g_;
+  vector_t D_, E_;
+  scalar_t c_ = 1.0;
+
+  // Unscaled solution of the last call
+  vector_t primalSolution_, dualSolution_;
+};
+
+}  // namespace ocs2
@@ -0,0 +1,83 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <string>
+
+#include <ocs2_core/Types.h>
+
+namespace ocs2 {
+namespace admm {
+
+struct Settings {
+  /**
+   * Maximum number of ADMM iterations. If it is reached before the termination criteria are met, the last iterate is returned as
+   * an inexact solution with the status MAX_ITER.
+   */
+  size_t maxNumIterations = 4000;
+  /** Termination criteria on the infinity norms of the primal and dual residuals. **/
+  scalar_t absoluteTolerance = 1e-4;
+  scalar_t relativeTolerance = 1e-4;
+  /** Number of iterations between consecutive calculation of termination conditions. **/
+  size_t checkTerminationInterval = 10;
+  /** Initial ADMM penalty. Rows with equal lower and upper bounds use equalityRhoFactor * rho. **/
+  scalar_t rho = 0.1;
+  scalar_t equalityRhoFactor = 1e3;
+  /** Regularization of the primal update. **/
+  scalar_t sigma = 1e-6;
+  /** Over-relaxation parameter in (0, 2). **/
+  scalar_t alpha = 1.6;
+  /**
+   * Adapt rho to balance the primal and dual residuals. The estimate is computed every rhoUpdateInterval iterations and the KKT
+   * matrix is refactorized if it differs from the current rho by more than the factor rhoUpdateTolerance.
+   */
+  bool adaptiveRho = true;
+  size_t rhoUpdateInterval = 50;
+  scalar_t rhoUpdateTolerance = 5.0;
+  /** Number of Ruzi pre-conditioning iterations on the KKT matrices. **/
+  size_t scalingIteration = 10;
+  /** Start from the solution and the dual variables of the previous call. **/
+  bool warmStart = true;
+  /** This value determines to display the a summary log. */
+  bool displayShortSummary = false;
+};
+
+/**
+ * Loads the ADMM settings from a given file.
+ *
+ * @param [in] filename: File name which contains the configuration data.
+ * @param [in] fieldName: Field name which contains the configuration data.
+ * @param [in] verbose: Flag to determine whether to print out the loaded settings or not.
+ * @return The settings
+ */
+Settings loadSettings(const std::string& filename, const std::string& fieldName = "admm", bool verbose = true);
+
+}  // namespace admm
+}  // namespace ocs2
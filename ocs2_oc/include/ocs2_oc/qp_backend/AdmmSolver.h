@@ -0,0 +1,119 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <Eigen/Sparse>
+#include <Eigen/SparseCholesky>
+
+#include <ocs2_core/Types.h>
+
+#include "ocs2_oc/qp_backend/AdmmSettings.h"
+#include "ocs2_oc/qp_backend/OcpQpBackend.h"
+
+namespace ocs2 {
+
+/**
+ * ADMM solver for sparse convex QPs of the form
+ *
+ * min_{x} 0.5 x' P x + q' x
+ * s.t.    l <= A x <= u
+ *
+ * following the operator splitting of "OSQP: an operator splitting solver for quadratic programs", https://arxiv.org/abs/1711.08013.
+ * Each iteration solves the quasi-definite KKT system [P + sigma I, A'; A, -diag(1/rho)] with a cached LDLT factorization. The
+ * symbolic analysis is only repeated if the sparsity pattern of P or A changes, and the numeric factorization only if the matrices
+ * or rho change.
+ */
+class AdmmSolver {
+ public:
+  /**
+   * Constructor.
+   * @param[in] settings: ADMM settings
+   */
+  explicit AdmmSolver(admm::Settings settings);
+
+  /**
+   * Sets the matrices of the QP. The KKT matrix is factorized in the next solve call.
+   * @param[in] P: The full (not only the upper triangle) symmetric positive semi-definite cost hessian.
+   * @param[in] A: The constraint matrix.
+   */
+  void setMatrices(const Eigen::SparseMatrix<scalar_t>& P, const Eigen::SparseMatrix<scalar_t>& A);
+
+  /**
+   * Solves the QP with the matrices of the last setMatrices call.
+   *
+   * @param[in] q: The cost gradient.
+   * @param[in] l: The constraint lower bound. Equal lower and upper bounds define an equality constraint.
+   * @param[in] u: The constraint upper bound.
+   * @param[in, out] x: The primal solution. A vector of the correct size is used as the initial guess.
+   * @param[in, out] y: The dual solution. A vector of the correct size is used as the initial guess.
+   * @return The solver status.
+   */
+  OcpQpBackend::Status solve(const vector_t& q, const vector_t& l, const vector_t& u, vector_t& x, vector_t& y);
+
+  const admm::Settings& settings() const { return settings_; }
+  size_t getNumIterations() const { return numIterations_; }
+  size_t getNumFactorizations() const { return numFactorizations_; }
+  scalar_t getRho() const { return rho_; }
+
+ private:
+  void analyzePattern(const Eigen::SparseMatrix<scalar_t>& P, const Eigen::SparseMatrix<scalar_t>& A);
+  void setRhoVector(const vector_t& l, const vector_t& u);
+  bool factorize();
+  void computeResiduals(const vector_t& q, const vector_t& x, const vector_t& y);
+
+  const admm::Settings settings_;
+  scalar_t rho_;
+
+  // Pattern of the last matrices
+  Eigen::SparseMatrix<scalar_t> P_, A_;
+
+  // Lower triangle of the KKT matrix and the positions of the entries of P, A, and the diagonal in its value array
+  Eigen::SparseMatrix<scalar_t> kkt_;
+  std::vector<int> kktIndexOfP_;  // -1 for the entries of the upper triangle of P
+  std::vector<int> kktIndexOfA_;
+  std::vector<int> kktIndexOfDiagonal_;
+  Eigen::SimplicialLDLT<Eigen::SparseMatrix<scalar_t>, Eigen::Lower> ldlt_;
+
+  bool isFactorized_ = false;
+
+  // Per row penalty
+  vector_t rhoVector_, rhoInvVector_;
+
+  // Residuals and their normalization of the last check
+  scalar_t primalResidual_, dualResidual_, primalScale_, dualScale_;
+
+  // Iteration buffers
+  vector_t z_, rhs_, zTilde_, Ax_, Px_, ATy_;
+
+  size_t numIterations_ = 0;
+  size_t numFactorizations_ = 0;
+};
+
+}  // namespace ocs2
@@ -0,0 +1,101 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <string>
+
+#include <ocs2_core/Types.h>
+
+#include "ocs2_oc/oc_problem/OcpSize.h"
+
+namespace ocs2 {
+
+/**
+ * Interface of a solver for the QP subproblem of the multiple-shooting solvers:
+ *
+ * min_{x, u} sum_k 0.5 [x_k; u_k]' H_k [x_k; u_k] + h_k' [x_k; u_k]
+ * s.t.       x_{k+1} = A_k x_k + B_k u_k + b_k,    x_0 given
+ *            C_k x_k + D_k u_k + e_k = 0
+ */
+class OcpQpBackend {
+ public:
+  enum class Status {
+    SUCCESS,
+    MAX_ITER,
+    NUMERICAL_ERROR,
+  };
+
+  virtual ~OcpQpBackend() = default;
+
+  /** Name of the backend, e.g. for printing. */
+  virtual std::string name() const = 0;
+
+  /**
+   * Resizes the internal data to the given problem size.
+   * @param[in] ocpSize: The size of optimal control problem.
+   */
+  virtual void resize(const OcpSize& ocpSize) = 0;
+
+  /**
+   * Solves the QP.
+   *
+   * @param[in] x0: The initial state.
+   * @param[in] dynamics: Linear approximation of the dynamics over the time horizon.
+   * @param[in] cost: Quadratic approximation of the cost over the time horizon.
+   * @param[in] constraints: Linear approximation of the equality constraints over the time horizon. Pass nullptr if there is no
+   *                         constraints.
+   * @param[out] stateTrajectory: The optimal state trajectory, including x0.
+   * @param[out] inputTrajectory: The optimal input trajectory.
+   * @return The solver status.
+   */
+  virtual Status solve(const vector_t& x0, const std::vector<VectorFunctionLinearApproximation>& dynamics,
+                       const std::vector<ScalarFunctionQuadraticApproximation>& cost,
+                       const std::vector<VectorFunctionLinearApproximation>* constraints, vector_array_t& stateTrajectory,
+                       vector_array_t& inputTrajectory) = 0;
+
+  /** Number of iterations of the last solve call. */
+  virtual size_t getNumIterations() const = 0;
+};
+
+/** Transforms OcpQpBackend::Status to string */
+inline std::string toString(OcpQpBackend::Status s) {
+  switch (s) {
+    case OcpQpBackend::Status::SUCCESS:
+      return std::string("SUCCESS");
+    case OcpQpBackend::Status::MAX_ITER:
+      return std::string("MAX_ITER");
+    case OcpQpBackend::Status::NUMERICAL_ERROR:
+      return std::string("NUMERICAL_ERROR");
+    default:
+      return std::string("UNDEFINED");
+  }
+}
+
+}  // namespace ocs2
@@ -0,0 +1,126 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <ocs2_core/Types.h>
+#include <ocs2_core/control/ControllerBase.h>
+#include <ocs2_core/reference/ModeSchedule.h>
+#include <ocs2_core/thread_support/ThreadPool.h>
+
+#include "ocs2_oc/oc_data/PrimalSolution.h"
+#include "ocs2_oc/rollout/RolloutBase.h"
+
+namespace ocs2 {
+
+/**
+ * This class integrates a batch of independent rollouts of the same system over the same time interval. Each worker owns a
+ * clone of the given rollout and the batch is split into contiguous blocks, one block per worker, such that the trajectories
+ * of a block are integrated back to back on the same thread and the same integrator memory.
+ */
+class BatchRollout {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param [in] rollout: The rollout which is cloned for each worker.
+   * @param [in] nThreads: The number of threads used for the batch (including the calling thread).
+   * @param [in] threadPriority: The priority of the worker threads.
+   */
+  BatchRollout(const RolloutBase& rollout, size_t nThreads, int threadPriority = 50);
+
+  ~BatchRollout() = default;
+  BatchRollout(const BatchRollout&) = delete;
+  BatchRollout& operator=(const BatchRollout&) = delete;
+
+  /** Returns the number of workers (including the calling thread). */
+  size_t numWorkers() const { return rolloutPtrs_.size(); }
+
+  /** Returns the rollout of the given worker. */
+  RolloutBase& getRollout(size_t workerIndex) { return *rolloutPtrs_[workerIndex]; }
+
+  /** Kills all the ongoing rollouts. */
+  void abortRollout();
+
+  /** Enables the rollouts to start again. */
+  void reactivateRollout();
+
+  /**
+   * Sets the control policy which is shared by the whole batch. Since computeInput is not required to be thread-safe, the policy
+   * is cloned once per worker here rather than on every run. Therefore, it should be set again whenever the policy changes.
+   *
+   * @param [in] controller: The shared control policy.
+   */
+  void setSharedController(const ControllerBase& controller);
+
+  /**
+   * Forward integrates the system dynamics for a batch of initial states in the time period [initTime, finalTime] under the
+   * shared control policy (see setSharedController).
+   *
+   * @param [in] initTime: The initial time.
+   * @param [in] initStateBatch: The batch of initial states.
+   * @param [in] finalTime: The final time.
+   * @param [in] modeSchedule: The mode schedule. For StateTriggeredRollout, each solution contains the detected mode schedule.
+   * @param [out] solutionBatch: The rolled-out trajectories, one per initial state. The controllers of the solutions are not set.
+   * @return The final states (state jump is considered if it took place).
+   */
+  vector_array_t run(scalar_t initTime, const vector_array_t& initStateBatch, scalar_t finalTime, const ModeSchedule& modeSchedule,
+                     std::vector<PrimalSolution>& solutionBatch);
+
+  /**
+   * Forward integrates the system dynamics for a batch of initial states in the time period [initTime, finalTime], with one
+   * control policy per initial state.
+   *
+   * @param [in] initTime: The initial time.
+   * @param [in] initStateBatch: The batch of initial states.
+   * @param [in] finalTime: The final time.
+   * @param [in] controllerBatch: The control policies, one per initial state.
+   * @param [in] modeSchedule: The mode schedule. For StateTriggeredRollout, each solution contains the detected mode schedule.
+   * @param [out] solutionBatch: The rolled-out trajectories, one per initial state. The controllers of the solutions are not set.
+   * @return The final states (state jump is considered if it took place).
+   */
+  vector_array_t run(scalar_t initTime, const vector_array_t& initStateBatch, scalar_t finalTime,
+                     const std::vector<ControllerBase*>& controllerBatch, const ModeSchedule& modeSchedule,
+                     std::vector<PrimalSolution>& solutionBatch);
+
+ private:
+  /** Runs the batch where getController(workerIndex, i) returns the controller of the i-th initial state. */
+  template <typename GetController>
+  vector_array_t runBatch(scalar_t initTime, const vector_array_t& initStateBatch, scalar_t finalTime, GetController getController,
+                          const ModeSchedule& modeSchedule, std::vector<PrimalSolution>& solutionBatch);
+
+  ThreadPool threadPool_;
+  std::vector<std::unique_ptr<RolloutBase>> rolloutPtrs_;
+  std::vector<std::unique_ptr<ControllerBase>> sharedControllerPtrs_;
+};
+
+}  // namespace ocs2
@@ -69,6 +69,9 @@ struct Settings {
   /** This value determines the maximum number of iterations, per event, allowed in state triggered rollout to find
    *  the guard surface zero crossing.  */
   int maxSingleEventIterations = 10;
+  /** Whether state triggered rollout locates the guard surface crossings within the integration step which detected the event,
+   *  instead of refining the crossing by re-integrating the segment. */
+  bool useDenseOutputEventLocalization = false;
   /** Whether to use the trajectory spreading controller in state triggered rollout */
   bool useTrajectorySpreadingController = false;
 };
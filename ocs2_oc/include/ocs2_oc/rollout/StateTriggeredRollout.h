@@ -69,6 +69,19 @@ class StateTriggeredRollout : public RolloutBase {
                vector_array_t& inputTrajectory) override;
 
  private:
+  /**
+   * Locates the earliest guard surface crossing within the last accepted integration step. The crossing is first estimated on the
+   * cubic Hermite interpolant of the step and then refined by single 5th order steps from the beginning of the step, therefore
+   * the segment is not re-integrated. The last element of the trajectory, which is past the guard surface, is replaced by the
+   * event time and state.
+   *
+   * @param [in] guardSurfacesBefore: The guard surfaces values at the beginning of the step.
+   * @param [in, out] timeTrajectory: The time trajectory stamp.
+   * @param [in, out] stateTrajectory: The state trajectory.
+   * @return The ID of the triggered guard surface.
+   */
+  size_t locateEventWithinStep(const vector_t& guardSurfacesBefore, scalar_array_t& timeTrajectory, vector_array_t& stateTrajectory);
+
   std::unique_ptr<PreComputation> preCompPtr_;
   std::unique_ptr<ControlledSystemBase> systemDynamicsPtr_;
 
@@ -29,6 +29,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <deque>
+#include <utility>
+
 #include <ocs2_core/Types.h>
 #include <ocs2_oc/oc_data/PerformanceIndex.h>
 
@@ -40,6 +43,11 @@ namespace ocs2 {
  * https://link.springer.com/article/10.1007/s10107-004-0559-y
  *
  * step acceptance criteria with c = costs, g = the norm of constraint violation, and w = [x; u]
+ *
+ * In addition to the baseline, a step has to be acceptable to the filter, i.e., the history of the (c, g) pairs of the previous
+ * iterates that were accepted without the Armijo condition. A step is rejected if, for any filter entry j,
+ * c{i+1} >= c{j} - gamma_c * g{j} AND g{i+1} >= (1-gamma_c) * g{j}. The history is bounded by maxHistory, with the oldest entries
+ * dropped first. With maxHistory = 0, steps are only compared against the baseline.
  */
 struct FilterLinesearch {
   enum class StepType { UNKNOWN, CONSTRAINT, DUAL, COST, ZERO };
@@ -48,6 +56,7 @@ struct FilterLinesearch {
   scalar_t g_min = 1e-6;         // (2): ELSE IF (g{i} < g_min AND g{i+1} < g_min AND dc/dw'{i} * delta_w < 0) REQUIRE Armijo condition
   scalar_t gamma_c = 1e-6;       // (3): ELSE REQUIRE c{i+1} < (c{i} - gamma_c * g{i}) OR g{i+1} < (1-gamma_c) * g{i}
   scalar_t armijoFactor = 1e-4;  // Armijo condition: c{i+1} < c{i} + armijoFactor * armijoDescentMetric{i}
+  size_t maxHistory = 0;         // Maximum number of entries in the filter
 
   /**
    * Checks that the step is accepted.
@@ -59,10 +68,31 @@ struct FilterLinesearch {
   std::pair<bool, StepType> acceptStep(const PerformanceIndex& baselinePerformance, const PerformanceIndex& stepPerformance,
                                        scalar_t armijoDescentMetric) const;
 
+  /**
+   * Augments the filter with the baseline of an accepted step. Steps accepted with the Armijo condition (StepType::COST) and zero
+   * steps do not augment the filter.
+   *
+   * @param [in] baselinePerformance : The zero step PerformanceIndex
+   * @param [in] stepType : The type of the accepted step
+   */
+  void augmentFilter(const PerformanceIndex& baselinePerformance, StepType stepType);
+
+  /** Checks that the step is not dominated by any entry of the filter */
+  bool isAcceptableToFilter(const PerformanceIndex& stepPerformance) const;
+
+  /** Clears the filter, e.g. at the start of a new problem */
+  void clearFilter() { filter_.clear(); }
+
+  /** Number of entries in the filter */
+  size_t filterSize() const { return filter_.size(); }
+
   /** Compute total constraint violation */
   static scalar_t totalConstraintViolation(const PerformanceIndex& performance) {
     return std::sqrt(performance.dynamicsViolationSSE + performance.equalityConstraintsSSE);
   }
+
+ private:
+  std::deque<std::pair<scalar_t, scalar_t>> filter_;  // (merit, constraint violation) pairs with the gamma_c margins applied
 };
 
 /** Transforms the StepType to string */
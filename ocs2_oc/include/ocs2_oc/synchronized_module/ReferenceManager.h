@@ -29,7 +29,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
-#include "ocs2_core/thread_support/BufferedValue.h"
+#include "ocs2_core/thread_support/BufferedSnapshot.h"
 #include "ocs2_oc/synchronized_module/ReferenceManagerInterface.h"
 
 namespace ocs2 {
@@ -37,6 +37,9 @@ namespace ocs2 {
 /**
  * Implements the reference manager with a thread-safe buffer for setting and getting the references.
  * A protected virtual interface is provided to modify the references before each solver run.
+ *
+ * The active references are kept in copy-on-write snapshots: setting a reference and activating it in preSolverRun() are pointer
+ * swaps, and snapshots of the active references can be held across solver runs without copying them.
  */
 class ReferenceManager : public ReferenceManagerInterface {
  public:
@@ -48,10 +51,12 @@ class ReferenceManager : public ReferenceManagerInterface {
   void preSolverRun(scalar_t initTime, scalar_t finalTime, const vector_t& initState) override;
 
   const ModeSchedule& getModeSchedule() const override { return modeSchedule_.get(); }
+  std::shared_ptr<const ModeSchedule> getModeScheduleSnapshot() const override { return modeSchedule_.getSnapshot(); }
   void setModeSchedule(const ModeSchedule& modeSchedule) override { modeSchedule_.setBuffer(modeSchedule); }
   void setModeSchedule(ModeSchedule&& modeSchedule) override { modeSchedule_.setBuffer(std::move(modeSchedule)); }
 
   const TargetTrajectories& getTargetTrajectories() const override { return targetTrajectories_.get(); }
+  std::shared_ptr<const TargetTrajectories> getTargetTrajectoriesSnapshot() const override { return targetTrajectories_.getSnapshot(); }
   void setTargetTrajectories(const TargetTrajectories& targetTrajectories) override {
     return targetTrajectories_.setBuffer(targetTrajectories);
   }
@@ -59,6 +64,12 @@ class ReferenceManager : public ReferenceManagerInterface {
     return targetTrajectories_.setBuffer(std::move(targetTrajectories));
   }
 
+  /** The number of times the active ModeSchedule has been replaced by a set value. */
+  size_t getModeScheduleVersion() const { return modeSchedule_.version(); }
+
+  /** The number of times the active TargetTrajectories has been replaced by a set value. */
+  size_t getTargetTrajectoriesVersion() const { return targetTrajectories_.version(); }
+
  protected:
   /**
    * Modifies the active ModeSchedule and TargetTrajectories.
@@ -70,13 +81,15 @@ class ReferenceManager : public ReferenceManagerInterface {
    * TargetTrajectories is already updated by the set value.
    * @param [in, out] modeSchedule : The updated ModeSchedule. If setModeSchedule() has been called before, modeSchedule is
    * already updated by the set value.
+   *
+   * @note The references are copied before the modification only if a snapshot of them is still held.
    */
   virtual void modifyReferences(scalar_t initTime, scalar_t finalTime, const vector_t& initState, TargetTrajectories& targetTrajectories,
                                 ModeSchedule& modeSchedule) {}
 
  private:
-  BufferedValue<ModeSchedule> modeSchedule_;
-  BufferedValue<TargetTrajectories> targetTrajectories_;
+  BufferedSnapshot<ModeSchedule> modeSchedule_;
+  BufferedSnapshot<TargetTrajectories> targetTrajectories_;
 };
 
 }  // namespace ocs2
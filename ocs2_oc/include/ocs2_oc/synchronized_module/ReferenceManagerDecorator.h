@@ -53,10 +53,14 @@ class ReferenceManagerDecorator : public ReferenceManagerInterface {
   }
 
   const ModeSchedule& getModeSchedule() const override { return referenceManagerPtr_->getModeSchedule(); }
+  std::shared_ptr<const ModeSchedule> getModeScheduleSnapshot() const override { return referenceManagerPtr_->getModeScheduleSnapshot(); }
   void setModeSchedule(const ModeSchedule& modeSchedule) override { referenceManagerPtr_->setModeSchedule(modeSchedule); }
   void setModeSchedule(ModeSchedule&& modeSchedule) override { referenceManagerPtr_->setModeSchedule(std::move(modeSchedule)); }
 
   const TargetTrajectories& getTargetTrajectories() const override { return referenceManagerPtr_->getTargetTrajectories(); }
+  std::shared_ptr<const TargetTrajectories> getTargetTrajectoriesSnapshot() const override {
+    return referenceManagerPtr_->getTargetTrajectoriesSnapshot();
+  }
   void setTargetTrajectories(const TargetTrajectories& targetTrajectories) override {
     referenceManagerPtr_->setTargetTrajectories(targetTrajectories);
   }
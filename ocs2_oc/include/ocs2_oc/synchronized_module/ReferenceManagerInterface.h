@@ -29,6 +29,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <memory>
+
 #include <ocs2_core/Types.h>
 #include <ocs2_core/reference/ModeSchedule.h>
 #include <ocs2_core/reference/TargetTrajectories.h>
@@ -64,6 +66,12 @@ class ReferenceManagerInterface {
   /** Returns a const reference to the active ModeSchedule. */
   virtual const ModeSchedule& getModeSchedule() const = 0;
 
+  /**
+   * Returns a snapshot of the active ModeSchedule which remains unchanged after the next preSolverRun(). The default
+   * implementation copies the active ModeSchedule.
+   */
+  virtual std::shared_ptr<const ModeSchedule> getModeScheduleSnapshot() const { return std::make_shared<ModeSchedule>(getModeSchedule()); }
+
   /**
    * Sets the ModeSchedule to the buffer. The buffer will move to active ModeSchedule once preSolverRun() is called.
    * @note: This method must be thread safe.
@@ -79,6 +87,14 @@ class ReferenceManagerInterface {
   /** Returns a const reference to the active TargetTrajectories. */
   virtual const TargetTrajectories& getTargetTrajectories() const = 0;
 
+  /**
+   * Returns a snapshot of the active TargetTrajectories which remains unchanged after the next preSolverRun(). The default
+   * implementation copies the active TargetTrajectories.
+   */
+  virtual std::shared_ptr<const TargetTrajectories> getTargetTrajectoriesSnapshot() const {
+    return std::make_shared<TargetTrajectories>(getTargetTrajectories());
+  }
+
   /**
    * Sets the TargetTrajectories to the buffer. The buffer will move to active ModeSchedule once preSolverRun() is called.
    * @note: This method must be thread safe.
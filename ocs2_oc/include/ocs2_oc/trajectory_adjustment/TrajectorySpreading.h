@@ -29,7 +29,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
 #include <ocs2_core/Types.h>
+#include <ocs2_core/misc/ContiguousArray.h>
 #include <ocs2_core/reference/ModeSchedule.h>
 
 namespace ocs2 {
@@ -69,6 +73,10 @@ class TrajectorySpreading final {
   template <typename T>
   void adjustTrajectory(std::vector<T>& trajectory) const;
 
+  /** Same as adjustTrajectory for std::vector. */
+  template <typename Data>
+  void adjustTrajectory(ContiguousArray<Data>& trajectory) const;
+
   /**
    * Extracts event-time data.
    *
@@ -79,6 +87,10 @@ class TrajectorySpreading final {
   template <typename T>
   std::vector<T> extractEventsArray(const std::vector<T>& array) const;
 
+  /** Same as extractEventsArray for std::vector. */
+  template <typename Data>
+  ContiguousArray<Data> extractEventsArray(const ContiguousArray<Data>& array) const;
+
   /**
    * Adjust time stamp of the trajectories and post event indices of the trajectories.
    *
@@ -145,6 +157,8 @@ class TrajectorySpreading final {
   size_array_t beginIndices_;
   size_array_t endIndices_;
   size_array_t spreadingValueIndices_;
+  std::vector<bool> isSpreadingValueOverwritten_; /**< Whether the spreading value is in the interval of another spreading **/
+  size_t numOverwrittenSpreadingValues_ = 0;
 
   size_array_t updatedPostEventIndices_;
   scalar_array_t updatedMatchedEventTimes_;
@@ -169,17 +183,67 @@ void TrajectorySpreading::adjustTrajectory(std::vector<T>& trajectory) const {
   // erase segment of trajectory associated to mismatched modes
   trajectory.erase(trajectory.begin() + eraseFromIndex_, trajectory.end());
 
-  // extract spreading values beforehand since they might be overridden
-  std::vector<T> spreadingValues(spreadingValueIndices_.size());
-  std::transform(spreadingValueIndices_.begin(), spreadingValueIndices_.end(), spreadingValues.begin(),
-                 [&](const size_t& ind) { return trajectory[ind]; });
+  // extract beforehand only the spreading values which are overridden by another spreading
+  std::vector<T> overwrittenValues;
+  overwrittenValues.reserve(numOverwrittenSpreadingValues_);
+  for (size_t i = 0; i < spreadingValueIndices_.size(); i++) {
+    if (isSpreadingValueOverwritten_[i]) {
+      overwrittenValues.push_back(trajectory[spreadingValueIndices_[i]]);
+    }
+  }
+
+  // spread in place
+  auto overwrittenValueItr = overwrittenValues.cbegin();
+  for (size_t i = 0; i < spreadingValueIndices_.size(); i++) {
+    const T& value = isSpreadingValueOverwritten_[i] ? *(overwrittenValueItr++) : trajectory[spreadingValueIndices_[i]];
+    std::fill(trajectory.begin() + beginIndices_[i], trajectory.begin() + endIndices_[i], value);
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+template <typename Data>
+ContiguousArray<Data> TrajectorySpreading::extractEventsArray(const ContiguousArray<Data>& array) const {
+  ContiguousArray<Data> out;
+  for (size_t i = keepEventDataInInterval_.first; i < keepEventDataInInterval_.second; i++) {
+    out.push_back(array[i]);
+  }
+  return out;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+template <typename Data>
+void TrajectorySpreading::adjustTrajectory(ContiguousArray<Data>& trajectory) const {
+  // erase segment of trajectory associated to mismatched modes
+  trajectory.truncate(eraseFromIndex_);
 
-  // spread
+  // extract beforehand only the spreading values which are overridden by another spreading
+  std::vector<Data> overwrittenValues;
+  overwrittenValues.reserve(numOverwrittenSpreadingValues_);
   for (size_t i = 0; i < spreadingValueIndices_.size(); i++) {
-    for (size_t j = beginIndices_[i]; j < endIndices_[i]; j++) {
-      trajectory[j] = spreadingValues[i];
-    }  // end of i loop
-  }    // end of j loop
+    if (isSpreadingValueOverwritten_[i]) {
+      overwrittenValues.emplace_back(trajectory[spreadingValueIndices_[i]]);
+    }
+  }
+
+  // spread in place
+  auto overwrittenValueItr = overwrittenValues.cbegin();
+  for (size_t i = 0; i < spreadingValueIndices_.size(); i++) {
+    if (isSpreadingValueOverwritten_[i]) {
+      for (size_t j = beginIndices_[i]; j < endIndices_[i]; j++) {
+        trajectory[j] = *overwrittenValueItr;
+      }
+      ++overwrittenValueItr;
+    } else {
+      const auto value = trajectory[spreadingValueIndices_[i]];
+      for (size_t j = beginIndices_[i]; j < endIndices_[i]; j++) {
+        trajectory[j] = value;
+      }
+    }
+  }
 }
 
 }  // namespace ocs2
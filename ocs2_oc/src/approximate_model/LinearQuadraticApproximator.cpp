@@ -53,8 +53,9 @@ void approximateIntermediateLQ(OptimalControlProblem& problem, const scalar_t ti
   modelData.dynamics = problem.dynamicsPtr->linearApproximation(time, state, input, preComputation);
   modelData.dynamicsBias.setZero(modelData.dynamics.dfdx.rows());
 
-  // Cost
-  modelData.cost = ocs2::approximateCost(problem, time, state, input);
+  // Cost: all the terms accumulate into the buffer of the node, which keeps its memory when the sizes do not change
+  modelData.cost.setZero(state.rows(), input.rows());
+  ocs2::accumulateCost(problem, time, state, input, modelData.cost);
 
   // Equality constraints
   modelData.stateEqConstraint = problem.stateEqualityConstraintPtr->getLinearApproximation(time, state, preComputation);
@@ -180,32 +181,26 @@ scalar_t computeCost(const OptimalControlProblem& problem, const scalar_t& time,
 /******************************************************************************************************/
 ScalarFunctionQuadraticApproximation approximateCost(const OptimalControlProblem& problem, const scalar_t& time, const vector_t& state,
                                                      const vector_t& input) {
+  auto cost = ScalarFunctionQuadraticApproximation::Zero(state.rows(), input.rows());
+  accumulateCost(problem, time, state, input, cost);
+  return cost;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void accumulateCost(const OptimalControlProblem& problem, const scalar_t& time, const vector_t& state, const vector_t& input,
+                    ScalarFunctionQuadraticApproximation& cost) {
   const auto& targetTrajectories = *problem.targetTrajectoriesPtr;
   const auto& preComputation = *problem.preComputationPtr;
 
-  // get the state-input cost approximations
-  auto cost = problem.costPtr->getQuadraticApproximation(time, state, input, targetTrajectories, preComputation);
+  // state-input cost and soft constraint terms
+  problem.costPtr->accumulateQuadraticApproximation(time, state, input, targetTrajectories, preComputation, cost);
+  problem.softConstraintPtr->accumulateQuadraticApproximation(time, state, input, targetTrajectories, preComputation, cost);
 
-  if (!problem.softConstraintPtr->empty()) {
-    cost += problem.softConstraintPtr->getQuadraticApproximation(time, state, input, targetTrajectories, preComputation);
-  }
-
-  // get the state only cost approximations
-  if (!problem.stateCostPtr->empty()) {
-    auto stateCost = problem.stateCostPtr->getQuadraticApproximation(time, state, targetTrajectories, preComputation);
-    cost.f += stateCost.f;
-    cost.dfdx += stateCost.dfdx;
-    cost.dfdxx += stateCost.dfdxx;
-  }
-
-  if (!problem.stateSoftConstraintPtr->empty()) {
-    auto stateCost = problem.stateSoftConstraintPtr->getQuadraticApproximation(time, state, targetTrajectories, preComputation);
-    cost.f += stateCost.f;
-    cost.dfdx += stateCost.dfdx;
-    cost.dfdxx += stateCost.dfdxx;
-  }
-
-  return cost;
+  // state-only cost and soft constraint terms
+  problem.stateCostPtr->accumulateQuadraticApproximation(time, state, targetTrajectories, preComputation, cost);
+  problem.stateSoftConstraintPtr->accumulateQuadraticApproximation(time, state, targetTrajectories, preComputation, cost);
 }
 
 /******************************************************************************************************/
@@ -53,13 +53,21 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_oc/oc_problem/OcpToKkt.h>
 #include <ocs2_oc/oc_problem/OptimalControlProblem.h>
 #include <ocs2_oc/oc_problem/OptimalControlProblemHelperFunction.h>
+#include <ocs2_oc/oc_problem/SparseKktAssembler.h>
 
 // oc_solver
+#include <ocs2_oc/oc_solver/ContinuationInitializer.h>
 #include <ocs2_oc/oc_solver/SolverBase.h>
 
 // precondition
 #include <ocs2_oc/precondition/Ruzi.h>
 
+// qp_backend
+#include <ocs2_oc/qp_backend/AdmmQpBackend.h>
+#include <ocs2_oc/qp_backend/AdmmSettings.h>
+#include <ocs2_oc/qp_backend/AdmmSolver.h>
+#include <ocs2_oc/qp_backend/OcpQpBackend.h>
+
 // synchronized_module
 #include <ocs2_oc/synchronized_module/LoopshapingReferenceManager.h>
 #include <ocs2_oc/synchronized_module/LoopshapingSynchronizedModule.h>
@@ -70,6 +78,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_oc/synchronized_module/SolverSynchronizedModule.h>
 
 // rollout
+#include <ocs2_oc/rollout/BatchRollout.h>
 #include <ocs2_oc/rollout/InitializerRollout.h>
 #include <ocs2_oc/rollout/RolloutBase.h>
 #include <ocs2_oc/rollout/RolloutSettings.h>
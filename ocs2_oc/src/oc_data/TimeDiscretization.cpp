@@ -128,7 +128,7 @@ scalar_array_t toInterpolationTime(const std::vector<AnnotatedTime>& annotatedTi
   }
   scalar_array_t timeTrajectory;
   timeTrajectory.reserve(annotatedTime.size());
-  timeTrajectory.push_back(annotatedTime.back().time - numeric_traits::limitEpsilon<scalar_t>());
+  timeTrajectory.push_back(annotatedTime.front().time);
   for (int i = 1; i < annotatedTime.size() - 1; i++) {
     if (annotatedTime[i].event == AnnotatedTime::Event::PostEvent) {
       timeTrajectory.push_back(getInterpolationTime(annotatedTime[i]));
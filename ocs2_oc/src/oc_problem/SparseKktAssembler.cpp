@@ -0,0 +1,274 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_oc/oc_problem/SparseKktAssembler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+
+namespace ocs2 {
+
+namespace {
+using Triplets = std::vector<Eigen::Triplet<scalar_t>>;
+
+void emplaceBackDenseBlock(int startRow, int startCol, int rows, int cols, Triplets& triplets) {
+  for (int j = 0; j < cols; j++) {
+    for (int i = 0; i < rows; i++) {
+      triplets.emplace_back(startRow + i, startCol + j, 1.0);
+    }
+  }
+}
+
+void emplaceBackDiagonal(int startRow, int startCol, int size, Triplets& triplets) {
+  for (int i = 0; i < size; i++) {
+    triplets.emplace_back(startRow + i, startCol + i, 1.0);
+  }
+}
+
+/** Writes the segment into the value array of the sparse matrix and returns the next write position. */
+template <typename Derived>
+scalar_t* scatter(const Eigen::MatrixBase<Derived>& segment, scalar_t* valuePtr) {
+  Eigen::Map<vector_t>(valuePtr, segment.size()) = segment;
+  return valuePtr + segment.size();
+}
+}  // namespace
+
+void SparseKktAssembler::resize(const OcpSize& ocpSize) {
+  if (ocpSize_ == ocpSize) {
+    return;
+  }
+  const int N = ocpSize.numStages;
+  if (N < 1) {
+    throw std::runtime_error("[SparseKktAssembler::resize] The number of stages cannot be less than 1.");
+  }
+  ocpSize_ = ocpSize;
+
+  stageColumn_.resize(N + 1);
+  stageColumn_[0] = 0;
+  for (int k = 0; k < N; k++) {
+    stageColumn_[k + 1] = stageColumn_[k] + ocpSize.numInputs[k] + ocpSize.numStates[k + 1];
+  }
+  const int numDecisionVariables = stageColumn_[N];
+
+  resizeConstraintPattern(ocpSize, false, dynamicsPattern_);
+  resizeConstraintPattern(ocpSize, true, dynamicsAndConstraintsPattern_);
+
+  // H : R0 followed by dense [Q, P'; P, R] blocks of the intermediate nodes and Q{n+1}
+  Triplets triplets;
+  const int nu_0 = ocpSize.numInputs[0];
+  emplaceBackDenseBlock(0, 0, nu_0, nu_0, triplets);
+  for (int k = 1; k <= N; ++k) {
+    const int nxu_k = ocpSize.numStates[k] + (k < N ? ocpSize.numInputs[k] : 0);
+    const int blockStart = stageColumn_[k - 1] + ocpSize.numInputs[k - 1];
+    emplaceBackDenseBlock(blockStart, blockStart, nxu_k, nxu_k, triplets);
+  }
+  costPattern_.resize(numDecisionVariables, numDecisionVariables);
+  costPattern_.setFromTriplets(triplets.begin(), triplets.end());
+}
+
+void SparseKktAssembler::resizeConstraintPattern(const OcpSize& ocpSize, bool withConstraints, ConstraintPattern& pattern) {
+  const int N = ocpSize.numStages;
+  const auto& nx = ocpSize.numStates;
+  const auto& nu = ocpSize.numInputs;
+  const auto& nc = ocpSize.numIneqConstraints;
+
+  pattern.dynamicsRow.resize(N + 1);
+  pattern.dynamicsRow[0] = 0;
+  for (int k = 0; k < N; k++) {
+    pattern.dynamicsRow[k + 1] = pattern.dynamicsRow[k] + nx[k + 1];
+  }
+  pattern.constraintRow.resize(N + 2);
+  pattern.constraintRow[0] = pattern.dynamicsRow[N];
+  for (int k = 0; k <= N; k++) {
+    pattern.constraintRow[k + 1] = pattern.constraintRow[k] + (withConstraints ? nc[k] : 0);
+  }
+
+  // G : [-B, I] blocks of the dynamics, -A of the next stage and [C, D] of the general constraints
+  Triplets triplets;
+  int col = 0;
+  for (int k = 0; k < N; k++) {
+    emplaceBackDenseBlock(pattern.dynamicsRow[k], col, nx[k + 1], nu[k], triplets);
+    col += nu[k];
+    emplaceBackDiagonal(pattern.dynamicsRow[k], col, nx[k + 1], triplets);
+    if (k + 1 < N) {
+      emplaceBackDenseBlock(pattern.dynamicsRow[k + 1], col, nx[k + 2], nx[k + 1], triplets);
+    }
+    col += nx[k + 1];
+  }
+  if (withConstraints) {
+    col = 0;
+    for (int k = 0; k <= N; k++) {
+      const int numCols = (k > 0 ? nx[k] : 0) + (k < N ? nu[k] : 0);
+      emplaceBackDenseBlock(pattern.constraintRow[k], col, nc[k], numCols, triplets);
+      col += numCols;
+    }
+  }
+  pattern.matrix.resize(pattern.constraintRow[N + 1], col);
+  pattern.matrix.setFromTriplets(triplets.begin(), triplets.end());
+}
+
+void SparseKktAssembler::assignPattern(const Eigen::SparseMatrix<scalar_t>& pattern, Eigen::SparseMatrix<scalar_t>& matrix) {
+  const bool hasPattern = matrix.isCompressed() && matrix.rows() == pattern.rows() && matrix.cols() == pattern.cols() &&
+                          matrix.nonZeros() == pattern.nonZeros() &&
+                          std::equal(pattern.outerIndexPtr(), pattern.outerIndexPtr() + pattern.outerSize() + 1, matrix.outerIndexPtr());
+  if (!hasPattern) {
+    matrix = pattern;
+  }
+}
+
+void SparseKktAssembler::getConstraintMatrix(ThreadPool& threadPool, const vector_t& x0,
+                                             const std::vector<VectorFunctionLinearApproximation>& dynamics,
+                                             const std::vector<VectorFunctionLinearApproximation>* constraintsPtr,
+                                             const vector_array_t* scalingVectorsPtr, Eigen::SparseMatrix<scalar_t>& G, vector_t& g) const {
+  const int N = ocpSize_.numStages;
+  if (N < 1) {
+    throw std::runtime_error("[SparseKktAssembler::getConstraintMatrix] The assembler is not resized.");
+  }
+  if (scalingVectorsPtr != nullptr && scalingVectorsPtr->size() != N) {
+    throw std::runtime_error("[SparseKktAssembler::getConstraintMatrix] The size of scalingVectors doesn't match the number of stage.");
+  }
+
+  const auto& pattern = (constraintsPtr == nullptr) ? dynamicsPattern_ : dynamicsAndConstraintsPattern_;
+  const auto& nx = ocpSize_.numStates;
+  const auto& nu = ocpSize_.numInputs;
+  const auto& nc = ocpSize_.numIneqConstraints;
+  assignPattern(pattern.matrix, G);
+  g.resize(G.rows());
+
+  const int* outerIndexPtr = G.outerIndexPtr();
+  scalar_t* valuePtr = G.valuePtr();
+
+  // Stage k writes the columns of [u_{k}; x_{k+1}], the dynamics rows of stage k, and the constraint rows of stage k+1.
+  std::atomic_int timeIndex{0};
+  auto task = [&](int workerId) {
+    int k;
+    while ((k = timeIndex++) < N) {
+      const auto& B_k = dynamics[k].dfdu;
+      const auto* constraints_k = (constraintsPtr != nullptr && nc[k] > 0) ? &(*constraintsPtr)[k] : nullptr;
+      const auto* constraints_next = (constraintsPtr != nullptr && nc[k + 1] > 0) ? &(*constraintsPtr)[k + 1] : nullptr;
+
+      // u_{k} columns : [-B_k; D_k]
+      for (int j = 0; j < nu[k]; j++) {
+        scalar_t* v = valuePtr + outerIndexPtr[stageColumn_[k] + j];
+        v = scatter(-B_k.col(j), v);
+        if (constraints_k != nullptr) {
+          scatter(constraints_k->dfdu.col(j), v);
+        }
+      }
+
+      // x_{k+1} columns : [I; -A_{k+1}; C_{k+1}]
+      for (int j = 0; j < nx[k + 1]; j++) {
+        scalar_t* v = valuePtr + outerIndexPtr[stageColumn_[k] + nu[k] + j];
+        *v++ = (scalingVectorsPtr == nullptr) ? 1.0 : (*scalingVectorsPtr)[k](j);
+        if (k + 1 < N) {
+          v = scatter(-dynamics[k + 1].dfdx.col(j), v);
+        }
+        if (constraints_next != nullptr) {
+          scatter(constraints_next->dfdx.col(j), v);
+        }
+      }
+
+      // g : [b_k] and [-e_{k+1}]
+      g.segment(pattern.dynamicsRow[k], nx[k + 1]) = dynamics[k].f;
+      if (constraints_next != nullptr) {
+        g.segment(pattern.constraintRow[k + 1], nc[k + 1]) = -constraints_next->f;
+      }
+    }
+  };
+  threadPool.runParallel(std::move(task), threadPool.numThreads() + 1U);
+
+  // Absorb the initial state into the first dynamics and constraints
+  g.head(nx[1]).noalias() += dynamics.front().dfdx * x0;
+  if (constraintsPtr != nullptr && nc[0] > 0) {
+    const auto& constraints_0 = constraintsPtr->front();
+    g.segment(pattern.constraintRow[0], nc[0]) = -constraints_0.f;
+    g.segment(pattern.constraintRow[0], nc[0]).noalias() -= constraints_0.dfdx * x0;
+  }
+}
+
+void SparseKktAssembler::getCostMatrix(ThreadPool& threadPool, const vector_t& x0,
+                                       const std::vector<ScalarFunctionQuadraticApproximation>& cost, Eigen::SparseMatrix<scalar_t>& H,
+                                       vector_t& h) const {
+  const int N = ocpSize_.numStages;
+  if (N < 1) {
+    throw std::runtime_error("[SparseKktAssembler::getCostMatrix] The assembler is not resized.");
+  }
+
+  const auto& nx = ocpSize_.numStates;
+  const auto& nu = ocpSize_.numInputs;
+  assignPattern(costPattern_, H);
+  h.resize(H.rows());
+
+  const int* outerIndexPtr = H.outerIndexPtr();
+  scalar_t* valuePtr = H.valuePtr();
+
+  // Node k writes the columns and the gradient of [x_{k}; u_{k}]. The initial state is not a decision variable.
+  std::atomic_int timeIndex{0};
+  auto task = [&](int workerId) {
+    int k;
+    while ((k = timeIndex++) <= N) {
+      const int nx_k = (k > 0) ? nx[k] : 0;
+      const int nu_k = (k < N) ? nu[k] : 0;
+      const int blockStart = (k > 0) ? stageColumn_[k - 1] + nu[k - 1] : 0;
+
+      // x_{k} columns : [Q; P]
+      for (int j = 0; j < nx_k; j++) {
+        scalar_t* v = valuePtr + outerIndexPtr[blockStart + j];
+        v = scatter(cost[k].dfdxx.col(j), v);
+        if (nu_k > 0) {
+          scatter(cost[k].dfdux.col(j), v);
+        }
+      }
+
+      // u_{k} columns : [P'; R]
+      for (int j = 0; j < nu_k; j++) {
+        scalar_t* v = valuePtr + outerIndexPtr[blockStart + nx_k + j];
+        if (nx_k > 0) {
+          v = scatter(cost[k].dfdux.row(j).transpose(), v);
+        }
+        scatter(cost[k].dfduu.col(j), v);
+      }
+
+      // h : [q; r]
+      if (nx_k > 0) {
+        h.segment(blockStart, nx_k) = cost[k].dfdx;
+      }
+      if (nu_k > 0) {
+        h.segment(blockStart + nx_k, nu_k) = cost[k].dfdu;
+      }
+    }
+  };
+  threadPool.runParallel(std::move(task), threadPool.numThreads() + 1U);
+
+  // Absorb the initial state into the first input gradient
+  h.head(nu[0]).noalias() += cost.front().dfdux * x0;
+}
+
+}  // namespace ocs2
@@ -0,0 +1,113 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_oc/oc_solver/ContinuationInitializer.h"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+#include <ocs2_core/control/LinearController.h>
+
+namespace ocs2 {
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+ContinuationInitializer::ContinuationInitializer(const Initializer& initializer, const SystemDynamicsBase& dynamics,
+                                                 SensitivityIntegratorType integratorType)
+    : initializerPtr_(initializer.clone()),
+      dynamicsPtr_(dynamics.clone()),
+      integratorType_(integratorType),
+      discretizer_(selectDynamicsDiscretization(integratorType)) {}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+ContinuationInitializer::ContinuationInitializer(const ContinuationInitializer& other)
+    : Initializer(other),
+      initializerPtr_(other.initializerPtr_->clone()),
+      dynamicsPtr_(other.dynamicsPtr_->clone()),
+      integratorType_(other.integratorType_),
+      discretizer_(selectDynamicsDiscretization(other.integratorType_)),
+      hasPolicy_(other.hasPolicy_),
+      policyStartTime_(other.policyStartTime_),
+      policyFinalTime_(other.policyFinalTime_),
+      finalState_(other.finalState_),
+      finalInput_(other.finalInput_),
+      finalGain_(other.finalGain_) {}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void ContinuationInitializer::setPolicy(const PrimalSolution& primalSolution) {
+  const auto& timeTrajectory = primalSolution.timeTrajectory_;
+  if (timeTrajectory.empty() || primalSolution.inputTrajectory_.empty() || primalSolution.inputTrajectory_.back().size() == 0) {
+    hasPolicy_ = false;
+    return;
+  }
+
+  const scalar_t finalTime = timeTrajectory.back();
+  finalState_ = primalSolution.stateTrajectory_.back();
+  finalInput_ = primalSolution.inputTrajectory_.back();
+
+  // the final gain of a linear controller, otherwise no feedback
+  const auto* linearControllerPtr = dynamic_cast<const LinearController*>(primalSolution.controllerPtr_.get());
+  if (linearControllerPtr != nullptr && !linearControllerPtr->empty()) {
+    finalGain_ = linearControllerPtr->gainArray_.back();
+  } else {
+    finalGain_.resize(0, 0);
+  }
+
+  // the mode of the final node
+  const auto& eventTimes = primalSolution.modeSchedule_.eventTimes;
+  const auto nextEventItr = std::upper_bound(eventTimes.begin(), eventTimes.end(), finalTime);
+  policyStartTime_ = (nextEventItr == eventTimes.begin()) ? std::numeric_limits<scalar_t>::lowest() : *std::prev(nextEventItr);
+  policyFinalTime_ = (nextEventItr == eventTimes.end()) ? std::numeric_limits<scalar_t>::max() : *nextEventItr;
+
+  hasPolicy_ = true;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void ContinuationInitializer::compute(scalar_t time, const vector_t& state, scalar_t nextTime, vector_t& input, vector_t& nextState) {
+  if (!hasPolicy_ || time < policyStartTime_ || nextTime > policyFinalTime_) {
+    initializerPtr_->compute(time, state, nextTime, input, nextState);
+    return;
+  }
+
+  input = finalInput_;
+  if (finalGain_.rows() == input.size() && finalGain_.cols() == state.size()) {
+    input.noalias() += finalGain_ * (state - finalState_);
+  }
+  nextState = discretizer_(*dynamicsPtr_, time, state, input, nextTime - time);
+}
+
+}  // namespace ocs2
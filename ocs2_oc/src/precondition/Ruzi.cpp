@@ -205,6 +205,103 @@ void scaleMatrixInPlace(const vector_t& rowScale, const vector_t& colScale, Eige
   }
 }
 
+/**
+ * Applies one Ruzi sweep with the given factors D and E to the OCP data, normalizes the cost, and accumulates the factors into
+ * DOut, EOut, and cOut.
+ */
+void ruziIterationInParallel(ThreadPool& threadPool, const vector_t& x0, const OcpSize& ocpSize, const vector_array_t& D,
+                             const vector_array_t& E, std::vector<VectorFunctionLinearApproximation>& dynamics,
+                             std::vector<ScalarFunctionQuadraticApproximation>& cost, vector_array_t& DOut, vector_array_t& EOut,
+                             vector_array_t& scalingVectors, scalar_t& cOut) {
+  const int N = ocpSize.numStages;
+  const auto numDecisionVariables = std::accumulate(ocpSize.numInputs.begin(), ocpSize.numInputs.end(), 0) +
+                                    std::accumulate(std::next(ocpSize.numStates.begin()), ocpSize.numStates.end(), 0);
+  std::atomic_int timeIndex{0};
+  const size_t numWorkers = threadPool.numThreads() + 1U;
+
+  scaleDataOneStepInPlaceInParallel(threadPool, D, E, dynamics, cost, scalingVectors);
+
+  timeIndex = 0;
+  scalar_array_t infNormOfhArray(numWorkers, 0.0);
+  scalar_array_t sumOfInfNormOfHArray(numWorkers, 0.0);
+  auto infNormOfh_sumOfInfNormOfH = [&](int workerId) {
+    scalar_t workerInfNormOfh = 0.0;
+    scalar_t workerSumOfInfNormOfH = 0.0;
+
+    int k = timeIndex++;
+    if (k == 0) {  // Only one worker will execute this
+      workerInfNormOfh = (cost[0].dfdu + cost[0].dfdux * x0).lpNorm<Eigen::Infinity>();
+      workerSumOfInfNormOfH = matrixInfNormCols(cost[0].dfduu).derived().sum();
+      k = timeIndex++;
+    }
+
+    while (k <= N) {
+      workerInfNormOfh = std::max(workerInfNormOfh, cost[k].dfdx.lpNorm<Eigen::Infinity>());
+      workerInfNormOfh = std::max(workerInfNormOfh, cost[k].dfdu.lpNorm<Eigen::Infinity>());
+      workerSumOfInfNormOfH += matrixInfNormCols(cost[k].dfdxx, cost[k].dfdux).derived().sum();
+      workerSumOfInfNormOfH += matrixInfNormCols(cost[k].dfdux.transpose().eval(), cost[k].dfduu).derived().sum();
+      k = timeIndex++;
+    }
+
+    infNormOfhArray[workerId] = std::max(infNormOfhArray[workerId], workerInfNormOfh);
+    sumOfInfNormOfHArray[workerId] += workerSumOfInfNormOfH;
+  };
+  threadPool.runParallel(std::move(infNormOfh_sumOfInfNormOfH), numWorkers);
+
+  const auto infNormOfh = *std::max_element(infNormOfhArray.cbegin(), infNormOfhArray.cend());
+  const auto sumOfInfNormOfH = std::accumulate(sumOfInfNormOfHArray.cbegin(), sumOfInfNormOfHArray.cend(), 0.0);
+  const auto averageOfInfNormOfH = sumOfInfNormOfH / static_cast<scalar_t>(numDecisionVariables);
+  const auto gamma = 1.0 / limitScaling(std::max(averageOfInfNormOfH, infNormOfh));
+
+  // compute EOut, DOut, and scale cost
+  timeIndex = 0;
+  auto computeDOutEOutScaleCost = [&](int workerId) {
+    int k = timeIndex++;
+    while (k < N) {
+      EOut[k].array() *= E[k].array();
+      DOut[2 * k].array() *= D[2 * k].array();
+      DOut[2 * k + 1].array() *= D[2 * k + 1].array();
+      // cost
+      cost[k].dfdxx *= gamma;
+      cost[k].dfduu *= gamma;
+      cost[k].dfdux *= gamma;
+      cost[k].dfdx *= gamma;
+      cost[k].dfdu *= gamma;
+
+      k = timeIndex++;
+    }
+    if (k == N) {  // Only one worker will execute this
+      cost[N].dfdxx *= gamma;
+      cost[N].dfduu *= gamma;
+      cost[N].dfdux *= gamma;
+      cost[N].dfdx *= gamma;
+      cost[N].dfdu *= gamma;
+    }
+  };
+  threadPool.runParallel(std::move(computeDOutEOutScaleCost), numWorkers);
+
+  // compute cOut
+  cOut *= gamma;
+}
+
+/**
+ * The largest deviation of the factors of the next Ruzi sweep from one. It is zero for perfectly equilibrated data.
+ */
+scalar_t equilibrationError(const vector_array_t& D, const vector_array_t& E) {
+  scalar_t error = 0.0;
+  for (const auto& v : D) {
+    if (v.size() > 0) {
+      error = std::max(error, (v.array() - 1.0).abs().maxCoeff());
+    }
+  }
+  for (const auto& v : E) {
+    if (v.size() > 0) {
+      error = std::max(error, (v.array() - 1.0).abs().maxCoeff());
+    }
+  }
+  return error;
+}
+
 }  // anonymous namespace
 
 void ocpDataInPlaceInParallel(ThreadPool& threadPool, const vector_t& x0, const OcpSize& ocpSize, const int iteration,
@@ -228,78 +325,65 @@ void ocpDataInPlaceInParallel(ThreadPool& threadPool, const vector_t& x0, const
     scalingVectors[i].setOnes(ocpSize.numStates[i + 1]);
   }
 
-  const auto numDecisionVariables = std::accumulate(ocpSize.numInputs.begin(), ocpSize.numInputs.end(), 0) +
-                                    std::accumulate(std::next(ocpSize.numStates.begin()), ocpSize.numStates.end(), 0);
-
   vector_array_t D(2 * N), E(N);
-  std::atomic_int timeIndex{0};
-  const size_t numWorkers = threadPool.numThreads() + 1U;
   for (int i = 0; i < iteration; i++) {
     invSqrtInfNormInParallel(threadPool, dynamics, cost, scalingVectors, D, E);
-    scaleDataOneStepInPlaceInParallel(threadPool, D, E, dynamics, cost, scalingVectors);
-
-    timeIndex = 0;
-    scalar_array_t infNormOfhArray(numWorkers, 0.0);
-    scalar_array_t sumOfInfNormOfHArray(numWorkers, 0.0);
-    auto infNormOfh_sumOfInfNormOfH = [&](int workerId) {
-      scalar_t workerInfNormOfh = 0.0;
-      scalar_t workerSumOfInfNormOfH = 0.0;
-
-      int k = timeIndex++;
-      if (k == 0) {  // Only one worker will execute this
-        workerInfNormOfh = (cost[0].dfdu + cost[0].dfdux * x0).lpNorm<Eigen::Infinity>();
-        workerSumOfInfNormOfH = matrixInfNormCols(cost[0].dfduu).derived().sum();
-        k = timeIndex++;
-      }
+    ruziIterationInParallel(threadPool, x0, ocpSize, D, E, dynamics, cost, DOut, EOut, scalingVectors, cOut);
+  }
+}
 
-      while (k <= N) {
-        workerInfNormOfh = std::max(workerInfNormOfh, cost[k].dfdx.lpNorm<Eigen::Infinity>());
-        workerInfNormOfh = std::max(workerInfNormOfh, cost[k].dfdu.lpNorm<Eigen::Infinity>());
-        workerSumOfInfNormOfH += matrixInfNormCols(cost[k].dfdxx, cost[k].dfdux).derived().sum();
-        workerSumOfInfNormOfH += matrixInfNormCols(cost[k].dfdux.transpose().eval(), cost[k].dfduu).derived().sum();
-        k = timeIndex++;
-      }
+int ocpDataInPlaceInParallelWarmStart(ThreadPool& threadPool, const vector_t& x0, const OcpSize& ocpSize, int minIteration,
+                                      int maxIteration, scalar_t tolerance, std::vector<VectorFunctionLinearApproximation>& dynamics,
+                                      std::vector<ScalarFunctionQuadraticApproximation>& cost, vector_array_t& DInOut,
+                                      vector_array_t& EInOut, vector_array_t& scalingVectors, scalar_t& cInOut) {
+  const int N = ocpSize.numStages;
+  if (N < 1) {
+    throw std::runtime_error("[precondition::ocpDataInPlaceInParallelWarmStart] The number of stages cannot be less than 1.");
+  }
 
-      infNormOfhArray[workerId] = std::max(infNormOfhArray[workerId], workerInfNormOfh);
-      sumOfInfNormOfHArray[workerId] += workerSumOfInfNormOfH;
-    };
-    threadPool.runParallel(std::move(infNormOfh_sumOfInfNormOfH), numWorkers);
-
-    const auto infNormOfh = *std::max_element(infNormOfhArray.cbegin(), infNormOfhArray.cend());
-    const auto sumOfInfNormOfH = std::accumulate(sumOfInfNormOfHArray.cbegin(), sumOfInfNormOfHArray.cend(), 0.0);
-    const auto averageOfInfNormOfH = sumOfInfNormOfH / static_cast<scalar_t>(numDecisionVariables);
-    const auto gamma = 1.0 / limitScaling(std::max(averageOfInfNormOfH, infNormOfh));
-
-    // compute EOut, DOut, and scale cost
-    timeIndex = 0;
-    auto computeDOutEOutScaleCost = [&](int workerId) {
-      int k = timeIndex++;
-      while (k < N) {
-        EOut[k].array() *= E[k].array();
-        DOut[2 * k].array() *= D[2 * k].array();
-        DOut[2 * k + 1].array() *= D[2 * k + 1].array();
-        // cost
-        cost[k].dfdxx *= gamma;
-        cost[k].dfduu *= gamma;
-        cost[k].dfdux *= gamma;
-        cost[k].dfdx *= gamma;
-        cost[k].dfdu *= gamma;
-
-        k = timeIndex++;
-      }
-      if (k == N) {  // Only one worker will execute this
-        cost[N].dfdxx *= gamma;
-        cost[N].dfduu *= gamma;
-        cost[N].dfdux *= gamma;
-        cost[N].dfdx *= gamma;
-        cost[N].dfdu *= gamma;
+  const bool isWarmStartValid = [&]() {
+    if (DInOut.size() != 2 * N || EInOut.size() != N || !(cInOut > 0.0)) {
+      return false;
+    }
+    for (int i = 0; i < N; i++) {
+      if (DInOut[2 * i].size() != ocpSize.numInputs[i] || DInOut[2 * i + 1].size() != ocpSize.numStates[i + 1] ||
+          EInOut[i].size() != ocpSize.numStates[i + 1]) {
+        return false;
       }
-    };
-    threadPool.runParallel(std::move(computeDOutEOutScaleCost), numWorkers);
+    }
+    return true;
+  }();
 
-    // compute cOut
-    cOut *= gamma;
+  if (!isWarmStartValid) {
+    ocpDataInPlaceInParallel(threadPool, x0, ocpSize, maxIteration, dynamics, cost, DInOut, EInOut, scalingVectors, cInOut);
+    return maxIteration;
+  }
+
+  // Apply the previous factors in a single step. They become the starting point of the accumulated factors.
+  scalingVectors.resize(N);
+  for (int i = 0; i < N; i++) {
+    scalingVectors[i].setOnes(ocpSize.numStates[i + 1]);
+  }
+  scaleDataOneStepInPlaceInParallel(threadPool, DInOut, EInOut, dynamics, cost, scalingVectors);
+  for (auto& c : cost) {
+    c.dfdxx *= cInOut;
+    c.dfduu *= cInOut;
+    c.dfdux *= cInOut;
+    c.dfdx *= cInOut;
+    c.dfdu *= cInOut;
+  }
+
+  // Correction sweeps
+  vector_array_t D(2 * N), E(N);
+  int i = 0;
+  for (; i < maxIteration; i++) {
+    invSqrtInfNormInParallel(threadPool, dynamics, cost, scalingVectors, D, E);
+    if (i >= minIteration && equilibrationError(D, E) <= tolerance) {
+      break;
+    }
+    ruziIterationInParallel(threadPool, x0, ocpSize, D, E, dynamics, cost, DInOut, EInOut, scalingVectors, cInOut);
   }
+  return i;
 }
 
 void kktMatrixInPlace(int iteration, Eigen::SparseMatrix<scalar_t>& H, vector_t& h, Eigen::SparseMatrix<scalar_t>& G, vector_t& g,
@@ -0,0 +1,81 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_oc/qp_backend/AdmmQpBackend.h"
+
+#include "ocs2_oc/oc_problem/OcpToKkt.h"
+#include "ocs2_oc/precondition/Ruzi.h"
+
+namespace ocs2 {
+
+AdmmQpBackend::AdmmQpBackend(admm::Settings settings, ThreadPool& threadPool) : threadPool_(threadPool), solver_(std::move(settings)) {}
+
+void AdmmQpBackend::resize(const OcpSize& ocpSize) {
+  if (assembler_.size() == ocpSize) {
+    return;
+  }
+  assembler_.resize(ocpSize);
+  primalSolution_.resize(0);
+  dualSolution_.resize(0);
+}
+
+OcpQpBackend::Status AdmmQpBackend::solve(const vector_t& x0, const std::vector<VectorFunctionLinearApproximation>& dynamics,
+                                          const std::vector<ScalarFunctionQuadraticApproximation>& cost,
+                                          const std::vector<VectorFunctionLinearApproximation>* constraints,
+                                          vector_array_t& stateTrajectory, vector_array_t& inputTrajectory) {
+  const auto& settings = solver_.settings();
+  assembler_.getCostMatrix(threadPool_, x0, cost, H_, h_);
+  assembler_.getConstraintMatrix(threadPool_, x0, dynamics, constraints, nullptr, G_, g_);
+  precondition::kktMatrixInPlace(settings.scalingIteration, H_, h_, G_, g_, D_, E_, c_);
+  solver_.setMatrices(H_, G_);
+
+  // Scaled initial guess: x = D xScaled, y = E yScaled / c
+  vector_t xScaled, yScaled;
+  const bool isWarmStart = settings.warmStart && primalSolution_.size() == H_.cols() && dualSolution_.size() == G_.rows();
+  if (isWarmStart) {
+    xScaled = primalSolution_.cwiseQuotient(D_);
+    yScaled = c_ * dualSolution_.cwiseQuotient(E_);
+  }
+
+  const auto status = solver_.solve(h_, g_, g_, xScaled, yScaled);
+
+  primalSolution_ = D_.cwiseProduct(xScaled);
+  dualSolution_ = E_.cwiseProduct(yScaled) / c_;
+  // On MAX_ITER the last iterate is kept as an inexact solution (and as the next warm start); the status is forwarded to the caller.
+  if (status != Status::SUCCESS && status != Status::MAX_ITER) {
+    primalSolution_.resize(0);
+    dualSolution_.resize(0);
+    return status;
+  }
+
+  toOcpSolution(assembler_.size(), primalSolution_, x0, stateTrajectory, inputTrajectory);
+  return status;
+}
+
+}  // namespace ocs2
@@ -0,0 +1,273 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_oc/qp_backend/AdmmSolver.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+
+namespace ocs2 {
+
+namespace {
+constexpr scalar_t rhoMin = 1e-6;
+constexpr scalar_t rhoMax = 1e6;
+constexpr scalar_t infinity = 1e20;
+
+bool hasSamePattern(const Eigen::SparseMatrix<scalar_t>& lhs, const Eigen::SparseMatrix<scalar_t>& rhs) {
+  return lhs.isCompressed() && rhs.isCompressed() && lhs.rows() == rhs.rows() && lhs.cols() == rhs.cols() &&
+         lhs.nonZeros() == rhs.nonZeros() &&
+         std::equal(lhs.outerIndexPtr(), lhs.outerIndexPtr() + lhs.outerSize() + 1, rhs.outerIndexPtr()) &&
+         std::equal(lhs.innerIndexPtr(), lhs.innerIndexPtr() + lhs.nonZeros(), rhs.innerIndexPtr());
+}
+
+/** Position of the entry (row, col) in the value array of a compressed column major matrix. */
+int findIndex(const Eigen::SparseMatrix<scalar_t>& mat, int row, int col) {
+  const int* begin = mat.innerIndexPtr() + mat.outerIndexPtr()[col];
+  const int* end = mat.innerIndexPtr() + mat.outerIndexPtr()[col + 1];
+  const int* it = std::lower_bound(begin, end, row);
+  assert(it != end && *it == row);
+  return static_cast<int>(it - mat.innerIndexPtr());
+}
+}  // namespace
+
+AdmmSolver::AdmmSolver(admm::Settings settings) : settings_(std::move(settings)), rho_(settings_.rho) {
+  if (settings_.alpha <= 0.0 || settings_.alpha >= 2.0) {
+    throw std::runtime_error("[AdmmSolver] The relaxation parameter alpha should be in (0, 2).");
+  }
+}
+
+void AdmmSolver::analyzePattern(const Eigen::SparseMatrix<scalar_t>& P, const Eigen::SparseMatrix<scalar_t>& A) {
+  const int n = P.cols();
+  const int m = A.rows();
+
+  // Lower triangle of [P + sigma I, A'; A, -diag(1/rho)] with the full diagonal
+  std::vector<Eigen::Triplet<scalar_t>> triplets;
+  triplets.reserve(P.nonZeros() + A.nonZeros() + n + m);
+  for (int i = 0; i < n + m; i++) {
+    triplets.emplace_back(i, i, 0.0);
+  }
+  for (int j = 0; j < P.outerSize(); j++) {
+    for (Eigen::SparseMatrix<scalar_t>::InnerIterator it(P, j); it; ++it) {
+      if (it.row() > j) {
+        triplets.emplace_back(it.row(), j, 0.0);
+      }
+    }
+  }
+  for (int j = 0; j < A.outerSize(); j++) {
+    for (Eigen::SparseMatrix<scalar_t>::InnerIterator it(A, j); it; ++it) {
+      triplets.emplace_back(n + it.row(), j, 0.0);
+    }
+  }
+  kkt_.resize(n + m, n + m);
+  kkt_.setFromTriplets(triplets.begin(), triplets.end());
+
+  kktIndexOfDiagonal_.resize(n + m);
+  for (int i = 0; i < n + m; i++) {
+    kktIndexOfDiagonal_[i] = findIndex(kkt_, i, i);
+  }
+  kktIndexOfP_.resize(P.nonZeros());
+  for (int j = 0, k = 0; j < P.outerSize(); j++) {
+    for (Eigen::SparseMatrix<scalar_t>::InnerIterator it(P, j); it; ++it, ++k) {
+      kktIndexOfP_[k] = (it.row() >= j) ? findIndex(kkt_, it.row(), j) : -1;
+    }
+  }
+  kktIndexOfA_.resize(A.nonZeros());
+  for (int j = 0, k = 0; j < A.outerSize(); j++) {
+    for (Eigen::SparseMatrix<scalar_t>::InnerIterator it(A, j); it; ++it, ++k) {
+      kktIndexOfA_[k] = findIndex(kkt_, n + it.row(), j);
+    }
+  }
+
+  ldlt_.analyzePattern(kkt_);
+  rho_ = settings_.rho;
+  rhoVector_.resize(0);
+  rhoInvVector_.resize(0);
+}
+
+void AdmmSolver::setMatrices(const Eigen::SparseMatrix<scalar_t>& P, const Eigen::SparseMatrix<scalar_t>& A) {
+  if (P.rows() != P.cols() || P.cols() != A.cols()) {
+    throw std::runtime_error("[AdmmSolver::setMatrices] The sizes of P and A do not match.");
+  }
+  if (!hasSamePattern(P, P_) || !hasSamePattern(A, A_)) {
+    P_ = P;
+    A_ = A;
+    P_.makeCompressed();
+    A_.makeCompressed();
+    analyzePattern(P_, A_);
+  } else {
+    std::copy(P.valuePtr(), P.valuePtr() + P.nonZeros(), P_.valuePtr());
+    std::copy(A.valuePtr(), A.valuePtr() + A.nonZeros(), A_.valuePtr());
+  }
+
+  const int n = P_.cols();
+  scalar_t* kktValues = kkt_.valuePtr();
+  std::fill(kktValues, kktValues + kkt_.nonZeros(), 0.0);
+  const scalar_t* PValues = P_.valuePtr();
+  for (int k = 0; k < P_.nonZeros(); k++) {
+    if (kktIndexOfP_[k] >= 0) {
+      kktValues[kktIndexOfP_[k]] = PValues[k];
+    }
+  }
+  for (int i = 0; i < n; i++) {
+    kktValues[kktIndexOfDiagonal_[i]] += settings_.sigma;
+  }
+  const scalar_t* AValues = A_.valuePtr();
+  for (int k = 0; k < A_.nonZeros(); k++) {
+    kktValues[kktIndexOfA_[k]] = AValues[k];
+  }
+  for (int i = 0; i < rhoInvVector_.size(); i++) {
+    kktValues[kktIndexOfDiagonal_[n + i]] = -rhoInvVector_(i);
+  }
+  isFactorized_ = false;
+}
+
+void AdmmSolver::setRhoVector(const vector_t& l, const vector_t& u) {
+  const int m = l.size();
+  vector_t rhoVector(m);
+  for (int i = 0; i < m; i++) {
+    if (l(i) <= -infinity && u(i) >= infinity) {
+      rhoVector(i) = rhoMin;
+    } else if (u(i) - l(i) < 1e-12) {
+      rhoVector(i) = settings_.equalityRhoFactor * rho_;
+    } else {
+      rhoVector(i) = rho_;
+    }
+  }
+  if (rhoVector.size() != rhoVector_.size() || rhoVector != rhoVector_) {
+    rhoVector_.swap(rhoVector);
+    rhoInvVector_ = rhoVector_.cwiseInverse();
+    const int n = P_.cols();
+    scalar_t* kktValues = kkt_.valuePtr();
+    for (int i = 0; i < m; i++) {
+      kktValues[kktIndexOfDiagonal_[n + i]] = -rhoInvVector_(i);
+    }
+    isFactorized_ = false;
+  }
+}
+
+bool AdmmSolver::factorize() {
+  ldlt_.factorize(kkt_);
+  numFactorizations_++;
+  isFactorized_ = ldlt_.info() == Eigen::Success;
+  return isFactorized_;
+}
+
+void AdmmSolver::computeResiduals(const vector_t& q, const vector_t& x, const vector_t& y) {
+  Ax_.noalias() = A_ * x;
+  Px_.noalias() = P_ * x;
+  ATy_.noalias() = A_.transpose() * y;
+  primalResidual_ = (Ax_ - z_).lpNorm<Eigen::Infinity>();
+  dualResidual_ = (Px_ + q + ATy_).lpNorm<Eigen::Infinity>();
+  primalScale_ = std::max(Ax_.lpNorm<Eigen::Infinity>(), z_.lpNorm<Eigen::Infinity>());
+  dualScale_ = std::max({Px_.lpNorm<Eigen::Infinity>(), ATy_.lpNorm<Eigen::Infinity>(), q.lpNorm<Eigen::Infinity>()});
+}
+
+OcpQpBackend::Status AdmmSolver::solve(const vector_t& q, const vector_t& l, const vector_t& u, vector_t& x, vector_t& y) {
+  const int n = P_.cols();
+  const int m = A_.rows();
+  if (q.size() != n || l.size() != m || u.size() != m) {
+    throw std::runtime_error("[AdmmSolver::solve] The sizes of q, l, and u do not match the matrices.");
+  }
+
+  numIterations_ = 0;
+  setRhoVector(l, u);
+  if (!isFactorized_ && !factorize()) {
+    return OcpQpBackend::Status::NUMERICAL_ERROR;
+  }
+
+  // Initial guess
+  if (x.size() != n) {
+    x.setZero(n);
+  }
+  if (y.size() != m) {
+    y.setZero(m);
+  }
+  z_.noalias() = A_ * x;
+  z_ = z_.cwiseMax(l).cwiseMin(u);
+
+  const scalar_t alpha = settings_.alpha;
+  bool isConverged = false;
+  while (!isConverged && numIterations_ < settings_.maxNumIterations) {
+    // Solve the KKT system: [P + sigma I, A'; A, -diag(1/rho)] [xTilde; nu] = [sigma x - q; z - y / rho]
+    rhs_.resize(n + m);
+    rhs_.head(n) = settings_.sigma * x - q;
+    rhs_.tail(m) = z_ - rhoInvVector_.cwiseProduct(y);
+    rhs_ = ldlt_.solve(rhs_);
+    zTilde_ = z_ + rhoInvVector_.cwiseProduct(rhs_.tail(m) - y);
+
+    // Relaxed updates
+    x = alpha * rhs_.head(n) + (1.0 - alpha) * x;
+    zTilde_ = alpha * zTilde_ + (1.0 - alpha) * z_;
+    z_ = (zTilde_ + rhoInvVector_.cwiseProduct(y)).cwiseMax(l).cwiseMin(u);
+    y += rhoVector_.cwiseProduct(zTilde_ - z_);
+    numIterations_++;
+
+    const bool checkTermination = numIterations_ % settings_.checkTerminationInterval == 0;
+    const bool updateRho = settings_.adaptiveRho && numIterations_ % settings_.rhoUpdateInterval == 0;
+    if (checkTermination || updateRho) {
+      computeResiduals(q, x, y);
+    }
+
+    if (checkTermination) {
+      const scalar_t primalTolerance = settings_.absoluteTolerance + settings_.relativeTolerance * primalScale_;
+      const scalar_t dualTolerance = settings_.absoluteTolerance + settings_.relativeTolerance * dualScale_;
+      isConverged = primalResidual_ <= primalTolerance && dualResidual_ <= dualTolerance;
+    }
+
+    if (!isConverged && updateRho) {
+      const scalar_t normalizedPrimalResidual = primalResidual_ / (primalScale_ + 1e-10);
+      const scalar_t normalizedDualResidual = dualResidual_ / (dualScale_ + 1e-10);
+      const scalar_t rhoNew =
+          std::min(std::max(rho_ * std::sqrt(normalizedPrimalResidual / (normalizedDualResidual + 1e-10)), rhoMin), rhoMax);
+      if (rhoNew > rho_ * settings_.rhoUpdateTolerance || rhoNew < rho_ / settings_.rhoUpdateTolerance) {
+        rho_ = rhoNew;
+        setRhoVector(l, u);
+        if (!factorize()) {
+          return OcpQpBackend::Status::NUMERICAL_ERROR;
+        }
+      }
+    }
+  }
+
+  if (settings_.displayShortSummary) {
+    computeResiduals(q, x, y);
+    std::cerr << "\n+++++++++++++++++++++++++++++++++++++++++++++";
+    std::cerr << "\n++++++++++++++ ADMM +++++++++++++++++++++++++";
+    std::cerr << "\n+++++++++++++++++++++++++++++++++++++++++++++\n";
+    std::cerr << "Solver status: " << (isConverged ? "SUCCESS" : "MAX_ITER") << "\n";
+    std::cerr << "Number of Iterations: " << numIterations_ << " out of " << settings_.maxNumIterations << "\n";
+    std::cerr << "Number of factorizations: " << numFactorizations_ << ", rho: " << rho_ << "\n";
+    std::cerr << "Primal residual: " << primalResidual_ << ", dual residual: " << dualResidual_ << "\n";
+  }
+
+  return isConverged ? OcpQpBackend::Status::SUCCESS : OcpQpBackend::Status::MAX_ITER;
+}
+
+}  // namespace ocs2
@@ -0,0 +1,139 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_oc/rollout/BatchRollout.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace ocs2 {
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+BatchRollout::BatchRollout(const RolloutBase& rollout, size_t nThreads, int threadPriority)
+    : threadPool_(std::max(nThreads, size_t(1)) - 1, threadPriority) {
+  const size_t numWorkers = threadPool_.numThreads() + 1;
+  rolloutPtrs_.reserve(numWorkers);
+  for (size_t i = 0; i < numWorkers; i++) {
+    rolloutPtrs_.emplace_back(rollout.clone());
+  }
+  sharedControllerPtrs_.resize(numWorkers);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void BatchRollout::abortRollout() {
+  for (auto& rolloutPtr : rolloutPtrs_) {
+    rolloutPtr->abortRollout();
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void BatchRollout::reactivateRollout() {
+  for (auto& rolloutPtr : rolloutPtrs_) {
+    rolloutPtr->reactivateRollout();
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void BatchRollout::setSharedController(const ControllerBase& controller) {
+  for (auto& controllerPtr : sharedControllerPtrs_) {
+    controllerPtr.reset(controller.clone());
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+vector_array_t BatchRollout::run(scalar_t initTime, const vector_array_t& initStateBatch, scalar_t finalTime,
+                                 const ModeSchedule& modeSchedule, std::vector<PrimalSolution>& solutionBatch) {
+  if (sharedControllerPtrs_.front() == nullptr) {
+    throw std::runtime_error("[BatchRollout::run] The shared controller is not set!");
+  }
+
+  auto getController = [&](int workerIndex, size_t) { return sharedControllerPtrs_[workerIndex].get(); };
+  return runBatch(initTime, initStateBatch, finalTime, getController, modeSchedule, solutionBatch);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+vector_array_t BatchRollout::run(scalar_t initTime, const vector_array_t& initStateBatch, scalar_t finalTime,
+                                 const std::vector<ControllerBase*>& controllerBatch, const ModeSchedule& modeSchedule,
+                                 std::vector<PrimalSolution>& solutionBatch) {
+  if (controllerBatch.size() != initStateBatch.size()) {
+    throw std::runtime_error("[BatchRollout::run] The number of controllers should be equal to the batch size!");
+  }
+  if (std::any_of(controllerBatch.cbegin(), controllerBatch.cend(), [](const ControllerBase* c) { return c == nullptr; })) {
+    throw std::runtime_error("[BatchRollout::run] Controller is not set!");
+  }
+
+  auto getController = [&](int, size_t i) { return controllerBatch[i]; };
+  return runBatch(initTime, initStateBatch, finalTime, getController, modeSchedule, solutionBatch);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+template <typename GetController>
+vector_array_t BatchRollout::runBatch(scalar_t initTime, const vector_array_t& initStateBatch, scalar_t finalTime,
+                                      GetController getController, const ModeSchedule& modeSchedule,
+                                      std::vector<PrimalSolution>& solutionBatch) {
+  const size_t batchSize = initStateBatch.size();
+  solutionBatch.resize(batchSize);
+  vector_array_t finalStateBatch(batchSize);
+
+  // static partition: the batch is split into one contiguous block per worker
+  const size_t numWorkers = rolloutPtrs_.size();
+  std::atomic_size_t nextBlockIndex{0};
+  auto task = [&](int workerIndex) {
+    const size_t blockIndex = nextBlockIndex++;  // a worker might run more than one task (atomic)
+    const size_t blockBegin = (blockIndex * batchSize) / numWorkers;
+    const size_t blockEnd = ((blockIndex + 1) * batchSize) / numWorkers;
+    auto& rollout = *rolloutPtrs_[workerIndex];
+    for (size_t i = blockBegin; i < blockEnd; i++) {
+      auto& solution = solutionBatch[i];
+      solution.modeSchedule_ = modeSchedule;
+      finalStateBatch[i] = rollout.run(initTime, initStateBatch[i], finalTime, getController(workerIndex, i), solution.modeSchedule_,
+                                       solution.timeTrajectory_, solution.postEventIndices_, solution.stateTrajectory_,
+                                       solution.inputTrajectory_);
+    }
+  };
+  threadPool_.runParallel(std::move(task), numWorkers);
+
+  return finalStateBatch;
+}
+
+}  // namespace ocs2
@@ -66,6 +66,7 @@ Settings loadSettings(const std::string& filename, const std::string& fieldName,
 
   loadData::loadPtreeValue(pt, settings.maxSingleEventIterations, fieldName + ".maxSingleEventIterations", verbose);
   loadData::loadPtreeValue(pt, settings.useTrajectorySpreadingController, fieldName + ".useTrajectorySpreadingController", verbose);
+  loadData::loadPtreeValue(pt, settings.useDenseOutputEventLocalization, fieldName + ".useDenseOutputEventLocalization", verbose);
 
   if (verbose) {
     std::cerr << " #### =============================================================================" << std::endl;
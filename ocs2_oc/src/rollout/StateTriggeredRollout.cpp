@@ -29,11 +29,49 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ocs2_oc/rollout/StateTriggeredRollout.h"
 
+#include <tuple>
+
 #include <ocs2_core/control/StateBasedLinearController.h>
 #include <ocs2_oc/rollout/RootFinder.h>
 
 namespace ocs2 {
 
+namespace {
+/** Evaluates the cubic Hermite interpolant of a step [t0, t1] given the states and their time derivatives at both ends. */
+vector_t cubicHermite(scalar_t t0, const vector_t& x0, const vector_t& dxdt0, scalar_t t1, const vector_t& x1, const vector_t& dxdt1,
+                      scalar_t t) {
+  const scalar_t h = t1 - t0;
+  const scalar_t s = (t - t0) / h;
+  const scalar_t s2 = s * s;
+  const scalar_t s3 = s2 * s;
+  const scalar_t h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+  const scalar_t h10 = s3 - 2.0 * s2 + s;
+  const scalar_t h01 = -2.0 * s3 + 3.0 * s2;
+  const scalar_t h11 = s3 - s2;
+  return h00 * x0 + (h10 * h) * dxdt0 + h01 * x1 + (h11 * h) * dxdt1;
+}
+
+/**
+ * Takes a single 5th order Dormand-Prince step of length h from (t0, x0). Since h is not larger than the accepted step which
+ * brackets the event, the local error of this step is within the tolerances of the adaptive integrator.
+ */
+vector_t dormandPrince5Step(ControlledSystemBase& system, scalar_t t0, const vector_t& x0, const vector_t& dxdt0, scalar_t h) {
+  const vector_t& k1 = dxdt0;
+  const vector_t k2 = system.computeFlowMap(t0 + h / 5.0, x0 + h * (1.0 / 5.0) * k1);
+  const vector_t k3 = system.computeFlowMap(t0 + h * 3.0 / 10.0, x0 + h * ((3.0 / 40.0) * k1 + (9.0 / 40.0) * k2));
+  const vector_t k4 = system.computeFlowMap(t0 + h * 4.0 / 5.0, x0 + h * ((44.0 / 45.0) * k1 - (56.0 / 15.0) * k2 + (32.0 / 9.0) * k3));
+  const vector_t k5 = system.computeFlowMap(
+      t0 + h * 8.0 / 9.0,
+      x0 + h * ((19372.0 / 6561.0) * k1 - (25360.0 / 2187.0) * k2 + (64448.0 / 6561.0) * k3 - (212.0 / 729.0) * k4));
+  const vector_t k6 = system.computeFlowMap(t0 + h, x0 + h * ((9017.0 / 3168.0) * k1 - (355.0 / 33.0) * k2 + (46732.0 / 5247.0) * k3 +
+                                                              (49.0 / 176.0) * k4 - (5103.0 / 18656.0) * k5));
+  for (int i = 0; i < 5; i++) {
+    system.incrementNumFunctionCalls();
+  }
+  return x0 + h * ((35.0 / 384.0) * k1 + (500.0 / 1113.0) * k3 + (125.0 / 192.0) * k4 - (2187.0 / 6784.0) * k5 + (11.0 / 84.0) * k6);
+}
+}  // unnamed namespace
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -95,8 +133,26 @@ vector_t StateTriggeredRollout::run(scalar_t initTime, const vector_t& initState
   vector_t x0 = initState;
   modeSchedule.modeSequence.push_back(eventID);
 
+  // applies the jump map and registers the event. Returns the post-event time and state.
+  auto applyEvent = [&](scalar_t eventTime, const vector_t& eventState, size_t eventIndex) {
+    const scalar_t postEventTime = eventTime + numeric_traits::weakEpsilon<scalar_t>();
+    vector_t postEventState = systemDynamicsPtr_->computeJumpMap(eventTime, eventState);
+
+    // append the event to array with event indices
+    postEventIndices.push_back(stateTrajectory.size());
+
+    // append to modeSchedule
+    modeSchedule.eventTimes.push_back(eventTime);
+    modeSchedule.modeSequence.push_back(eventIndex);
+
+    // determine guard surface cross value and update the last event triggering times of Event Handler
+    systemEventHandlersPtr_->setLastEvent(postEventTime, systemDynamicsPtr_->computeGuardSurfaces(postEventTime, postEventState));
+
+    return std::make_pair(postEventTime, std::move(postEventState));
+  };
+
   bool refining = false;
-  int k_u = 0;                    // control input iterator
+  size_t k_u = 0;                 // control input iterator
   int singleEventIterations = 0;  // iterations for a single event
   int numTotalIterations = 0;     // overall number of iterations
 
@@ -110,6 +166,31 @@ vector_t StateTriggeredRollout::run(scalar_t initTime, const vector_t& initState
       eventID = e;
       triggered = true;
     }
+
+    // locate the event within the last accepted step rather than refining the bracket by re-integration
+    const size_t segmentBeginIndex = postEventIndices.empty() ? 0 : postEventIndices.back();
+    if (triggered && this->settings().useDenseOutputEventLocalization && timeTrajectory.size() >= segmentBeginIndex + 2) {
+      eventID = locateEventWithinStep(systemEventHandlersPtr_->getGuardSurfacesValues(), timeTrajectory, stateTrajectory);
+
+      if (this->settings().reconstructInputTrajectory) {
+        for (; k_u < timeTrajectory.size(); k_u++) {
+          inputTrajectory.emplace_back(systemDynamicsPtr_->controllerPtr()->computeInput(timeTrajectory[k_u], stateTrajectory[k_u]));
+        }  // end of k_u loop
+      }
+
+      if (numerics::almost_eq(finalTime, timeTrajectory.back())) {
+        break;
+      }
+
+      std::tie(t0, x0) = applyEvent(timeTrajectory.back(), stateTrajectory.back(), eventID);
+      t1 = finalTime;
+
+      // reset relevant boolean and counter
+      refining = false;
+      singleEventIterations = 0;
+      numTotalIterations++;
+      continue;
+    }
     // calculate guard surface value of last query state and time
     const scalar_t queryTime = timeTrajectory.back();
     const vector_t queryState = stateTrajectory.back();
@@ -147,22 +228,8 @@ vector_t StateTriggeredRollout::run(scalar_t initTime, const vector_t& initState
     // accuracy condition for event refinement. If sufficiently accurate crossing location has been determined
     if (accuracyCondition || maxNumIterationsReached) {
       // set new begin/end time and begin state
-      t0 = queryTime + numeric_traits::weakEpsilon<scalar_t>();
+      std::tie(t0, x0) = applyEvent(queryTime, queryState, eventID);
       t1 = finalTime;
-      // compute jump
-      x0 = systemDynamicsPtr_->computeJumpMap(queryTime, queryState);
-
-      // append the event to array with event indices
-      postEventIndices.push_back(stateTrajectory.size());
-
-      // append to modeSchedule
-      modeSchedule.eventTimes.push_back(queryTime);
-      modeSchedule.modeSequence.push_back(eventID);
-
-      // determine guard surface cross value and update the eventHandler
-      vector_t guardSurfacesCross = systemDynamicsPtr_->computeGuardSurfaces(t0, x0);
-      // updates the last event triggering times of Event Handler
-      systemEventHandlersPtr_->setLastEvent(t0, guardSurfacesCross);
 
       // reset relevant boolean and counter
       refining = false;
@@ -198,4 +265,93 @@ vector_t StateTriggeredRollout::run(scalar_t initTime, const vector_t& initState
   return stateTrajectory.back();
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+size_t StateTriggeredRollout::locateEventWithinStep(const vector_t& guardSurfacesBefore, scalar_array_t& timeTrajectory,
+                                                    vector_array_t& stateTrajectory) {
+  // the last accepted step brackets the event
+  const scalar_t timeBefore = timeTrajectory[timeTrajectory.size() - 2];
+  const vector_t& stateBefore = stateTrajectory[stateTrajectory.size() - 2];
+  const scalar_t timeAfter = timeTrajectory.back();
+  const vector_t stateAfter = stateTrajectory.back();
+  const vector_t guardSurfacesAfter = systemDynamicsPtr_->computeGuardSurfaces(timeAfter, stateAfter);
+
+  // the end-point derivatives of the step define its cubic Hermite interpolant
+  const vector_t flowBefore = systemDynamicsPtr_->computeFlowMap(timeBefore, stateBefore);
+  const vector_t flowAfter = systemDynamicsPtr_->computeFlowMap(timeAfter, stateAfter);
+  systemDynamicsPtr_->incrementNumFunctionCalls();
+  systemDynamicsPtr_->incrementNumFunctionCalls();
+  auto interpolate = [&](scalar_t t) { return cubicHermite(timeBefore, stateBefore, flowBefore, timeAfter, stateAfter, flowAfter, t); };
+
+  const scalar_t absTol = this->settings().absTolODE;
+  const int maxNumIterations = this->settings().maxSingleEventIterations;
+  RootFinder rootFinder(this->settings().rootFindingAlgorithm);
+
+  // find the earliest crossing among all the guard surfaces that are crossed within the step
+  size_t eventID = 0;
+  scalar_t eventTime = timeAfter;
+  vector_t eventState = stateAfter;
+  const Eigen::Index numGuardSurfaces = std::min(guardSurfacesBefore.size(), guardSurfacesAfter.size());
+  for (Eigen::Index i = 0; i < numGuardSurfaces; i++) {
+    const bool isCrossed = guardSurfacesBefore(i) > 0.0 && guardSurfacesAfter(i) <= 0.0;
+    if (!isCrossed) {
+      continue;
+    }
+
+    // an initial guess of the crossing time on the interpolant, which is only used to seed the refinement below
+    scalar_t guessTime = timeAfter;
+    rootFinder.setInitBracket(timeBefore, timeAfter, guardSurfacesBefore(i), guardSurfacesAfter(i));
+    for (int iter = 0; iter < maxNumIterations; iter++) {
+      guessTime = rootFinder.getNewQuery();
+      const scalar_t guessGuard = systemDynamicsPtr_->computeGuardSurfaces(guessTime, interpolate(guessTime))(i);
+      if (std::abs(guessGuard) < absTol) {
+        break;
+      }
+      rootFinder.updateBracket(guessTime, guessGuard);
+    }
+
+    // refine the crossing with the 5th order state of the step. The positive side of the bracket is kept in case the iterations
+    // terminate before the guard accuracy condition is satisfied, such that the event state never lies past the guard surface.
+    scalar_t positiveTime = timeBefore;
+    vector_t positiveState = stateBefore;
+    scalar_t negativeTime = timeAfter;
+    scalar_t queryTime = guessTime;
+    rootFinder.setInitBracket(timeBefore, timeAfter, guardSurfacesBefore(i), guardSurfacesAfter(i));
+    for (int iter = 0; iter < maxNumIterations; iter++) {
+      vector_t queryState = dormandPrince5Step(*systemDynamicsPtr_, timeBefore, stateBefore, flowBefore, queryTime - timeBefore);
+      const scalar_t queryGuard = systemDynamicsPtr_->computeGuardSurfaces(queryTime, queryState)(i);
+      if (queryGuard > 0.0) {
+        positiveTime = queryTime;
+        positiveState = queryState;
+      } else {
+        negativeTime = queryTime;
+      }
+      if (std::abs(queryGuard) < absTol) {
+        positiveTime = queryTime;
+        positiveState = std::move(queryState);
+        break;
+      }
+      const bool timeAccuracyCondition = std::abs(negativeTime - positiveTime) < absTol;
+      if (timeAccuracyCondition) {
+        break;
+      }
+      rootFinder.updateBracket(queryTime, queryGuard);
+      queryTime = rootFinder.getNewQuery();
+    }
+
+    if (positiveTime <= eventTime) {
+      eventID = i;
+      eventTime = positiveTime;
+      eventState = std::move(positiveState);
+    }
+  }  // end of i loop
+
+  // replace the element past the guard surface by the event
+  timeTrajectory.back() = eventTime;
+  stateTrajectory.back() = std::move(eventState);
+
+  return eventID;
+}
+
 }  // namespace ocs2
@@ -29,6 +29,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ocs2_oc/search_strategy/FilterLinesearch.h"
 
+#include <algorithm>
+
 namespace ocs2 {
 
 std::pair<bool, FilterLinesearch::StepType> FilterLinesearch::acceptStep(const PerformanceIndex& baselinePerformance,
@@ -36,26 +38,48 @@ std::pair<bool, FilterLinesearch::StepType> FilterLinesearch::acceptStep(const P
                                                                          scalar_t armijoDescentMetric) const {
   const scalar_t baselineConstraintViolation = totalConstraintViolation(baselinePerformance);
   const scalar_t stepConstraintViolation = totalConstraintViolation(stepPerformance);
+  const bool acceptableToFilter = isAcceptableToFilter(stepPerformance);
 
   // Step acceptance and record step type
   if (stepConstraintViolation > g_max) {
     // High constraint violation. Only accept decrease in constraints.
-    const bool accepted = stepConstraintViolation < ((1.0 - gamma_c) * baselineConstraintViolation);
+    const bool accepted = acceptableToFilter && stepConstraintViolation < ((1.0 - gamma_c) * baselineConstraintViolation);
     return std::make_pair(accepted, StepType::CONSTRAINT);
 
   } else if (stepConstraintViolation < g_min && baselineConstraintViolation < g_min && armijoDescentMetric < 0.0) {
     // With low violation and having a descent direction, require the armijo condition.
-    const bool accepted = stepPerformance.merit < (baselinePerformance.merit + armijoFactor * armijoDescentMetric);
+    const bool accepted =
+        acceptableToFilter && stepPerformance.merit < (baselinePerformance.merit + armijoFactor * armijoDescentMetric);
     return std::make_pair(accepted, StepType::COST);
 
   } else {
     // Medium violation: either merit or constraints decrease (with small gamma_c mixing of old constraints)
-    const bool accepted = stepPerformance.merit < (baselinePerformance.merit - gamma_c * baselineConstraintViolation) ||
-                          stepConstraintViolation < ((1.0 - gamma_c) * baselineConstraintViolation);
+    const bool sufficientDecrease = stepPerformance.merit < (baselinePerformance.merit - gamma_c * baselineConstraintViolation) ||
+                                    stepConstraintViolation < ((1.0 - gamma_c) * baselineConstraintViolation);
+    const bool accepted = acceptableToFilter && sufficientDecrease;
     return std::make_pair(accepted, StepType::DUAL);
   }
 }
 
+void FilterLinesearch::augmentFilter(const PerformanceIndex& baselinePerformance, StepType stepType) {
+  if (maxHistory == 0 || stepType == StepType::COST || stepType == StepType::ZERO) {
+    return;
+  }
+
+  const scalar_t baselineConstraintViolation = totalConstraintViolation(baselinePerformance);
+  filter_.emplace_back(baselinePerformance.merit - gamma_c * baselineConstraintViolation, (1.0 - gamma_c) * baselineConstraintViolation);
+  while (filter_.size() > maxHistory) {
+    filter_.pop_front();
+  }
+}
+
+bool FilterLinesearch::isAcceptableToFilter(const PerformanceIndex& stepPerformance) const {
+  const scalar_t stepConstraintViolation = totalConstraintViolation(stepPerformance);
+  return std::none_of(filter_.cbegin(), filter_.cend(), [&](const std::pair<scalar_t, scalar_t>& entry) {
+    return stepPerformance.merit >= entry.first && stepConstraintViolation >= entry.second;
+  });
+}
+
 std::string toString(const FilterLinesearch::StepType& stepType) {
   using StepType = FilterLinesearch::StepType;
   switch (stepType) {
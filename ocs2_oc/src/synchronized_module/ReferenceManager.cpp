@@ -43,7 +43,7 @@ ReferenceManager::ReferenceManager(TargetTrajectories initialTargetTrajectories,
 void ReferenceManager::preSolverRun(scalar_t initTime, scalar_t finalTime, const vector_t& initState) {
   targetTrajectories_.updateFromBuffer();
   modeSchedule_.updateFromBuffer();
-  modifyReferences(initTime, finalTime, initState, targetTrajectories_.get(), modeSchedule_.get());
+  modifyReferences(initTime, finalTime, initState, targetTrajectories_.getMutable(), modeSchedule_.getMutable());
 }
 
 }  // namespace ocs2
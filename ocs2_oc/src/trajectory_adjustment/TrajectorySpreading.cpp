@@ -350,6 +350,17 @@ void TrajectorySpreading::computeSpreadingStrategy(const scalar_array_t& oldTime
       updatedMatchedEventTimes_.push_back(newMatchedEventTimes[j]);
     }
   }  // end of j loop
+
+  // a spreading value which lies in another spreading interval must be extracted before spreading
+  isSpreadingValueOverwritten_.assign(spreadingValueIndices_.size(), false);
+  for (size_t i = 0; i < spreadingValueIndices_.size(); i++) {
+    for (size_t k = 0; k < spreadingValueIndices_.size(); k++) {
+      if (k != i && beginIndices_[k] <= spreadingValueIndices_[i] && spreadingValueIndices_[i] < endIndices_[k]) {
+        isSpreadingValueOverwritten_[i] = true;
+      }
+    }  // end of k loop
+  }    // end of i loop
+  numOverwrittenSpreadingValues_ = std::count(isSpreadingValueOverwritten_.cbegin(), isSpreadingValueOverwritten_.cend(), true);
 }
 
 /******************************************************************************************************/
@@ -27,6 +27,8 @@ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ******************************************************************************/
 
+#include <algorithm>
+
 #include <gtest/gtest.h>
 
 #include "ocs2_oc/oc_data/TimeDiscretization.h"
@@ -127,4 +129,20 @@ TEST(test_time_discretization, withEvents) {
   ASSERT_EQ(time[12].event, AnnotatedTime::Event::PreEvent);
   ASSERT_EQ(time[13].event, AnnotatedTime::Event::PostEvent);
   ASSERT_EQ(time[14].event, AnnotatedTime::Event::None);
-}
\ No newline at end of file
+}
+
+TEST(test_time_discretization, interpolationTime) {
+  scalar_t initTime = 3.0;
+  scalar_t finalTime = 4.0;
+  scalar_t dt = 0.1;
+  scalar_array_t eventTimes{3.25};
+
+  auto time = timeDiscretizationWithEvents(initTime, finalTime, dt, eventTimes);
+  const auto interpolationTime = toInterpolationTime(time);
+  ASSERT_EQ(interpolationTime.size(), time.size());
+  ASSERT_EQ(interpolationTime.front(), initTime);
+  ASSERT_LT(interpolationTime.back(), finalTime);
+  ASSERT_NEAR(interpolationTime.back(), finalTime, 1e-5);
+  ASSERT_TRUE(std::is_sorted(interpolationTime.begin(), interpolationTime.end()));
+  ASSERT_LT(interpolationTime[3], interpolationTime[4]);  // pre- and post-event nodes are separated
+}
@@ -29,8 +29,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <gtest/gtest.h>
 
+#include <ocs2_core/thread_support/ThreadPool.h>
+
 #include "ocs2_oc/oc_problem/OcpSize.h"
 #include "ocs2_oc/oc_problem/OcpToKkt.h"
+#include "ocs2_oc/oc_problem/SparseKktAssembler.h"
 
 #include "ocs2_oc/test/testProblemsGeneration.h"
 
@@ -92,3 +95,45 @@ TEST_F(OcpToKktTest, sparseCostApproximation) {
   EXPECT_TRUE(costApproximation.dfdxx.isApprox(H.toDense()));
   EXPECT_TRUE(costApproximation.dfdx.isApprox(h));
 }
+
+TEST_F(OcpToKktTest, sparseKktAssembler) {
+  ocs2::ThreadPool threadPool(3, 50);
+  ocs2::SparseKktAssembler assembler;
+  assembler.resize(ocpSize_);
+
+  ocs2::vector_array_t scalingVectors(N_);
+  for (auto& v : scalingVectors) {
+    v = ocs2::vector_t::Random(nx_);
+  }
+
+  Eigen::SparseMatrix<ocs2::scalar_t> G, G_ref, H, H_ref;
+  ocs2::vector_t g, g_ref, h, h_ref;
+
+  // With and without constraints
+  assembler.getConstraintMatrix(threadPool, x0, dynamicsArray, &constraintsArray, &scalingVectors, G, g);
+  ocs2::getConstraintMatrixSparse(ocpSize_, x0, dynamicsArray, &constraintsArray, &scalingVectors, G_ref, g_ref);
+  EXPECT_TRUE(G_ref.toDense().isApprox(G.toDense()));
+  EXPECT_TRUE(g_ref.isApprox(g));
+
+  assembler.getConstraintMatrix(threadPool, x0, dynamicsArray, nullptr, nullptr, G, g);
+  ocs2::getConstraintMatrixSparse(ocpSize_, x0, dynamicsArray, nullptr, nullptr, G_ref, g_ref);
+  EXPECT_TRUE(G_ref.toDense().isApprox(G.toDense()));
+  EXPECT_TRUE(g_ref.isApprox(g));
+
+  assembler.getCostMatrix(threadPool, x0, costArray, H, h);
+  ocs2::getCostMatrixSparse(ocpSize_, x0, costArray, H_ref, h_ref);
+  EXPECT_TRUE(H_ref.toDense().isApprox(H.toDense()));
+  EXPECT_TRUE(h_ref.isApprox(h));
+
+  // The numeric phase overwrites the values and keeps the structure
+  const auto* valuePtr = H.valuePtr();
+  for (auto& c : costArray) {
+    c.dfdxx *= 2.0;
+    c.dfdux.setZero();
+  }
+  assembler.getCostMatrix(threadPool, x0, costArray, H, h);
+  ocs2::getCostMatrixSparse(ocpSize_, x0, costArray, H_ref, h_ref);
+  EXPECT_EQ(valuePtr, H.valuePtr());
+  EXPECT_TRUE(H_ref.toDense().isApprox(H.toDense()));
+  EXPECT_TRUE(h_ref.isApprox(h));
+}
@@ -0,0 +1,131 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <ocs2_core/control/FeedforwardController.h>
+#include <ocs2_core/control/LinearController.h>
+#include <ocs2_core/dynamics/LinearSystemDynamics.h>
+#include <ocs2_core/initialization/DefaultInitializer.h>
+
+#include "ocs2_oc/oc_solver/ContinuationInitializer.h"
+
+using namespace ocs2;
+
+class ContinuationInitializerTest : public testing::Test {
+ protected:
+  ContinuationInitializerTest() {
+    // double integrator
+    const matrix_t A = (matrix_t(2, 2) << 0.0, 1.0, 0.0, 0.0).finished();
+    const matrix_t B = (matrix_t(2, 1) << 0.0, 1.0).finished();
+    dynamicsPtr.reset(new LinearSystemDynamics(A, B));
+
+    // previous solution on [0, 1] with an event at 2.0
+    primalSolution.timeTrajectory_ = {0.0, 0.5, 1.0};
+    primalSolution.stateTrajectory_ = {vector_t::Zero(2), vector_t::Ones(2), finalState};
+    primalSolution.inputTrajectory_ = {vector_t::Zero(1), vector_t::Zero(1), finalInput};
+    primalSolution.modeSchedule_ = ModeSchedule({2.0}, {0, 1});
+    const matrix_array_t gainArray(primalSolution.timeTrajectory_.size(), finalGain);
+    primalSolution.controllerPtr_.reset(new LinearController(primalSolution.timeTrajectory_, primalSolution.inputTrajectory_, gainArray));
+  }
+
+  /** Exact propagation of the double integrator with a constant input. */
+  vector_t propagate(const vector_t& x, const vector_t& u, scalar_t dt) const {
+    return (vector_t(2) << x(0) + dt * x(1) + 0.5 * dt * dt * u(0), x(1) + dt * u(0)).finished();
+  }
+
+  std::unique_ptr<SystemDynamicsBase> dynamicsPtr;
+  const DefaultInitializer defaultInitializer{1};
+  const vector_t finalState = (vector_t(2) << 2.0, 0.5).finished();
+  const vector_t finalInput = (vector_t(1) << 0.3).finished();
+  const matrix_t finalGain = (matrix_t(1, 2) << -1.0, -2.0).finished();
+  PrimalSolution primalSolution;
+};
+
+TEST_F(ContinuationInitializerTest, withoutPolicy) {
+  ContinuationInitializer initializer(defaultInitializer, *dynamicsPtr);
+  ASSERT_FALSE(initializer.hasPolicy());
+
+  const vector_t state = vector_t::Ones(2);
+  vector_t input, nextState;
+  initializer.compute(1.0, state, 1.1, input, nextState);
+  EXPECT_TRUE(input.isZero());
+  EXPECT_TRUE(nextState.isApprox(state));
+}
+
+TEST_F(ContinuationInitializerTest, feedbackPolicy) {
+  ContinuationInitializer initializer(defaultInitializer, *dynamicsPtr);
+  initializer.setPolicy(primalSolution);
+  ASSERT_TRUE(initializer.hasPolicy());
+
+  // at the final node, the final input is continued
+  vector_t input, nextState;
+  initializer.compute(1.0, finalState, 1.1, input, nextState);
+  EXPECT_TRUE(input.isApprox(finalInput));
+  EXPECT_TRUE(nextState.isApprox(propagate(finalState, finalInput, 0.1)));
+
+  // away from the final state, the final feedback is applied
+  const vector_t state = finalState + vector_t::Ones(2);
+  initializer.compute(1.5, state, 1.7, input, nextState);
+  const vector_t expectedInput = finalInput + finalGain * (state - finalState);
+  EXPECT_TRUE(input.isApprox(expectedInput));
+  EXPECT_TRUE(nextState.isApprox(propagate(state, expectedInput, 0.2)));
+
+  // up to the next event
+  initializer.compute(1.9, finalState, 2.0, input, nextState);
+  EXPECT_TRUE(input.isApprox(finalInput));
+
+  // the wrapped initializer is used in the next mode
+  initializer.compute(2.0, finalState, 2.1, input, nextState);
+  EXPECT_TRUE(input.isZero());
+  EXPECT_TRUE(nextState.isApprox(finalState));
+
+  // clones keep the policy
+  std::unique_ptr<Initializer> clonePtr(initializer.clone());
+  clonePtr->compute(1.5, state, 1.7, input, nextState);
+  EXPECT_TRUE(input.isApprox(expectedInput));
+
+  // an empty solution clears the policy
+  initializer.setPolicy(PrimalSolution());
+  EXPECT_FALSE(initializer.hasPolicy());
+  initializer.compute(1.5, state, 1.7, input, nextState);
+  EXPECT_TRUE(input.isZero());
+}
+
+TEST_F(ContinuationInitializerTest, feedforwardPolicy) {
+  primalSolution.controllerPtr_.reset(new FeedforwardController(primalSolution.timeTrajectory_, primalSolution.inputTrajectory_));
+
+  ContinuationInitializer initializer(defaultInitializer, *dynamicsPtr);
+  initializer.setPolicy(primalSolution);
+
+  // no feedback
+  vector_t input, nextState;
+  initializer.compute(1.5, finalState + vector_t::Ones(2), 1.7, input, nextState);
+  EXPECT_TRUE(input.isApprox(finalInput));
+}
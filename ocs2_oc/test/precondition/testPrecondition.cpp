@@ -187,6 +187,91 @@ TEST_F(PreconditionTest, ocpDataInPlaceInParallel) {
   EXPECT_TRUE(g_ref.isApprox(g_scaledData));  // g
 }
 
+TEST_F(PreconditionTest, ocpDataInPlaceInParallelWarmStart) {
+  ocs2::ThreadPool threadPool(5, 99);
+
+  // Cold start
+  auto dynamicsCold = dynamicsArray;
+  auto costCold = costArray;
+  ocs2::vector_array_t D_array, E_array, scalingVectorsCold;
+  ocs2::scalar_t c;
+  ocs2::precondition::ocpDataInPlaceInParallel(threadPool, x0, ocpSize_, 5, dynamicsCold, costCold, D_array, E_array, scalingVectorsCold,
+                                               c);
+
+  // Warm start on the same data without correction sweeps reproduces the cold start
+  auto dynamicsWarm = dynamicsArray;
+  auto costWarm = costArray;
+  ocs2::vector_array_t DWarm = D_array, EWarm = E_array, scalingVectorsWarm;
+  ocs2::scalar_t cWarm = c;
+  const auto numSweeps = ocs2::precondition::ocpDataInPlaceInParallelWarmStart(threadPool, x0, ocpSize_, 0, 5, 1.0, dynamicsWarm, costWarm,
+                                                                               DWarm, EWarm, scalingVectorsWarm, cWarm);
+  EXPECT_EQ(numSweeps, 0);
+  EXPECT_DOUBLE_EQ(cWarm, c);
+  for (int i = 0; i < N_; i++) {
+    EXPECT_TRUE(dynamicsWarm[i].dfdx.isApprox(dynamicsCold[i].dfdx));
+    EXPECT_TRUE(dynamicsWarm[i].dfdu.isApprox(dynamicsCold[i].dfdu));
+    EXPECT_TRUE(dynamicsWarm[i].f.isApprox(dynamicsCold[i].f));
+    EXPECT_TRUE(scalingVectorsWarm[i].isApprox(scalingVectorsCold[i]));
+    EXPECT_TRUE(costWarm[i].dfduu.isApprox(costCold[i].dfduu));
+    EXPECT_TRUE(costWarm[i].dfdx.isApprox(costCold[i].dfdx));
+  }
+
+  // Warm start on perturbed data runs correction sweeps, and the returned factors are consistent with the scaled data
+  auto dynamicsPerturbed = dynamicsArray;
+  auto costPerturbed = costArray;
+  for (int i = 0; i < N_; i++) {
+    dynamicsPerturbed[i].dfdx += 0.1 * ocs2::matrix_t::Random(nx_, nx_);
+    costPerturbed[i].dfdu += 0.1 * ocs2::vector_t::Random(nu_);
+  }
+  const auto dynamicsPerturbedSrc = dynamicsPerturbed;
+  const auto costPerturbedSrc = costPerturbed;
+  DWarm = D_array;
+  EWarm = E_array;
+  cWarm = c;
+  const auto numCorrections = ocs2::precondition::ocpDataInPlaceInParallelWarmStart(
+      threadPool, x0, ocpSize_, 1, 5, 0.1, dynamicsPerturbed, costPerturbed, DWarm, EWarm, scalingVectorsWarm, cWarm);
+  EXPECT_GE(numCorrections, 1);
+  EXPECT_LE(numCorrections, 5);
+
+  ocs2::vector_t DStacked(numDecisionVariables_), EStacked(numConstraints_);
+  int curRow = 0;
+  for (auto& v : DWarm) {
+    DStacked.segment(curRow, v.size()) = v;
+    curRow += v.size();
+  }
+  curRow = 0;
+  for (auto& v : EWarm) {
+    EStacked.segment(curRow, v.size()) = v;
+    curRow += v.size();
+  }
+
+  Eigen::SparseMatrix<ocs2::scalar_t> H_src, G_src, H_scaledData, G_scaledData;
+  ocs2::vector_t h_src, g_src, h_scaledData, g_scaledData;
+  ocs2::getCostMatrixSparse(ocpSize_, x0, costPerturbedSrc, H_src, h_src);
+  ocs2::getConstraintMatrixSparse(ocpSize_, x0, dynamicsPerturbedSrc, nullptr, nullptr, G_src, g_src);
+  ocs2::getCostMatrixSparse(ocpSize_, x0, costPerturbed, H_scaledData, h_scaledData);
+  ocs2::getConstraintMatrixSparse(ocpSize_, x0, dynamicsPerturbed, nullptr, &scalingVectorsWarm, G_scaledData, g_scaledData);
+
+  const Eigen::SparseMatrix<ocs2::scalar_t> H_ref = cWarm * DStacked.asDiagonal() * H_src * DStacked.asDiagonal();
+  const ocs2::vector_t h_ref = cWarm * DStacked.asDiagonal() * h_src;
+  const Eigen::SparseMatrix<ocs2::scalar_t> G_ref = EStacked.asDiagonal() * G_src * DStacked.asDiagonal();
+  const ocs2::vector_t g_ref = EStacked.asDiagonal() * g_src;
+  EXPECT_TRUE(H_ref.isApprox(H_scaledData));  // H
+  EXPECT_TRUE(h_ref.isApprox(h_scaledData));  // h
+  EXPECT_TRUE(G_ref.isApprox(G_scaledData));  // G
+  EXPECT_TRUE(g_ref.isApprox(g_scaledData));  // g
+
+  // Mismatching factors fall back to a cold start
+  ocs2::vector_array_t DEmpty, EEmpty;
+  ocs2::scalar_t cEmpty = 1.0;
+  auto dynamicsFallback = dynamicsArray;
+  auto costFallback = costArray;
+  const auto numFallbackSweeps = ocs2::precondition::ocpDataInPlaceInParallelWarmStart(
+      threadPool, x0, ocpSize_, 1, 5, 0.1, dynamicsFallback, costFallback, DEmpty, EEmpty, scalingVectorsWarm, cEmpty);
+  EXPECT_EQ(numFallbackSweeps, 5);
+  EXPECT_DOUBLE_EQ(cEmpty, c);
+}
+
 TEST_F(PreconditionTest, descaleSolution) {
   ocs2::vector_array_t D(2 * N_);
   ocs2::vector_t DStacked(numDecisionVariables_);
@@ -0,0 +1,168 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <ocs2_core/thread_support/ThreadPool.h>
+#include <ocs2_oc/oc_problem/OcpToKkt.h>
+#include <ocs2_oc/qp_backend/AdmmQpBackend.h>
+#include <ocs2_oc/test/testProblemsGeneration.h>
+
+namespace {
+ocs2::admm::Settings configureAdmm(ocs2::scalar_t tolerance) {
+  ocs2::admm::Settings settings;
+  settings.maxNumIterations = 20000;
+  settings.absoluteTolerance = tolerance;
+  settings.relativeTolerance = tolerance;
+  return settings;
+}
+
+/** Solves min 0.5 z' H z + h' z s.t. G z + g = 0 through the dense KKT system. */
+ocs2::vector_t solveDenseEqualityConstrainedQp(const ocs2::ScalarFunctionQuadraticApproximation& cost,
+                                               const ocs2::VectorFunctionLinearApproximation& constraints) {
+  const int m = constraints.dfdx.rows();
+  const int n = constraints.dfdx.cols();
+  ocs2::matrix_t kktMatrix(n + m, n + m);
+  ocs2::vector_t kktRhs(n + m);
+  kktMatrix << cost.dfdxx, constraints.dfdx.transpose(), constraints.dfdx, ocs2::matrix_t::Zero(m, m);
+  kktRhs << -cost.dfdx, -constraints.f;
+  return kktMatrix.fullPivLu().solve(kktRhs).head(n);
+}
+}  // unnamed namespace
+
+class AdmmSolverTest : public testing::Test {
+ protected:
+  // x_0, x_1, ... x_{N - 1}, X_{N}
+  static constexpr size_t N_ = 10;  // numStages
+  static constexpr size_t nx_ = 4;
+  static constexpr size_t nu_ = 3;
+  static constexpr size_t nc_ = 2;
+
+  AdmmSolverTest() : threadPool(2, 50), backend(configureAdmm(1e-8), threadPool) {
+    srand(10);
+
+    // Construct OCP problem
+    x0 = ocs2::vector_t::Random(nx_);
+
+    for (int i = 0; i < N_; i++) {
+      dynamicsArray.push_back(ocs2::getRandomDynamics(nx_, nu_));
+      costArray.push_back(ocs2::getRandomCost(nx_, nu_));
+      constraintsArray.push_back(ocs2::getRandomConstraints(nx_, nu_, nc_));
+    }
+    costArray.push_back(ocs2::getRandomCost(nx_, 0));
+    constraintsArray.push_back(ocs2::getRandomConstraints(nx_, 0, nc_));
+
+    ocpSize = ocs2::extractSizesFromProblem(dynamicsArray, costArray, &constraintsArray);
+    backend.resize(ocpSize);
+  }
+
+  ocs2::OcpSize ocpSize;
+  ocs2::vector_t x0;
+  std::vector<ocs2::VectorFunctionLinearApproximation> dynamicsArray;
+  std::vector<ocs2::ScalarFunctionQuadraticApproximation> costArray;
+  std::vector<ocs2::VectorFunctionLinearApproximation> constraintsArray;
+
+  ocs2::ThreadPool threadPool;
+  ocs2::AdmmQpBackend backend;
+};
+
+constexpr size_t AdmmSolverTest::N_;
+constexpr size_t AdmmSolverTest::nx_;
+constexpr size_t AdmmSolverTest::nu_;
+constexpr size_t AdmmSolverTest::nc_;
+
+TEST_F(AdmmSolverTest, correctness) {
+  // the dense reference uses Gz + g = 0 for constraints
+  ocs2::ScalarFunctionQuadraticApproximation costApproximation;
+  ocs2::VectorFunctionLinearApproximation constraintsApproximation;
+  ocs2::getCostMatrix(ocpSize, x0, costArray, costApproximation);
+  ocs2::getConstraintMatrix(ocpSize, x0, dynamicsArray, &constraintsArray, nullptr, constraintsApproximation);
+  constraintsApproximation.f = -constraintsApproximation.f;
+  const ocs2::vector_t primalSolutionQP = solveDenseEqualityConstrainedQp(costApproximation, constraintsApproximation);
+
+  ocs2::vector_array_t X, U;
+  const auto status = backend.solve(x0, dynamicsArray, costArray, &constraintsArray, X, U);
+  EXPECT_EQ(status, ocs2::OcpQpBackend::Status::SUCCESS);
+  EXPECT_TRUE(X.front().isApprox(x0));
+
+  ocs2::vector_t primalSolutionADMM;
+  ocs2::toKktSolution(X, U, primalSolutionADMM);
+  EXPECT_TRUE(primalSolutionQP.isApprox(primalSolutionADMM, 1e-5)) << "Solution of the QP solver: " << primalSolutionQP.transpose()
+                                                                   << "\nSolution of ADMM: " << primalSolutionADMM.transpose();
+
+  // A warm started solve of the same problem converges within the first termination check and without symbolic analysis.
+  const auto numFactorizations = backend.getSolver().getNumFactorizations();
+  std::ignore = backend.solve(x0, dynamicsArray, costArray, &constraintsArray, X, U);
+  EXPECT_LE(backend.getNumIterations(), backend.getSolver().settings().checkTerminationInterval);
+  EXPECT_EQ(backend.getSolver().getNumFactorizations(), numFactorizations + 1);
+}
+
+TEST(AdmmSolverBoxTest, boxConstraints) {
+  // min 0.5 |x - a|^2 s.t. -1 <= x <= 1 and x_0 + x_1 = 0.5
+  const int n = 6;
+  const ocs2::vector_t a = (ocs2::vector_t(n) << 2.0, -0.5, 0.3, -3.0, 0.9, 1.5).finished();
+  Eigen::SparseMatrix<ocs2::scalar_t> P(n, n);
+  P.setIdentity();
+  Eigen::SparseMatrix<ocs2::scalar_t> A(n + 1, n);
+  std::vector<Eigen::Triplet<ocs2::scalar_t>> triplets;
+  for (int i = 0; i < n; i++) {
+    triplets.emplace_back(i, i, 1.0);
+  }
+  triplets.emplace_back(n, 0, 1.0);
+  triplets.emplace_back(n, 1, 1.0);
+  A.setFromTriplets(triplets.begin(), triplets.end());
+  ocs2::vector_t l = -ocs2::vector_t::Ones(n + 1);
+  ocs2::vector_t u = ocs2::vector_t::Ones(n + 1);
+  l(n) = u(n) = 0.5;
+
+  ocs2::AdmmSolver solver(configureAdmm(1e-9));
+  solver.setMatrices(P, A);
+  ocs2::vector_t x, y;
+  EXPECT_EQ(solver.solve(-a, l, u, x, y), ocs2::OcpQpBackend::Status::SUCCESS);
+
+  // x_0 and x_1 share the violation of the equality: x_0 - 2 = x_1 + 0.5, clipped at the upper bound of x_0.
+  const ocs2::vector_t xExpected = (ocs2::vector_t(n) << 1.0, -0.5, 0.3, -1.0, 0.9, 1.0).finished();
+  EXPECT_TRUE(x.isApprox(xExpected, 1e-6)) << "x: " << x.transpose();
+}
+
+TEST_F(AdmmSolverTest, maxIterations) {
+  auto settings = configureAdmm(1e-12);
+  settings.maxNumIterations = settings.checkTerminationInterval;
+  ocs2::AdmmQpBackend truncatedBackend(settings, threadPool);
+  truncatedBackend.resize(ocpSize);
+
+  // the last iterate is still returned, flagged by the status
+  ocs2::vector_array_t X, U;
+  const auto status = truncatedBackend.solve(x0, dynamicsArray, costArray, &constraintsArray, X, U);
+  EXPECT_EQ(status, ocs2::OcpQpBackend::Status::MAX_ITER);
+  EXPECT_EQ(truncatedBackend.getNumIterations(), settings.maxNumIterations);
+  ASSERT_EQ(X.size(), N_ + 1);
+  ASSERT_EQ(U.size(), N_);
+  EXPECT_TRUE(X.front().isApprox(x0));
+}
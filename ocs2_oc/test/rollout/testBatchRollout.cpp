@@ -0,0 +1,140 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <ocs2_core/Types.h>
+#include <ocs2_core/control/LinearController.h>
+#include <ocs2_core/dynamics/LinearSystemDynamics.h>
+#include <ocs2_oc/rollout/BatchRollout.h>
+#include <ocs2_oc/rollout/TimeTriggeredRollout.h>
+
+using namespace ocs2;
+
+class BatchRolloutTest : public testing::Test {
+ protected:
+  static constexpr size_t nx = 2;
+  static constexpr size_t nu = 1;
+  static constexpr size_t batchSize = 64;
+  static constexpr scalar_t initTime = 0.0;
+  static constexpr scalar_t finalTime = 5.0;
+
+  BatchRolloutTest() : modeSchedule({1.0, 2.5}, {0, 1, 2}) {
+    const matrix_t A = (matrix_t(nx, nx) << -2.0, -1.0, 1.0, 0.0).finished();
+    const matrix_t B = (matrix_t(nx, nu) << 1.0, 0.0).finished();
+    LinearSystemDynamics systemDynamics(A, B);
+
+    rollout::Settings rolloutSettings;
+    rolloutSettings.absTolODE = 1e-7;
+    rolloutSettings.relTolODE = 1e-5;
+    rolloutSettings.timeStep = 1e-3;
+    rolloutSettings.maxNumStepsPerSecond = 10000;
+    rolloutPtr.reset(new TimeTriggeredRollout(systemDynamics, rolloutSettings));
+
+    const scalar_array_t timeStamp{initTime, finalTime};
+    for (size_t i = 0; i < batchSize; i++) {
+      initStateBatch.push_back(vector_t::Random(nx));
+      const vector_array_t uff(2, vector_t::Random(nu));
+      const matrix_array_t k(2, matrix_t::Random(nu, nx));
+      controllerBatch.emplace_back(timeStamp, uff, k);
+    }
+  }
+
+  std::vector<ControllerBase*> getControllerPtrs() {
+    std::vector<ControllerBase*> controllerPtrs;
+    for (auto& controller : controllerBatch) {
+      controllerPtrs.push_back(&controller);
+    }
+    return controllerPtrs;
+  }
+
+  void checkSolution(const PrimalSolution& solution, size_t controllerIndex, const vector_t& initState) {
+    PrimalSolution expected;
+    expected.modeSchedule_ = modeSchedule;
+    rolloutPtr->run(initTime, initState, finalTime, &controllerBatch[controllerIndex], expected.modeSchedule_, expected.timeTrajectory_,
+                    expected.postEventIndices_, expected.stateTrajectory_, expected.inputTrajectory_);
+
+    ASSERT_EQ(solution.timeTrajectory_.size(), expected.timeTrajectory_.size());
+    EXPECT_EQ(solution.postEventIndices_, expected.postEventIndices_);
+    for (size_t k = 0; k < expected.timeTrajectory_.size(); k++) {
+      EXPECT_DOUBLE_EQ(solution.timeTrajectory_[k], expected.timeTrajectory_[k]);
+      EXPECT_TRUE(solution.stateTrajectory_[k].isApprox(expected.stateTrajectory_[k]));
+      EXPECT_TRUE(solution.inputTrajectory_[k].isApprox(expected.inputTrajectory_[k]));
+    }
+  }
+
+  ModeSchedule modeSchedule;
+  std::unique_ptr<TimeTriggeredRollout> rolloutPtr;
+  vector_array_t initStateBatch;
+  std::vector<LinearController> controllerBatch;
+};
+
+constexpr size_t BatchRolloutTest::nx;
+constexpr size_t BatchRolloutTest::nu;
+constexpr size_t BatchRolloutTest::batchSize;
+constexpr scalar_t BatchRolloutTest::initTime;
+constexpr scalar_t BatchRolloutTest::finalTime;
+
+TEST_F(BatchRolloutTest, perStateControllers) {
+  BatchRollout batchRollout(*rolloutPtr, 4);
+
+  std::vector<PrimalSolution> solutionBatch;
+  const auto finalStateBatch = batchRollout.run(initTime, initStateBatch, finalTime, getControllerPtrs(), modeSchedule, solutionBatch);
+
+  ASSERT_EQ(solutionBatch.size(), batchSize);
+  ASSERT_EQ(finalStateBatch.size(), batchSize);
+  for (size_t i = 0; i < batchSize; i++) {
+    checkSolution(solutionBatch[i], i, initStateBatch[i]);
+  }
+}
+
+TEST_F(BatchRolloutTest, sharedController) {
+  BatchRollout batchRollout(*rolloutPtr, 3);
+  std::vector<PrimalSolution> solutionBatch;
+  EXPECT_THROW(batchRollout.run(initTime, initStateBatch, finalTime, modeSchedule, solutionBatch), std::runtime_error);
+
+  // the shared controller is set once and reused by the consecutive runs
+  batchRollout.setSharedController(controllerBatch.front());
+  for (size_t n = 0; n < 2; n++) {
+    batchRollout.run(initTime, initStateBatch, finalTime, modeSchedule, solutionBatch);
+    ASSERT_EQ(solutionBatch.size(), batchSize);
+    for (size_t i = 0; i < batchSize; i++) {
+      checkSolution(solutionBatch[i], 0, initStateBatch[i]);
+    }
+  }
+
+  // a new policy takes effect once it is set
+  batchRollout.setSharedController(controllerBatch.back());
+  batchRollout.run(initTime, initStateBatch, finalTime, modeSchedule, solutionBatch);
+  for (size_t i = 0; i < batchSize; i++) {
+    checkSolution(solutionBatch[i], batchSize - 1, initStateBatch[i]);
+  }
+}
@@ -27,10 +27,15 @@ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ******************************************************************************/
 
+#include <functional>
+#include <iostream>
+#include <memory>
+
 #include <gtest/gtest.h>
 
 #include <ocs2_core/Types.h>
 #include <ocs2_core/control/LinearController.h>
+#include <ocs2_core/misc/Benchmark.h>
 #include <ocs2_oc/rollout/RolloutSettings.h>
 #include <ocs2_oc/rollout/StateTriggeredRollout.h>
 
@@ -302,3 +307,80 @@ TEST(StateRolloutTests, runHybridDynamics) {
     EXPECT_NEAR(eventTestTimes[i], modeSchedule.eventTimes[i], 1e-6);
   }
 }
+
+/*
+ * 		Test 4 for StateTriggeredRollout
+ * 		Compares the event localization by re-integration with the localization on the interpolant of the integration step, for the
+ * 		bouncing ball (two guard surfaces) and the hybrid system. The rollout time and the number of function evaluations of both
+ * 		methods are reported.
+ *
+ * 		The following tests are implemented and performed:
+ *
+ * 		-	Event times compared to accurate run of rollout
+ * 		- 	No penetration of Guard Surfaces
+ * 		- 	Less function evaluations with the interpolant-based localization
+ */
+TEST(StateRolloutTests, denseOutputEventLocalization) {
+  struct RolloutResult {
+    ocs2::ModeSchedule modeSchedule;
+    scalar_array_t timeTrajectory;
+    vector_array_t stateTrajectory;
+    size_t numFunctionCalls;
+    scalar_t rolloutTimeInMilliseconds;
+  };
+
+  auto runRollout = [](const ocs2::ControlledSystemBase& dynamics, const vector_t& initState, scalar_t finalTime,
+                       ocs2::rollout::Settings rolloutSettings, bool useDenseOutput) {
+    rolloutSettings.useDenseOutputEventLocalization = useDenseOutput;
+    ocs2::StateTriggeredRollout rollout(dynamics, rolloutSettings);
+    ocs2::LinearController control({0.0}, {vector_t::Zero(1)}, {matrix_t::Zero(1, initState.size())});
+
+    RolloutResult result;
+    size_array_t postEventIndices;
+    vector_array_t inputTrajectory;
+    ocs2::benchmark::RepeatedTimer timer;
+    timer.startTimer();
+    rollout.run(0.0, initState, finalTime, &control, result.modeSchedule, result.timeTrajectory, postEventIndices, result.stateTrajectory,
+                inputTrajectory);
+    timer.endTimer();
+    result.numFunctionCalls = rollout.systemDynamicsPtr()->getNumFunctionCalls();
+    result.rolloutTimeInMilliseconds = timer.getLastIntervalInMilliseconds();
+    return result;
+  };
+
+  auto compare = [&](const std::string& name, const ocs2::ControlledSystemBase& dynamics, const vector_t& initState, scalar_t finalTime,
+                     const ocs2::rollout::Settings& rolloutSettings, scalar_t eventTimeTolerance,
+                     const std::function<scalar_t(const vector_t&)>& activeGuardSurface) {
+    const auto reintegration = runRollout(dynamics, initState, finalTime, rolloutSettings, false);
+    const auto denseOutput = runRollout(dynamics, initState, finalTime, rolloutSettings, true);
+
+    std::cerr << "[" << name << "] re-integration: " << reintegration.rolloutTimeInMilliseconds << " [ms], "
+              << reintegration.numFunctionCalls << " function calls\n";
+    std::cerr << "[" << name << "] dense output:   " << denseOutput.rolloutTimeInMilliseconds << " [ms], " << denseOutput.numFunctionCalls
+              << " function calls\n";
+
+    EXPECT_LT(denseOutput.numFunctionCalls, reintegration.numFunctionCalls);
+    EXPECT_EQ(denseOutput.modeSchedule.modeSequence, reintegration.modeSchedule.modeSequence);
+    ASSERT_EQ(denseOutput.modeSchedule.eventTimes.size(), reintegration.modeSchedule.eventTimes.size());
+    for (size_t i = 0; i < reintegration.modeSchedule.eventTimes.size(); i++) {
+      EXPECT_NEAR(denseOutput.modeSchedule.eventTimes[i], reintegration.modeSchedule.eventTimes[i], eventTimeTolerance);
+    }
+    std::unique_ptr<ocs2::ControlledSystemBase> dynamicsPtr(dynamics.clone());
+    for (size_t k = 0; k < denseOutput.timeTrajectory.size(); k++) {
+      const vector_t guardSurfaces = dynamicsPtr->computeGuardSurfaces(denseOutput.timeTrajectory[k], denseOutput.stateTrajectory[k]);
+      EXPECT_GT(activeGuardSurface(guardSurfaces), -1e-6);
+    }
+  };
+
+  ocs2::rollout::Settings ballRolloutSettings;
+  ballRolloutSettings.absTolODE = 1e-10;
+  ballRolloutSettings.relTolODE = 1e-7;
+  ballRolloutSettings.timeStep = 1e-3;
+  // the second guard surface of the ball (x < 0.5) is negative by design whenever the ball is above 0.5
+  compare("BallDynamics", ocs2::ballDyn(), (vector_t(2) << 1.0, 0.0).finished(), 10.0, ballRolloutSettings, 1e-6,
+          [](const vector_t& guardSurfaces) { return guardSurfaces[0]; });
+
+  // the inactive guard surface of each subsystem is constant one
+  compare("HybridDynamics", ocs2::HybridSysDynamics(), (vector_t(3) << 5.0, 2.0, 1.0).finished(), 5.0, ocs2::rollout::Settings(), 1e-6,
+          [](const vector_t& guardSurfaces) { return guardSurfaces.minCoeff(); });
+}
@@ -0,0 +1,97 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "ocs2_oc/search_strategy/FilterLinesearch.h"
+
+using namespace ocs2;
+
+namespace {
+PerformanceIndex getPerformance(scalar_t merit, scalar_t constraintViolation) {
+  PerformanceIndex performance;
+  performance.merit = merit;
+  performance.cost = merit;
+  performance.dynamicsViolationSSE = constraintViolation * constraintViolation;
+  return performance;
+}
+}  // unnamed namespace
+
+TEST(testFilterLinesearch, withoutHistory) {
+  FilterLinesearch filterLinesearch;
+  const auto baseline = getPerformance(10.0, 1.0);
+  filterLinesearch.augmentFilter(baseline, FilterLinesearch::StepType::DUAL);
+  EXPECT_EQ(filterLinesearch.filterSize(), 0);
+
+  // Only compared against the baseline
+  EXPECT_TRUE(filterLinesearch.acceptStep(baseline, getPerformance(9.0, 1.5), -1.0).first);
+  EXPECT_TRUE(filterLinesearch.acceptStep(baseline, getPerformance(11.0, 0.5), -1.0).first);
+  EXPECT_FALSE(filterLinesearch.acceptStep(baseline, getPerformance(11.0, 1.5), -1.0).first);
+}
+
+TEST(testFilterLinesearch, rejectDominatedStep) {
+  FilterLinesearch filterLinesearch;
+  filterLinesearch.maxHistory = 10;
+
+  // First iteration: (10, 1) -> (9, 1.5)
+  filterLinesearch.augmentFilter(getPerformance(10.0, 1.0), FilterLinesearch::StepType::DUAL);
+  ASSERT_EQ(filterLinesearch.filterSize(), 1);
+
+  // A step back to (11, 1.2) decreases the constraint violation w.r.t. the new baseline, but it is dominated by the first iterate
+  const auto baseline = getPerformance(9.0, 1.5);
+  const auto step = getPerformance(11.0, 1.2);
+  EXPECT_FALSE(filterLinesearch.isAcceptableToFilter(step));
+  EXPECT_FALSE(filterLinesearch.acceptStep(baseline, step, -1.0).first);
+
+  // Improving either the merit or the constraint violation of the first iterate is acceptable
+  EXPECT_TRUE(filterLinesearch.acceptStep(baseline, getPerformance(8.0, 1.2), -1.0).first);
+  EXPECT_TRUE(filterLinesearch.acceptStep(baseline, getPerformance(11.0, 0.5), -1.0).first);
+
+  filterLinesearch.clearFilter();
+  EXPECT_TRUE(filterLinesearch.acceptStep(baseline, step, -1.0).first);
+}
+
+TEST(testFilterLinesearch, boundedHistory) {
+  FilterLinesearch filterLinesearch;
+  filterLinesearch.maxHistory = 2;
+
+  // Armijo steps do not augment the filter
+  filterLinesearch.augmentFilter(getPerformance(1.0, 0.0), FilterLinesearch::StepType::COST);
+  EXPECT_EQ(filterLinesearch.filterSize(), 0);
+
+  filterLinesearch.augmentFilter(getPerformance(10.0, 1.0), FilterLinesearch::StepType::DUAL);
+  filterLinesearch.augmentFilter(getPerformance(20.0, 0.5), FilterLinesearch::StepType::DUAL);
+  EXPECT_FALSE(filterLinesearch.isAcceptableToFilter(getPerformance(11.0, 1.1)));
+
+  // The oldest entry is dropped
+  filterLinesearch.augmentFilter(getPerformance(30.0, 0.2), FilterLinesearch::StepType::CONSTRAINT);
+  EXPECT_EQ(filterLinesearch.filterSize(), 2);
+  EXPECT_TRUE(filterLinesearch.isAcceptableToFilter(getPerformance(11.0, 1.1)));
+  EXPECT_FALSE(filterLinesearch.isAcceptableToFilter(getPerformance(21.0, 0.6)));
+}
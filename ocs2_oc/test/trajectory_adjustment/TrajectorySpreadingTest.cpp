@@ -134,6 +134,13 @@ class TrajectorySpreadingTest : public testing::Test {
     out.eventDataArray = trajectorySpreadingPtr->extractEventsArray(out.eventDataArray);
     out.preEventModeTrajectory = trajectorySpreadingPtr->extractEventsArray(out.preEventModeTrajectory);
 
+    // the contiguous storage is adjusted identically
+    ocs2::contiguous_vector_array_t contiguousStateTrajectory(in.stateTrajectory);
+    trajectorySpreadingPtr->adjustTrajectory(contiguousStateTrajectory);
+    EXPECT_TRUE(contiguousStateTrajectory.toArray() == out.stateTrajectory);
+    const auto contiguousEventDataArray = trajectorySpreadingPtr->extractEventsArray(ocs2::contiguous_vector_array_t(in.eventDataArray));
+    EXPECT_TRUE(contiguousEventDataArray.toArray() == out.eventDataArray);
+
     return {out, status};
   }
 
@@ -0,0 +1,77 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+ * Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+ * Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+#include <ocs2_core/control/FeedforwardController.h>
+#include <ocs2_core/misc/Benchmark.h>
+#include <ocs2_oc/rollout/BatchRollout.h>
+
+#include "ocs2_ballbot/BallbotInterface.h"
+#include "ocs2_ballbot/package_path.h"
+
+using namespace ocs2;
+using namespace ballbot;
+
+TEST(Ballbot, BatchRolloutThroughput) {
+  constexpr size_t batchSize = 128;
+  constexpr size_t numRepetitions = 5;
+  constexpr scalar_t initTime = 0.0;
+  constexpr scalar_t finalTime = 1.0;
+
+  const std::string taskFile = ballbot::getPath() + "/config/mpc/task.info";
+  const std::string libFolder = ballbot::getPath() + "/auto_generated";
+  BallbotInterface ballbotInterface(taskFile, libFolder);
+  const auto& rollout = ballbotInterface.getRollout();
+
+  vector_array_t initStateBatch(batchSize);
+  for (auto& initState : initStateBatch) {
+    initState = ballbotInterface.getInitialState() + 0.05 * vector_t::Random(STATE_DIM);
+  }
+  const scalar_array_t timeStamp{initTime, finalTime};
+  FeedforwardController controller(timeStamp, vector_array_t(2, vector_t::Zero(INPUT_DIM)));
+
+  for (const size_t nThreads : {1, 2, 4}) {
+    BatchRollout batchRollout(rollout, nThreads);
+    batchRollout.setSharedController(controller);
+    std::vector<PrimalSolution> solutionBatch;
+    benchmark::RepeatedTimer timer;
+    for (size_t n = 0; n < numRepetitions; n++) {
+      timer.startTimer();
+      batchRollout.run(initTime, initStateBatch, finalTime, ModeSchedule(), solutionBatch);
+      timer.endTimer();
+    }
+
+    ASSERT_EQ(solutionBatch.size(), batchSize);
+    std::cerr << "[Ballbot::BatchRolloutThroughput] threads: " << nThreads
+              << "\t rollouts/sec: " << 1000.0 * batchSize / timer.getAverageInMilliseconds() << '\n';
+  }
+}
@@ -0,0 +1,135 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <ocs2_core/Types.h>
+#include <ocs2_core/reference/ModeSchedule.h>
+#include <ocs2_core/reference/TargetTrajectories.h>
+#include <ocs2_oc/oc_solver/SolverBase.h>
+#include <ocs2_oc/rollout/RolloutBase.h>
+#include <ocs2_robotic_tools/common/RobotInterface.h>
+
+namespace ocs2 {
+namespace solver_benchmark {
+
+/** The benchmarked solvers. */
+enum class SolverType { SQP, IPM, SLP, SLQ, ILQR };
+
+/** All the solver types. */
+const std::vector<SolverType>& allSolverTypes();
+
+/** The name of the solver. */
+std::string toString(SolverType type);
+
+/** A benchmark problem of the catalog. */
+struct Problem {
+  /** The task file with the settings of the solvers. Missing settings have their default values. */
+  std::string taskFile;
+  std::unique_ptr<RobotInterface> interfacePtr;
+  /** The rollout of the DDP solvers. */
+  const RolloutBase* rolloutPtr = nullptr;
+  vector_t initState;
+  TargetTrajectories targetTrajectories;
+  /** The initial mode schedule of the reference manager, which is restored before each configuration. */
+  ModeSchedule modeSchedule;
+  /** The MPC horizon of the task file. */
+  scalar_t timeHorizon = 1.0;
+};
+
+/** Creates a new instance of a problem. */
+using ProblemFactory = std::function<Problem()>;
+
+/** The benchmark settings. */
+struct Settings {
+  std::vector<size_t> numThreads = {1, 2, 4};
+  /** The horizons as multiples of the MPC horizon of the task file. */
+  std::vector<scalar_t> horizonScales = {0.5, 1.0, 2.0};
+  /** The number of MPC runs along the closed loop trajectory. */
+  size_t numMpcRuns = 100;
+  /** The time between two MPC runs. */
+  scalar_t mpcTimeStep = 0.01;
+  /** The first runs are not measured, e.g., the cold start of the solver. */
+  size_t numWarmupRuns = 5;
+};
+
+/** The statistics of one problem, solver, thread count, and horizon. */
+struct Result {
+  std::string problem;
+  std::string solver;
+  size_t numThreads = 0;
+  scalar_t timeHorizon = 0.0;
+  size_t numRuns = 0;
+  scalar_t medianSolveTimeInMilliseconds = 0.0;
+  scalar_t p99SolveTimeInMilliseconds = 0.0;
+  scalar_t maxSolveTimeInMilliseconds = 0.0;
+  scalar_t meanIterations = 0.0;
+  /** The mean number of heap allocations (calls to the malloc family of functions) per run, or -1 if they are not counted. */
+  scalar_t meanAllocations = -1.0;
+  /** The exception message if the solver is not applicable to the problem, empty otherwise. */
+  std::string error;
+};
+
+/**
+ * Creates a solver for the problem. The settings are loaded from the task file of the problem, with the printing disabled.
+ *
+ * @param [in] type: The solver type.
+ * @param [in] problem: The problem.
+ * @param [in] numThreads: The number of threads of the solver.
+ * @return The solver with the reference manager of the problem.
+ */
+std::unique_ptr<SolverBase> createSolver(SolverType type, const Problem& problem, size_t numThreads);
+
+/**
+ * Runs the MPC of one configuration with a new solver. The references of the problem are reset to their initial values first. The
+ * state of the next run is the predicted state of the current solution, which makes the benchmark deterministic for a given problem.
+ *
+ * @param [in] problemName: The name of the problem in the results.
+ * @param [in] problem: The problem, shared by all the configurations.
+ * @param [in] type: The solver type.
+ * @param [in] numThreads: The number of threads of the solver.
+ * @param [in] horizonScale: The horizon as a multiple of the MPC horizon of the task file.
+ * @param [in] settings: The benchmark settings.
+ * @param [in] getNumAllocations: Returns the total number of heap allocations of the process. May be empty.
+ * @return The statistics of the measured runs. Result::error is set if the solver throws.
+ */
+Result run(const std::string& problemName, const Problem& problem, SolverType type, size_t numThreads, scalar_t horizonScale,
+           const Settings& settings, const std::function<size_t()>& getNumAllocations = {});
+
+/** Writes the results as a JSON array. */
+void writeJson(std::ostream& stream, const std::vector<Result>& results);
+
+}  // namespace solver_benchmark
+}  // namespace ocs2
@@ -0,0 +1,167 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_benchmark/ProblemCatalog.h"
+
+#include <ocs2_ballbot/BallbotInterface.h>
+#include <ocs2_ballbot/definitions.h>
+#include <ocs2_ballbot/package_path.h>
+#include <ocs2_cartpole/CartPoleInterface.h>
+#include <ocs2_cartpole/definitions.h>
+#include <ocs2_cartpole/package_path.h>
+#include <ocs2_double_integrator/DoubleIntegratorInterface.h>
+#include <ocs2_double_integrator/definitions.h>
+#include <ocs2_double_integrator/package_path.h>
+#include <ocs2_legged_robot/LeggedRobotInterface.h>
+#include <ocs2_legged_robot/package_path.h>
+#include <ocs2_mobile_manipulator/MobileManipulatorInterface.h>
+#include <ocs2_mobile_manipulator/package_path.h>
+#include <ocs2_quadrotor/QuadrotorInterface.h>
+#include <ocs2_quadrotor/definitions.h>
+#include <ocs2_quadrotor/package_path.h>
+#include <ocs2_robotic_assets/package_path.h>
+
+namespace ocs2 {
+namespace solver_benchmark {
+
+namespace {
+
+/** Regulation to a constant target. */
+TargetTrajectories constantTarget(const vector_t& state, size_t inputDim) {
+  return TargetTrajectories({0.0}, {state}, {vector_t::Zero(inputDim)});
+}
+
+/** The mode schedule of the interface's reference manager before any MPC run. */
+ModeSchedule initialModeSchedule(const RobotInterface& interface) {
+  const auto referenceManagerPtr = interface.getReferenceManagerPtr();
+  return (referenceManagerPtr != nullptr) ? referenceManagerPtr->getModeSchedule() : ModeSchedule();
+}
+
+Problem createCartpole() {
+  Problem problem;
+  problem.taskFile = cartpole::getPath() + "/config/mpc/task.info";
+  auto interfacePtr = std::make_unique<cartpole::CartPoleInterface>(problem.taskFile, cartpole::getPath() + "/auto_generated", false);
+  problem.rolloutPtr = &interfacePtr->getRollout();
+  problem.initState = interfacePtr->getInitialState();
+  problem.targetTrajectories = constantTarget(interfacePtr->getInitialTarget(), cartpole::INPUT_DIM);
+  problem.modeSchedule = initialModeSchedule(*interfacePtr);
+  problem.timeHorizon = interfacePtr->mpcSettings().timeHorizon_;
+  problem.interfacePtr = std::move(interfacePtr);
+  return problem;
+}
+
+Problem createBallbot() {
+  Problem problem;
+  problem.taskFile = ballbot::getPath() + "/config/mpc/task.info";
+  auto interfacePtr = std::make_unique<ballbot::BallbotInterface>(problem.taskFile, ballbot::getPath() + "/auto_generated");
+  problem.rolloutPtr = &interfacePtr->getRollout();
+  problem.initState = interfacePtr->getInitialState();
+  problem.targetTrajectories = constantTarget(problem.initState, ballbot::INPUT_DIM);
+  problem.modeSchedule = initialModeSchedule(*interfacePtr);
+  problem.timeHorizon = interfacePtr->mpcSettings().timeHorizon_;
+  problem.interfacePtr = std::move(interfacePtr);
+  return problem;
+}
+
+Problem createQuadrotor() {
+  Problem problem;
+  problem.taskFile = quadrotor::getPath() + "/config/mpc/task.info";
+  auto interfacePtr = std::make_unique<quadrotor::QuadrotorInterface>(problem.taskFile, quadrotor::getPath() + "/auto_generated");
+  problem.rolloutPtr = &interfacePtr->getRollout();
+  problem.initState = interfacePtr->getInitialState();
+  problem.targetTrajectories = constantTarget(problem.initState, quadrotor::INPUT_DIM);
+  problem.modeSchedule = initialModeSchedule(*interfacePtr);
+  problem.timeHorizon = interfacePtr->mpcSettings().timeHorizon_;
+  problem.interfacePtr = std::move(interfacePtr);
+  return problem;
+}
+
+Problem createDoubleIntegrator() {
+  Problem problem;
+  problem.taskFile = double_integrator::getPath() + "/config/mpc/task.info";
+  const std::string libraryFolder = double_integrator::getPath() + "/auto_generated";
+  auto interfacePtr = std::make_unique<double_integrator::DoubleIntegratorInterface>(problem.taskFile, libraryFolder, false);
+  problem.rolloutPtr = &interfacePtr->getRollout();
+  problem.initState = interfacePtr->getInitialState();
+  problem.targetTrajectories = constantTarget(interfacePtr->getInitialTarget(), double_integrator::INPUT_DIM);
+  problem.modeSchedule = initialModeSchedule(*interfacePtr);
+  problem.timeHorizon = interfacePtr->mpcSettings().timeHorizon_;
+  problem.interfacePtr = std::move(interfacePtr);
+  return problem;
+}
+
+Problem createMobileManipulator() {
+  Problem problem;
+  problem.taskFile = mobile_manipulator::getPath() + "/config/mabi_mobile/task.info";
+  const std::string urdfFile = robotic_assets::getPath() + "/resources/mobile_manipulator/mabi_mobile/urdf/mabi_mobile.urdf";
+  const std::string libraryFolder = mobile_manipulator::getPath() + "/auto_generated/mabi_mobile";
+  auto interfacePtr = std::make_unique<mobile_manipulator::MobileManipulatorInterface>(problem.taskFile, libraryFolder, urdfFile);
+  problem.rolloutPtr = &interfacePtr->getRollout();
+  problem.initState = interfacePtr->getInitialState();
+  // end-effector position and orientation (quaternion coefficients)
+  vector_t target(7);
+  target << 1.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0;
+  problem.targetTrajectories = constantTarget(target, interfacePtr->getManipulatorModelInfo().inputDim);
+  problem.modeSchedule = initialModeSchedule(*interfacePtr);
+  problem.timeHorizon = interfacePtr->mpcSettings().timeHorizon_;
+  problem.interfacePtr = std::move(interfacePtr);
+  return problem;
+}
+
+Problem createLeggedRobot() {
+  Problem problem;
+  problem.taskFile = legged_robot::getPath() + "/config/mpc/task.info";
+  const std::string urdfFile = robotic_assets::getPath() + "/resources/anymal_c/urdf/anymal.urdf";
+  const std::string referenceFile = legged_robot::getPath() + "/config/command/reference.info";
+  auto interfacePtr = std::make_unique<legged_robot::LeggedRobotInterface>(problem.taskFile, urdfFile, referenceFile);
+  problem.rolloutPtr = &interfacePtr->getRollout();
+  problem.initState = interfacePtr->getInitialState();
+  problem.targetTrajectories = constantTarget(problem.initState, interfacePtr->getCentroidalModelInfo().inputDim);
+  problem.modeSchedule = initialModeSchedule(*interfacePtr);
+  problem.timeHorizon = interfacePtr->mpcSettings().timeHorizon_;
+  problem.interfacePtr = std::move(interfacePtr);
+  return problem;
+}
+
+}  // unnamed namespace
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+std::vector<std::pair<std::string, ProblemFactory>> getProblemCatalog() {
+  return {{"cartpole", createCartpole},
+          {"ballbot", createBallbot},
+          {"quadrotor", createQuadrotor},
+          {"double_integrator", createDoubleIntegrator},
+          {"mobile_manipulator", createMobileManipulator},
+          {"legged_robot", createLeggedRobot}};
+}
+
+}  // namespace solver_benchmark
+}  // namespace ocs2
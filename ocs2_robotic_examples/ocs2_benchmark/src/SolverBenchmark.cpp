@@ -0,0 +1,249 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_benchmark/SolverBenchmark.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <numeric>
+
+#include <ocs2_core/misc/Benchmark.h>
+#include <ocs2_core/misc/LinearInterpolation.h>
+
+#include <ocs2_ddp/ILQR.h>
+#include <ocs2_ddp/SLQ.h>
+#include <ocs2_ipm/IpmSolver.h>
+#include <ocs2_slp/SlpSolver.h>
+#include <ocs2_sqp/SqpSolver.h>
+
+namespace ocs2 {
+namespace solver_benchmark {
+
+namespace {
+
+/** The value below which the given fraction of the sorted values lies (nearest rank). */
+scalar_t percentile(const std::vector<scalar_t>& sortedValues, scalar_t fraction) {
+  const auto rank = static_cast<size_t>(std::ceil(fraction * sortedValues.size()));
+  return sortedValues[std::max<size_t>(rank, 1) - 1];
+}
+
+/** Escapes the quotes, backslashes, and control characters of a JSON string. */
+std::string escapeJson(const std::string& text) {
+  std::string escaped;
+  for (const char c : text) {
+    if (c == '"' || c == '\\') {
+      escaped += '\\';
+      escaped += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      escaped += ' ';
+    } else {
+      escaped += c;
+    }
+  }
+  return escaped;
+}
+
+}  // unnamed namespace
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+const std::vector<SolverType>& allSolverTypes() {
+  static const std::vector<SolverType> types{SolverType::SQP, SolverType::IPM, SolverType::SLP, SolverType::SLQ, SolverType::ILQR};
+  return types;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+std::string toString(SolverType type) {
+  switch (type) {
+    case SolverType::SQP:
+      return "SQP";
+    case SolverType::IPM:
+      return "IPM";
+    case SolverType::SLP:
+      return "SLP";
+    case SolverType::SLQ:
+      return "SLQ";
+    case SolverType::ILQR:
+      return "ILQR";
+    default:
+      throw std::runtime_error("[solver_benchmark::toString] Undefined solver type!");
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+std::unique_ptr<SolverBase> createSolver(SolverType type, const Problem& problem, size_t numThreads) {
+  const auto& optimalControlProblem = problem.interfacePtr->getOptimalControlProblem();
+  const auto& initializer = problem.interfacePtr->getInitializer();
+
+  std::unique_ptr<SolverBase> solverPtr;
+  switch (type) {
+    case SolverType::SQP: {
+      auto settings = sqp::loadSettings(problem.taskFile, "sqp", false);
+      settings.nThreads = numThreads;
+      settings.printSolverStatus = settings.printSolverStatistics = settings.printLinesearch = false;
+      solverPtr.reset(new SqpSolver(std::move(settings), optimalControlProblem, initializer));
+      break;
+    }
+    case SolverType::IPM: {
+      auto settings = ipm::loadSettings(problem.taskFile, "ipm", false);
+      settings.nThreads = numThreads;
+      settings.printSolverStatus = settings.printSolverStatistics = settings.printLinesearch = false;
+      solverPtr.reset(new IpmSolver(std::move(settings), optimalControlProblem, initializer));
+      break;
+    }
+    case SolverType::SLP: {
+      auto settings = slp::loadSettings(problem.taskFile, "slp", false);
+      settings.nThreads = numThreads;
+      settings.printSolverStatus = settings.printSolverStatistics = settings.printLinesearch = false;
+      solverPtr.reset(new SlpSolver(std::move(settings), optimalControlProblem, initializer));
+      break;
+    }
+    case SolverType::SLQ:
+    case SolverType::ILQR: {
+      if (problem.rolloutPtr == nullptr) {
+        throw std::runtime_error("[solver_benchmark::createSolver] The problem has no rollout for the DDP solvers!");
+      }
+      auto settings = ddp::loadSettings(problem.taskFile, "ddp", false);
+      settings.algorithm_ = (type == SolverType::SLQ) ? ddp::Algorithm::SLQ : ddp::Algorithm::ILQR;
+      settings.nThreads_ = numThreads;
+      settings.displayInfo_ = settings.displayShortSummary_ = settings.debugPrintRollout_ = false;
+      if (type == SolverType::SLQ) {
+        solverPtr.reset(new SLQ(std::move(settings), *problem.rolloutPtr, optimalControlProblem, initializer));
+      } else {
+        solverPtr.reset(new ILQR(std::move(settings), *problem.rolloutPtr, optimalControlProblem, initializer));
+      }
+      break;
+    }
+    default:
+      throw std::runtime_error("[solver_benchmark::createSolver] Undefined solver type!");
+  }
+
+  const auto referenceManagerPtr = problem.interfacePtr->getReferenceManagerPtr();
+  if (referenceManagerPtr != nullptr) {
+    solverPtr->setReferenceManager(referenceManagerPtr);
+  }
+  return solverPtr;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+Result run(const std::string& problemName, const Problem& problem, SolverType type, size_t numThreads, scalar_t horizonScale,
+           const Settings& settings, const std::function<size_t()>& getNumAllocations) {
+  Result result;
+  result.problem = problemName;
+  result.solver = toString(type);
+  result.numThreads = numThreads;
+
+  try {
+    result.timeHorizon = horizonScale * problem.timeHorizon;
+    auto solverPtr = createSolver(type, problem, numThreads);
+    // the previous configurations advanced the references of the problem
+    solverPtr->getReferenceManager().setModeSchedule(problem.modeSchedule);
+    solverPtr->getReferenceManager().setTargetTrajectories(problem.targetTrajectories);
+
+    std::vector<scalar_t> solveTimes;
+    solveTimes.reserve(settings.numMpcRuns);
+    size_t numIterations = 0;
+    size_t numAllocations = 0;
+    benchmark::RepeatedTimer timer;
+    PrimalSolution primalSolution;
+    vector_t state = problem.initState;
+    for (size_t i = 0; i < settings.numWarmupRuns + settings.numMpcRuns; i++) {
+      const scalar_t time = i * settings.mpcTimeStep;
+      const size_t initIterations = solverPtr->getNumIterations();
+      const size_t initAllocations = getNumAllocations ? getNumAllocations() : 0;
+      timer.startTimer();
+      solverPtr->run(time, state, time + result.timeHorizon);
+      timer.endTimer();
+      const size_t allocations = getNumAllocations ? getNumAllocations() - initAllocations : 0;
+
+      if (i >= settings.numWarmupRuns) {
+        solveTimes.push_back(timer.getLastIntervalInMilliseconds());
+        numIterations += solverPtr->getNumIterations() - initIterations;
+        numAllocations += allocations;
+      }
+
+      // the closed loop follows the optimized trajectory
+      const scalar_t nextTime = time + settings.mpcTimeStep;
+      solverPtr->getPrimalSolution(time + result.timeHorizon, &primalSolution);
+      state = LinearInterpolation::interpolate(nextTime, primalSolution.timeTrajectory_, primalSolution.stateTrajectory_);
+    }
+
+    if (!solveTimes.empty()) {
+      std::sort(solveTimes.begin(), solveTimes.end());
+      result.numRuns = solveTimes.size();
+      result.medianSolveTimeInMilliseconds = percentile(solveTimes, 0.5);
+      result.p99SolveTimeInMilliseconds = percentile(solveTimes, 0.99);
+      result.maxSolveTimeInMilliseconds = solveTimes.back();
+      result.meanIterations = static_cast<scalar_t>(numIterations) / result.numRuns;
+      if (getNumAllocations) {
+        result.meanAllocations = static_cast<scalar_t>(numAllocations) / result.numRuns;
+      }
+    }
+  } catch (const std::exception& e) {
+    result.error = e.what();
+  }
+  return result;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void writeJson(std::ostream& stream, const std::vector<Result>& results) {
+  const auto precision = stream.precision(6);
+  stream << "[\n";
+  for (size_t i = 0; i < results.size(); i++) {
+    const auto& result = results[i];
+    stream << "  {\"problem\": \"" << escapeJson(result.problem) << "\", \"solver\": \"" << result.solver << "\""
+           << ", \"threads\": " << result.numThreads << ", \"horizon\": " << result.timeHorizon << ", \"runs\": " << result.numRuns
+           << ", \"median_ms\": " << result.medianSolveTimeInMilliseconds << ", \"p99_ms\": " << result.p99SolveTimeInMilliseconds
+           << ", \"max_ms\": " << result.maxSolveTimeInMilliseconds << ", \"iterations\": " << result.meanIterations;
+    if (result.meanAllocations >= 0.0) {
+      stream << ", \"allocations\": " << result.meanAllocations;
+    } else {
+      stream << ", \"allocations\": null";
+    }
+    if (!result.error.empty()) {
+      stream << ", \"error\": \"" << escapeJson(result.error) << "\"";
+    }
+    stream << ((i + 1 < results.size()) ? "},\n" : "}\n");
+  }
+  stream << "]\n";
+  stream.precision(precision);
+}
+
+}  // namespace solver_benchmark
+}  // namespace ocs2
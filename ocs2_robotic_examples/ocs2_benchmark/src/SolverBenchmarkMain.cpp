@@ -0,0 +1,154 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+#include "ocs2_benchmark/ProblemCatalog.h"
+#include "ocs2_benchmark/SolverBenchmark.h"
+
+#ifdef __GLIBC__
+namespace {
+std::atomic<size_t> numAllocations{0};
+}  // unnamed namespace
+
+/**
+ * Counts the heap allocations of the process by interposing the allocation functions of glibc. All the operator new overloads of
+ * libstdc++ and the Eigen allocations end up in these functions.
+ */
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t num, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+
+void* malloc(size_t size) noexcept {
+  numAllocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_malloc(size);
+}
+
+void* calloc(size_t num, size_t size) noexcept {
+  numAllocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_calloc(num, size);
+}
+
+void* realloc(void* ptr, size_t size) noexcept {
+  numAllocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_realloc(ptr, size);
+}
+
+void* memalign(size_t alignment, size_t size) noexcept {
+  numAllocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_memalign(alignment, size);
+}
+
+void* aligned_alloc(size_t alignment, size_t size) noexcept {
+  numAllocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** ptr, size_t alignment, size_t size) noexcept {
+  if (alignment % sizeof(void*) != 0 || (alignment & (alignment - 1)) != 0) {
+    return EINVAL;
+  }
+  numAllocations.fetch_add(1, std::memory_order_relaxed);
+  void* result = __libc_memalign(alignment, size);
+  if (result == nullptr) {
+    return ENOMEM;
+  }
+  *ptr = result;
+  return 0;
+}
+}  // extern "C"
+#endif
+
+/**
+ * Usage: ocs2_solver_benchmark [output.json] [problem ...]
+ * Without the output file the results are written to stdout. Without problem names all problems of the catalog are benchmarked.
+ */
+int main(int argc, char** argv) {
+  using namespace ocs2;
+  using namespace ocs2::solver_benchmark;
+
+  const std::string outputFile = (argc > 1) ? argv[1] : "";
+  const std::vector<std::string> problemNames(argv + std::min(argc, 2), argv + argc);
+  const auto isSelected = [&](const std::string& name) {
+    return problemNames.empty() || std::find(problemNames.begin(), problemNames.end(), name) != problemNames.end();
+  };
+#ifdef __GLIBC__
+  const std::function<size_t()> getNumAllocations = []() { return numAllocations.load(std::memory_order_relaxed); };
+#else
+  const std::function<size_t()> getNumAllocations;
+#endif
+
+  const Settings settings;
+  std::vector<Result> results;
+  for (const auto& entry : getProblemCatalog()) {
+    if (!isSelected(entry.first)) {
+      continue;
+    }
+
+    // the problem is created once and shared by all the configurations, which restore its initial references
+    Problem problem;
+    try {
+      problem = entry.second();
+    } catch (const std::exception& e) {
+      std::cerr << "[SolverBenchmark] Could not create " << entry.first << ": " << e.what() << "\n";
+      continue;
+    }
+
+    for (const auto solverType : allSolverTypes()) {
+      for (const auto numThreads : settings.numThreads) {
+        for (const auto horizonScale : settings.horizonScales) {
+          results.push_back(run(entry.first, problem, solverType, numThreads, horizonScale, settings, getNumAllocations));
+          const auto& result = results.back();
+          std::cerr << "[SolverBenchmark] " << result.problem << " " << result.solver << " threads: " << result.numThreads
+                    << " horizon: " << result.timeHorizon << " median [ms]: " << result.medianSolveTimeInMilliseconds
+                    << (result.error.empty() ? "" : " error: " + result.error) << "\n";
+        }
+      }
+    }
+  }
+
+  if (outputFile.empty()) {
+    writeJson(std::cout, results);
+  } else {
+    std::ofstream stream(outputFile);
+    if (!stream) {
+      std::cerr << "[SolverBenchmark] Could not open " << outputFile << "\n";
+      return EXIT_FAILURE;
+    }
+    writeJson(stream, results);
+  }
+  return EXIT_SUCCESS;
+}
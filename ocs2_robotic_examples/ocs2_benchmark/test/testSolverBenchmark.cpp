@@ -0,0 +1,76 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <algorithm>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "ocs2_benchmark/ProblemCatalog.h"
+#include "ocs2_benchmark/SolverBenchmark.h"
+
+using namespace ocs2;
+using namespace ocs2::solver_benchmark;
+
+/** A short run of every solver on the double integrator, with the problem shared by all the configurations. */
+TEST(testSolverBenchmark, doubleIntegratorSmokeTest) {
+  const auto catalog = getProblemCatalog();
+  const auto entry = std::find_if(catalog.begin(), catalog.end(), [](const auto& e) { return e.first == "double_integrator"; });
+  ASSERT_NE(entry, catalog.end());
+  const auto problem = entry->second();
+
+  Settings settings;
+  settings.numMpcRuns = 3;
+  settings.numWarmupRuns = 1;
+
+  size_t numFakeAllocations = 0;
+  const auto getNumAllocations = [&]() { return numFakeAllocations++; };
+
+  std::vector<Result> results;
+  for (const auto solverType : allSolverTypes()) {
+    for (size_t i = 0; i < 2; i++) {
+      results.push_back(run(entry->first, problem, solverType, 1, 1.0, settings, getNumAllocations));
+      const auto& result = results.back();
+      EXPECT_TRUE(result.error.empty()) << result.solver << ": " << result.error;
+      EXPECT_EQ(result.numRuns, settings.numMpcRuns) << result.solver;
+      EXPECT_GT(result.meanIterations, 0.0) << result.solver;
+      EXPECT_DOUBLE_EQ(result.meanAllocations, 1.0) << result.solver;
+      EXPECT_LE(result.medianSolveTimeInMilliseconds, result.maxSolveTimeInMilliseconds) << result.solver;
+    }
+    // the configurations of a shared problem start from the same references
+    const auto& first = results[results.size() - 2];
+    const auto& second = results.back();
+    EXPECT_DOUBLE_EQ(first.meanIterations, second.meanIterations) << first.solver;
+  }
+
+  std::stringstream stream;
+  writeJson(stream, results);
+  EXPECT_NE(stream.str().find("\"problem\": \"double_integrator\", \"solver\": \"SQP\""), std::string::npos);
+  EXPECT_EQ(stream.str().find("\"error\""), std::string::npos);
+}
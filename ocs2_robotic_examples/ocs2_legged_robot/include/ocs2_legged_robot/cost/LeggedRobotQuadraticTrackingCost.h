@@ -57,7 +57,7 @@ class LeggedRobotStateInputQuadraticCost final : public QuadraticStateInputCost
   std::pair<vector_t, vector_t> getStateInputDeviation(scalar_t time, const vector_t& state, const vector_t& input,
                                                        const TargetTrajectories& targetTrajectories) const override {
     const auto contactFlags = referenceManagerPtr_->getContactFlags(time);
-    const vector_t xNominal = targetTrajectories.getDesiredState(time);
+    const vector_t xNominal = targetTrajectories.getDesiredState(time, targetCursor_);
     const vector_t uNominal = weightCompensatingInput(info_, contactFlags);
     return {state - xNominal, input - uNominal};
   }
@@ -82,7 +82,7 @@ class LeggedRobotStateQuadraticCost final : public QuadraticStateCost {
 
   vector_t getStateDeviation(scalar_t time, const vector_t& state, const TargetTrajectories& targetTrajectories) const override {
     const auto contactFlags = referenceManagerPtr_->getContactFlags(time);
-    const vector_t xNominal = targetTrajectories.getDesiredState(time);
+    const vector_t xNominal = targetTrajectories.getDesiredState(time, targetCursor_);
     return state - xNominal;
   }
 
@@ -0,0 +1,90 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+ * Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+ * Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+#include <string>
+
+#include <boost/property_tree/info_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <gtest/gtest.h>
+
+#include <ocs2_core/misc/LoadData.h>
+#include <ocs2_core/penalties/MultidimensionalPenalty.h>
+#include <ocs2_core/penalties/Penalties.h>
+
+#include "ocs2_legged_robot/package_path.h"
+
+using namespace ocs2;
+using namespace legged_robot;
+
+/**
+ * Checks that the batched evaluation of the friction cone relaxed barrier matches the per-constraint evaluation, for the four
+ * friction cones of the legged robot and for a node with many soft constraints (e.g. stacked friction cones or self-collision pairs).
+ */
+TEST(LeggedRobot, SoftConstraintPenaltyBatchEvaluation) {
+  constexpr scalar_t t = 0.0;
+
+  const std::string taskFile = legged_robot::getPath() + "/config/mpc/task.info";
+  boost::property_tree::ptree pt;
+  boost::property_tree::read_info(taskFile, pt);
+  RelaxedBarrierPenalty::Config config;
+  loadData::loadPtreeValue(pt, config.mu, "frictionConeSoftConstraint.mu", false);
+  loadData::loadPtreeValue(pt, config.delta, "frictionConeSoftConstraint.delta", false);
+
+  for (const size_t numConstraints : {4, 64, 256}) {
+    // values on both sides of delta
+    VectorFunctionLinearApproximation h(numConstraints, 24, 24);
+    h.f = vector_t::Random(numConstraints) + vector_t::Constant(numConstraints, 0.5);
+    h.dfdx.setRandom();
+    h.dfdu.setRandom();
+
+    // one penalty per constraint: one virtual call per element
+    std::vector<std::unique_ptr<PenaltyBase>> penaltyPtrArray;
+    for (size_t i = 0; i < numConstraints; i++) {
+      penaltyPtrArray.emplace_back(new RelaxedBarrierPenalty(config));
+    }
+    const MultidimensionalPenalty elementwisePenalty(std::move(penaltyPtrArray));
+
+    // the same penalty on all constraints: one virtual call per vector
+    const MultidimensionalPenalty batchPenalty(std::unique_ptr<PenaltyBase>(new RelaxedBarrierPenalty(config)));
+
+    const scalar_t elementwiseValue = elementwisePenalty.getValue(t, h.f);
+    const scalar_t batchValue = batchPenalty.getValue(t, h.f);
+    const auto elementwiseApprox = elementwisePenalty.getQuadraticApproximation(t, h);
+    const auto batchApprox = batchPenalty.getQuadraticApproximation(t, h);
+
+    EXPECT_NEAR(batchValue, elementwiseValue, 1e-9 * std::abs(elementwiseValue)) << "constraints: " << numConstraints;
+    EXPECT_NEAR(batchApprox.f, elementwiseApprox.f, 1e-9 * std::abs(elementwiseApprox.f)) << "constraints: " << numConstraints;
+    EXPECT_TRUE(batchApprox.dfdx.isApprox(elementwiseApprox.dfdx)) << "constraints: " << numConstraints;
+    EXPECT_TRUE(batchApprox.dfdu.isApprox(elementwiseApprox.dfdu)) << "constraints: " << numConstraints;
+    EXPECT_TRUE(batchApprox.dfdxx.isApprox(elementwiseApprox.dfdxx)) << "constraints: " << numConstraints;
+    EXPECT_TRUE(batchApprox.dfdux.isApprox(elementwiseApprox.dfdux)) << "constraints: " << numConstraints;
+    EXPECT_TRUE(batchApprox.dfduu.isApprox(elementwiseApprox.dfduu)) << "constraints: " << numConstraints;
+  }
+}
@@ -46,7 +46,7 @@ class QuadraticInputCost final : public QuadraticStateInputCost {
 
   std::pair<vector_t, vector_t> getStateInputDeviation(scalar_t time, const vector_t& state, const vector_t& input,
                                                        const TargetTrajectories& targetTrajectories) const override {
-    const vector_t inputDeviation = input - targetTrajectories.getDesiredInput(time);
+    const vector_t inputDeviation = input - targetTrajectories.getDesiredInput(time, targetCursor_);
     return {vector_t::Zero(stateDim_), inputDeviation};
   }
 
@@ -21,7 +21,7 @@ std::unique_ptr<switched_model_loopshaping::QuadrupedLoopshapingInterface> getAn
     const std::string& urdf, switched_model::QuadrupedInterface::Settings settings, const FrameDeclaration& frameDeclaration,
     std::shared_ptr<ocs2::LoopshapingDefinition> loopshapingDefinition) {
   auto quadrupedInterface = getAnymalInterface(urdf, std::move(settings), frameDeclaration);
-  loopshapingDefinition->costMatrix() = quadrupedInterface->nominalCostApproximation().dfduu;
+  loopshapingDefinition->setCostMatrix(quadrupedInterface->nominalCostApproximation().dfduu);
   loopshapingDefinition->print();
 
   return std::unique_ptr<switched_model_loopshaping::QuadrupedLoopshapingInterface>(
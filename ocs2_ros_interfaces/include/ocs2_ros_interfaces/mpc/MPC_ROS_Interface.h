@@ -45,12 +45,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_msgs/mode_schedule.h>
 #include <ocs2_msgs/mpc_flattened_controller.h>
 #include <ocs2_msgs/mpc_observation.h>
+#include <ocs2_msgs/mpc_policy_binary.h>
 #include <ocs2_msgs/mpc_target_trajectories.h>
 #include <ocs2_msgs/reset.h>
 
 #include <ocs2_core/control/FeedforwardController.h>
 #include <ocs2_core/control/LinearController.h>
 #include <ocs2_core/misc/Benchmark.h>
+#include <ocs2_mpc/BinaryPolicy.h>
 #include <ocs2_mpc/CommandData.h>
 #include <ocs2_mpc/MPC_BASE.h>
 #include <ocs2_mpc/SystemObservation.h>
@@ -102,6 +104,26 @@ class MPC_ROS_Interface {
    */
   void launchNodes(ros::NodeHandle& nodeHandle);
 
+  /**
+   * Publishes the policy in the compact binary format of ocs2_mpc/BinaryPolicy.h on the topic "topicPrefix_mpc_policy_binary"
+   * instead of the mpc_flattened_controller message on "topicPrefix_mpc_policy". The MRT should call
+   * MRT_ROS_Interface::enableBinaryPolicy() accordingly. This method should be called before launchNodes().
+   *
+   * @param [in] settings: The encoding settings, e.g., float16 feedback gains.
+   */
+  void enableBinaryPolicy(binary_policy::Settings settings = binary_policy::Settings());
+
+  /**
+   * Publishes the policy as incremental updates (see binary_policy::DeltaEncoder) on the topic "topicPrefix_mpc_policy_binary". Only
+   * the nodes which changed beyond the tolerances are sent, with a full policy from time to time. The MRT should call
+   * MRT_ROS_Interface::enableBinaryPolicy() accordingly. This method should be called before launchNodes().
+   *
+   * @param [in] settings: The encoding settings of the transmitted nodes.
+   * @param [in] deltaSettings: The settings of the incremental updates.
+   */
+  void enableIncrementalPolicy(binary_policy::Settings settings = binary_policy::Settings(),
+                               binary_policy::DeltaSettings deltaSettings = binary_policy::DeltaSettings());
+
  protected:
   /**
    * Callback to reset MPC.
@@ -122,6 +144,11 @@ class MPC_ROS_Interface {
   static ocs2_msgs::mpc_flattened_controller createMpcPolicyMsg(const PrimalSolution& primalSolution, const CommandData& commandData,
                                                                 const PerformanceIndex& performanceIndices);
 
+  /**
+   * Publishes the policy either as a mpc_flattened_controller or a mpc_policy_binary message.
+   */
+  void publishPolicy(const PrimalSolution& primalSolution, const CommandData& commandData, const PerformanceIndex& performanceIndices);
+
   /**
    * Handles ROS publishing thread.
    */
@@ -158,6 +185,11 @@ class MPC_ROS_Interface {
   ::ros::Publisher mpcPolicyPublisher_;
   ::ros::ServiceServer mpcResetServiceServer_;
 
+  // Binary policy format, nullptr for the mpc_flattened_controller message
+  std::unique_ptr<binary_policy::Settings> binaryPolicySettingsPtr_;
+  std::unique_ptr<binary_policy::DeltaEncoder> policyDeltaEncoderPtr_;  // nullptr for sending full policies
+  ocs2_msgs::mpc_policy_binary mpcPolicyBinaryMsg_;
+
   std::unique_ptr<CommandData> bufferCommandPtr_;
   std::unique_ptr<CommandData> publisherCommandPtr_;
   std::unique_ptr<PrimalSolution> bufferPrimalSolutionPtr_;
@@ -43,6 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 // MPC messages
 #include <ocs2_msgs/mpc_flattened_controller.h>
+#include <ocs2_msgs/mpc_policy_binary.h>
 #include <ocs2_msgs/reset.h>
 
 #include <ocs2_mpc/MRT_BASE.h>
@@ -96,6 +97,12 @@ class MRT_ROS_Interface : public MRT_BASE {
    */
   void launchNodes(::ros::NodeHandle& nodeHandle);
 
+  /**
+   * Subscribes to the binary policy published by MPC_ROS_Interface::enableBinaryPolicy() or MPC_ROS_Interface::enableIncrementalPolicy()
+   * on "topicPrefix_mpc_policy_binary" instead of the mpc_flattened_controller message. This method should be called before launchNodes().
+   */
+  void enableBinaryPolicy() { useBinaryPolicy_ = true; }
+
   void setCurrentObservation(const SystemObservation& currentObservation) override;
 
  private:
@@ -107,6 +114,14 @@ class MRT_ROS_Interface : public MRT_BASE {
    */
   void mpcPolicyCallback(const ocs2_msgs::mpc_flattened_controller::ConstPtr& msg);
 
+  /**
+   * Callback method to receive the MPC policy in the binary format. The policy is decoded directly from the message buffer. The
+   * incremental updates are merged into the previously received policy.
+   *
+   * @param [in] msg: A constant pointer to the message
+   */
+  void mpcPolicyBinaryCallback(const ocs2_msgs::mpc_policy_binary::ConstPtr& msg);
+
   /**
    * Helper function to read a MPC policy message.
    *
@@ -137,6 +152,7 @@ class MRT_ROS_Interface : public MRT_BASE {
 
   ::ros::CallbackQueue mrtCallbackQueue_;
   ::ros::TransportHints mrtTransportHints_;
+  bool useBinaryPolicy_ = false;
 
   // Multi-threading for publishers
   bool terminateThread_;
@@ -66,6 +66,9 @@ void MPC_ROS_Interface::resetMpcNode(TargetTrajectories&& initTargetTrajectories
   mpc_.reset();
   mpc_.getSolverPtr()->getReferenceManager().setTargetTrajectories(std::move(initTargetTrajectories));
   mpcTimer_.reset();
+  if (policyDeltaEncoderPtr_ != nullptr) {
+    policyDeltaEncoderPtr_->requestKeyFrame();
+  }
   resetRequestedEver_ = true;
   terminateThread_ = false;
   readyToPublish_ = false;
@@ -177,6 +180,38 @@ ocs2_msgs::mpc_flattened_controller MPC_ROS_Interface::createMpcPolicyMsg(const
   return mpcPolicyMsg;
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MPC_ROS_Interface::enableBinaryPolicy(binary_policy::Settings settings) {
+  binaryPolicySettingsPtr_.reset(new binary_policy::Settings(settings));
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MPC_ROS_Interface::enableIncrementalPolicy(binary_policy::Settings settings, binary_policy::DeltaSettings deltaSettings) {
+  binaryPolicySettingsPtr_.reset(new binary_policy::Settings(settings));
+  policyDeltaEncoderPtr_.reset(new binary_policy::DeltaEncoder(settings, deltaSettings));
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MPC_ROS_Interface::publishPolicy(const PrimalSolution& primalSolution, const CommandData& commandData,
+                                      const PerformanceIndex& performanceIndices) {
+  if (policyDeltaEncoderPtr_ != nullptr) {
+    policyDeltaEncoderPtr_->encode(commandData, primalSolution, performanceIndices, mpcPolicyBinaryMsg_.data);
+    mpcPolicyPublisher_.publish(mpcPolicyBinaryMsg_);
+  } else if (binaryPolicySettingsPtr_ != nullptr) {
+    // the message is kept as a member to reuse the memory of its buffer
+    binary_policy::encode(commandData, primalSolution, performanceIndices, *binaryPolicySettingsPtr_, mpcPolicyBinaryMsg_.data);
+    mpcPolicyPublisher_.publish(mpcPolicyBinaryMsg_);
+  } else {
+    mpcPolicyPublisher_.publish(createMpcPolicyMsg(primalSolution, commandData, performanceIndices));
+  }
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -197,11 +232,8 @@ void MPC_ROS_Interface::publisherWorker() {
       publisherPerformanceIndicesPtr_.swap(bufferPerformanceIndicesPtr_);
     }
 
-    ocs2_msgs::mpc_flattened_controller mpcPolicyMsg =
-        createMpcPolicyMsg(*publisherPrimalSolutionPtr_, *publisherCommandPtr_, *publisherPerformanceIndicesPtr_);
-
     // publish the message
-    mpcPolicyPublisher_.publish(mpcPolicyMsg);
+    publishPolicy(*publisherPrimalSolutionPtr_, *publisherCommandPtr_, *publisherPerformanceIndicesPtr_);
 
     readyToPublish_ = false;
     lk.unlock();
@@ -283,9 +315,7 @@ void MPC_ROS_Interface::mpcObservationCallback(const ocs2_msgs::mpc_observation:
   msgReady_.notify_one();
 
 #else
-  ocs2_msgs::mpc_flattened_controller mpcPolicyMsg =
-      createMpcPolicyMsg(*bufferPrimalSolutionPtr_, *bufferCommandPtr_, *bufferPerformanceIndicesPtr_);
-  mpcPolicyPublisher_.publish(mpcPolicyMsg);
+  publishPolicy(*bufferPrimalSolutionPtr_, *bufferCommandPtr_, *bufferPerformanceIndicesPtr_);
 #endif
 }
 
@@ -335,7 +365,11 @@ void MPC_ROS_Interface::launchNodes(ros::NodeHandle& nodeHandle) {
                                                    ::ros::TransportHints().tcpNoDelay());
 
   // MPC publisher
-  mpcPolicyPublisher_ = nodeHandle.advertise<ocs2_msgs::mpc_flattened_controller>(topicPrefix_ + "_mpc_policy", 1, true);
+  if (binaryPolicySettingsPtr_ != nullptr) {
+    mpcPolicyPublisher_ = nodeHandle.advertise<ocs2_msgs::mpc_policy_binary>(topicPrefix_ + "_mpc_policy_binary", 1, true);
+  } else {
+    mpcPolicyPublisher_ = nodeHandle.advertise<ocs2_msgs::mpc_flattened_controller>(topicPrefix_ + "_mpc_policy", 1, true);
+  }
 
   // MPC reset service server
   mpcResetServiceServer_ = nodeHandle.advertiseService(topicPrefix_ + "_mpc_reset", &MPC_ROS_Interface::resetMpcCallback, this);
@@ -31,6 +31,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ocs2_core/control/FeedforwardController.h>
 #include <ocs2_core/control/LinearController.h>
+#include <ocs2_mpc/BinaryPolicy.h>
 
 namespace ocs2 {
 
@@ -198,6 +199,25 @@ void MRT_ROS_Interface::mpcPolicyCallback(const ocs2_msgs::mpc_flattened_control
   this->moveToBuffer(std::move(commandPtr), std::move(primalSolutionPtr), std::move(performanceIndicesPtr));
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MRT_ROS_Interface::mpcPolicyBinaryCallback(const ocs2_msgs::mpc_policy_binary::ConstPtr& msg) {
+  if (binary_policy::isDelta(msg->data.data(), msg->data.size())) {
+    if (!this->moveDeltaToBuffer(msg->data.data(), msg->data.size())) {
+      ROS_WARN_STREAM_THROTTLE(1.0, "[MRT_ROS_Interface] Waiting for a full policy to apply the incremental updates.");
+    }
+    return;
+  }
+
+  auto commandPtr = std::make_unique<CommandData>();
+  auto primalSolutionPtr = std::make_unique<PrimalSolution>();
+  auto performanceIndicesPtr = std::make_unique<PerformanceIndex>();
+  binary_policy::decode(msg->data, *commandPtr, *primalSolutionPtr, *performanceIndicesPtr);
+
+  this->moveToBuffer(std::move(commandPtr), std::move(primalSolutionPtr), std::move(performanceIndicesPtr));
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -253,13 +273,24 @@ void MRT_ROS_Interface::launchNodes(ros::NodeHandle& nodeHandle) {
   mpcObservationPublisher_ = nodeHandle.advertise<ocs2_msgs::mpc_observation>(topicPrefix_ + "_mpc_observation", 1);
 
   // policy subscriber
-  auto ops = ros::SubscribeOptions::create<ocs2_msgs::mpc_flattened_controller>(
-      topicPrefix_ + "_mpc_policy",                                                       // topic name
-      1,                                                                                  // queue length
-      boost::bind(&MRT_ROS_Interface::mpcPolicyCallback, this, boost::placeholders::_1),  // callback
-      ros::VoidConstPtr(),                                                                // tracked object
-      &mrtCallbackQueue_                                                                  // pointer to callback queue object
-  );
+  ros::SubscribeOptions ops;
+  if (useBinaryPolicy_) {
+    ops = ros::SubscribeOptions::create<ocs2_msgs::mpc_policy_binary>(
+        topicPrefix_ + "_mpc_policy_binary",                                                      // topic name
+        1,                                                                                        // queue length
+        boost::bind(&MRT_ROS_Interface::mpcPolicyBinaryCallback, this, boost::placeholders::_1),  // callback
+        ros::VoidConstPtr(),                                                                      // tracked object
+        &mrtCallbackQueue_                                                                        // pointer to callback queue object
+    );
+  } else {
+    ops = ros::SubscribeOptions::create<ocs2_msgs::mpc_flattened_controller>(
+        topicPrefix_ + "_mpc_policy",                                                       // topic name
+        1,                                                                                  // queue length
+        boost::bind(&MRT_ROS_Interface::mpcPolicyCallback, this, boost::placeholders::_1),  // callback
+        ros::VoidConstPtr(),                                                                // tracked object
+        &mrtCallbackQueue_                                                                  // pointer to callback queue object
+    );
+  }
   ops.transport_hints = mrtTransportHints_;
   mpcPolicySubscriber_ = nodeHandle.subscribe(ops);
 
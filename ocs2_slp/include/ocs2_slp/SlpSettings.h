@@ -31,6 +31,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ocs2_core/Types.h>
 #include <ocs2_core/integration/SensitivityIntegrator.h>
+#include <ocs2_oc/qp_backend/AdmmSettings.h>
 
 #include "ocs2_slp/pipg/PipgSettings.h"
 
@@ -44,6 +45,14 @@ struct Settings {
   scalar_t deltaTol = 1e-6;     // Termination condition : RMS update of x(t) and u(t) are both below this value
   scalar_t costTol = 1e-4;      // Termination condition : (cost{i+1} - (cost{i}) < costTol AND constraints{i+1} < g_min
 
+  // Pre-conditioning warm start: start from the scaling factors of the previous QP and only run correction sweeps
+  bool warmStartScaling = false;
+  size_t minScalingCorrection = 0;      // Minimum number of correction sweeps. At most scalingIteration sweeps are done.
+  scalar_t scalingCorrectionTol = 0.1;  // Stop the sweeps once the factors of the next sweep are within this distance of one
+
+  // Warm start: beyond the end of the previous solution, continue its final policy through the dynamics instead of using the Initializer
+  bool warmStartPolicyContinuation = false;
+
   // Linesearch - step size rules
   scalar_t alpha_decay = 0.5;  // multiply the step size by this factor every time a linesearch step is rejected.
   scalar_t alpha_min = 1e-4;   // terminate linesearch if the attempted step size is below this threshold
@@ -76,6 +85,10 @@ struct Settings {
 
   // LP subproblem solver settings
   pipg::Settings pipgSettings = pipg::Settings();
+
+  // Solve the LP subproblem with the ADMM backend instead of PIPG
+  bool useAdmmQpSolver = false;
+  admm::Settings admmSettings = admm::Settings();
 };
 
 /**
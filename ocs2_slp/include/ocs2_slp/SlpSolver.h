@@ -38,6 +38,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_oc/oc_data/TimeDiscretization.h>
 #include <ocs2_oc/oc_problem/OptimalControlProblem.h>
 #include <ocs2_oc/oc_solver/SolverBase.h>
+#include <ocs2_oc/qp_backend/OcpQpBackend.h>
 #include <ocs2_oc/search_strategy/FilterLinesearch.h>
 
 #include "ocs2_slp/SlpSettings.h"
@@ -118,7 +119,8 @@ class SlpSolver : public SolverBase {
   /** Get profiling information as a string */
   std::string getBenchmarkingInformation() const;
 
-  std::string getBenchmarkingInformationPIPG() const;
+  /** Get profiling information of the QP solver (PIPG or the configured QP backend) as a string */
+  std::string getBenchmarkingInformationQpSolver() const;
 
   /** Creates QP around t, x(t), u(t). Returns performance metrics at the current {t, x(t), u(t)} */
   PerformanceIndex setupQuadraticSubproblem(const std::vector<AnnotatedTime>& time, const vector_t& initState, const vector_array_t& x,
@@ -157,10 +159,15 @@ class SlpSolver : public SolverBase {
 
   // Solver interface
   PipgSolver pipgSolver_;
+  std::unique_ptr<OcpQpBackend> qpBackendPtr_;  // Used instead of PIPG if set
 
   // Threading
   ThreadPool threadPool_;
 
+  // Snapshots of the references, kept alive for the whole run
+  std::shared_ptr<const ModeSchedule> modeScheduleSnapshot_;
+  std::shared_ptr<const TargetTrajectories> targetTrajectoriesSnapshot_;
+
   // Solution
   PrimalSolution primalSolution_;
 
@@ -175,6 +182,10 @@ class SlpSolver : public SolverBase {
   // Lagrange multipliers
   std::vector<multiple_shooting::ProjectionMultiplierCoefficients> projectionMultiplierCoefficients_;
 
+  // Pre-conditioning factors of the last QP, used to warm start the next one
+  vector_array_t scalingD_, scalingE_;
+  scalar_t scalingC_ = 1.0;
+
   // Iteration performance log
   std::vector<PerformanceIndex> performanceIndeces_;
 
@@ -195,6 +206,9 @@ class SlpSolver : public SolverBase {
   benchmark::RepeatedTimer sigmaEstimation_;
   benchmark::RepeatedTimer preConditioning_;
   benchmark::RepeatedTimer pipgSolverTimer_;
+  size_t totalNumScalingSweeps_{0};
+  size_t totalNumPipgIterations_{0};
+  size_t totalNumQpMaxIterations_{0};
 };
 
 }  // namespace ocs2
@@ -0,0 +1,121 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+
+#include <ocs2_core/Types.h>
+
+#include "ocs2_slp/pipg/PipgBounds.h"
+#include "ocs2_slp/pipg/PipgSettings.h"
+
+namespace ocs2 {
+namespace pipg {
+
+/**
+ * Adaptive restart of the PIPG step size schedule on the strong convexity estimate mu.
+ *
+ * The schedule starts from an optimistic mu, which grows the dual step size much faster than the lower bound of the cost hessian
+ * would. If mu is overestimated, the primal step size decays too fast and the iterations stall. This is detected on the primal step
+ * normalized by its step size, i.e. the gradient mapping. If it does not shrink by a given factor within a window of iterations, mu is
+ * halved and the schedule restarts from the current iterate. The lower bound is never undercut. A converged iterate found with a larger
+ * mu only restarts the schedule with the lower bound, so the returned solution always satisfies the termination criteria of plain PIPG.
+ *
+ * If the restart is disabled in the settings, the bounds are the given ones and no restart is triggered.
+ */
+class AdaptiveRestart {
+ public:
+  AdaptiveRestart(const Settings& settings, const PipgBounds& pipgBounds)
+      : window_(settings.restartWindow), decayFactor_(settings.restartDecayFactor), muLowerBound_(pipgBounds.mu), bounds_(pipgBounds) {
+    if (settings.useAdaptiveRestart) {
+      bounds_.mu = std::max(settings.initialMuRatio * pipgBounds.lambda, pipgBounds.mu);
+    }
+  }
+
+  /** The bounds which define the step sizes of the current schedule. */
+  const PipgBounds& bounds() const { return bounds_; }
+
+  /** The index of an iteration within the current step size schedule. */
+  size_t stepSizeIndex(size_t iteration) const { return iteration - lastRestartIteration_; }
+
+  size_t getNumRestarts() const { return numRestarts_; }
+
+  /**
+   * Checks the restart condition at a termination check.
+   *
+   * @param [in] restartIteration : The iteration from which the schedule restarts, i.e. stepSizeIndex(restartIteration) = 0.
+   * @param [in] primalStepSquaredNorm : The squared norm of the latest primal step.
+   * @param [in] primalStepSize : The primal step size of the latest primal step.
+   * @param [in] isConverged : Whether the termination criteria are met.
+   * @return True if the schedule is restarted. In that case the iterations have to continue.
+   */
+  bool update(size_t restartIteration, scalar_t primalStepSquaredNorm, scalar_t primalStepSize, bool isConverged) {
+    if (bounds_.mu <= muLowerBound_) {
+      return false;
+    }
+
+    bool isStalled = false;
+    if (restartIteration - windowStartIteration_ >= window_) {
+      const scalar_t residual = primalStepSquaredNorm / (primalStepSize * primalStepSize);
+      isStalled = residual > decayFactor_ * windowStartResidual_;
+      windowStartIteration_ = restartIteration;
+      windowStartResidual_ = residual;
+    }
+
+    if (isConverged) {
+      bounds_.mu = muLowerBound_;
+    } else if (isStalled) {
+      bounds_.mu = std::max(0.5 * bounds_.mu, muLowerBound_);
+    } else {
+      return false;
+    }
+
+    lastRestartIteration_ = restartIteration;
+    windowStartIteration_ = restartIteration;
+    windowStartResidual_ = std::numeric_limits<scalar_t>::max();
+    ++numRestarts_;
+    return true;
+  }
+
+ private:
+  const size_t window_;
+  const scalar_t decayFactor_;
+  const scalar_t muLowerBound_;
+  PipgBounds bounds_;
+
+  size_t lastRestartIteration_ = 0;
+  size_t numRestarts_ = 0;
+  size_t windowStartIteration_ = 0;
+  scalar_t windowStartResidual_ = std::numeric_limits<scalar_t>::max();
+};
+
+}  // namespace pipg
+}  // namespace ocs2
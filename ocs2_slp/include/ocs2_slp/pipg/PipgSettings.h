@@ -44,6 +44,19 @@ struct Settings {
   size_t checkTerminationInterval = 1;
   /** The static lower bound of the cost hessian H. **/
   scalar_t lowerBoundH = 5e-6;
+  /**
+   * Use the restarted variant of PIPG. It starts from the optimistic strong convexity estimate mu = initialMuRatio * lambda. If the
+   * primal step, normalized by the primal step size, does not shrink by restartDecayFactor within restartWindow iterations, mu is
+   * halved and the step size schedule restarts from the current iterate. Convergence is only accepted with mu at the lower bound in
+   * PipgBounds, i.e. as plain PIPG.
+   */
+  bool useAdaptiveRestart = false;
+  /** Ratio of the initial strong convexity estimate to the upper bound of the cost hessian. **/
+  scalar_t initialMuRatio = 0.1;
+  /** Number of iterations in which the normalized primal step has to shrink by restartDecayFactor. **/
+  size_t restartWindow = 30;
+  /** Factor by which the normalized primal step has to shrink within restartWindow iterations to avoid a restart. **/
+  scalar_t restartDecayFactor = 0.25;
   /** This value determines to display the a summary log. */
   bool displayShortSummary = false;
 };
@@ -58,7 +58,8 @@ class PipgSolver {
   explicit PipgSolver(pipg::Settings settings);
 
   /**
-   * Solve the optimal control in parallel.
+   * Solve the optimal control in parallel. The stages are split into contiguous ranges, one per worker, and the workers synchronize
+   * once per iteration. At most one worker per hardware thread is used.
    *
    * @param [in] threadPool : The external thread pool.
    * @param [in] x0 : Initial state
@@ -83,6 +84,8 @@ class PipgSolver {
 
   int getNumDecisionVariables() const { return numDecisionVariables_; }
   int getNumDynamicsConstraints() const { return numDynamicsConstraints_; }
+  /** Number of iterations of the last solve call. */
+  size_t getNumIterations() const { return numIterations_; }
 
   const OcpSize& size() const { return ocpSize_; }
   const pipg::Settings& settings() const { return settings_; }
@@ -101,6 +104,7 @@ class PipgSolver {
   OcpSize ocpSize_;
   int numDecisionVariables_;
   int numDynamicsConstraints_;
+  size_t numIterations_ = 0;
 
   // Data buffer for parallelized PIPG
   vector_array_t X_, W_, V_, U_;
@@ -52,6 +52,10 @@ Settings loadSettings(const std::string& filename, const std::string& fieldName,
 
   loadData::loadPtreeValue(pt, settings.slpIteration, fieldName + ".slpIteration", verbose);
   loadData::loadPtreeValue(pt, settings.scalingIteration, fieldName + ".scalingIteration", verbose);
+  loadData::loadPtreeValue(pt, settings.warmStartScaling, fieldName + ".warmStartScaling", verbose);
+  loadData::loadPtreeValue(pt, settings.warmStartPolicyContinuation, fieldName + ".warmStartPolicyContinuation", verbose);
+  loadData::loadPtreeValue(pt, settings.minScalingCorrection, fieldName + ".minScalingCorrection", verbose);
+  loadData::loadPtreeValue(pt, settings.scalingCorrectionTol, fieldName + ".scalingCorrectionTol", verbose);
   loadData::loadPtreeValue(pt, settings.deltaTol, fieldName + ".deltaTol", verbose);
   loadData::loadPtreeValue(pt, settings.alpha_decay, fieldName + ".alpha_decay", verbose);
   loadData::loadPtreeValue(pt, settings.alpha_min, fieldName + ".alpha_min", verbose);
@@ -73,6 +77,8 @@ Settings loadSettings(const std::string& filename, const std::string& fieldName,
   loadData::loadPtreeValue(pt, settings.nThreads, fieldName + ".nThreads", verbose);
   loadData::loadPtreeValue(pt, settings.threadPriority, fieldName + ".threadPriority", verbose);
   settings.pipgSettings = pipg::loadSettings(filename, fieldName + ".pipg", verbose);
+  loadData::loadPtreeValue(pt, settings.useAdmmQpSolver, fieldName + ".useAdmmQpSolver", verbose);
+  settings.admmSettings = admm::loadSettings(filename, fieldName + ".admm", verbose);
 
   if (verbose) {
     std::cerr << " #### =============================================================================" << std::endl;
@@ -38,7 +38,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_oc/multiple_shooting/MetricsComputation.h>
 #include <ocs2_oc/multiple_shooting/PerformanceIndexComputation.h>
 #include <ocs2_oc/multiple_shooting/Transcription.h>
+#include <ocs2_oc/oc_solver/ContinuationInitializer.h>
 #include <ocs2_oc/precondition/Ruzi.h>
+#include <ocs2_oc/qp_backend/AdmmQpBackend.h>
 #include <ocs2_oc/trajectory_adjustment/TrajectorySpreadingHelperFunctions.h>
 
 #include "ocs2_slp/Helpers.h"
@@ -62,7 +64,16 @@ SlpSolver::SlpSolver(slp::Settings settings, const OptimalControlProblem& optima
   }
 
   // Operating points
-  initializerPtr_.reset(initializer.clone());
+  if (settings_.warmStartPolicyContinuation) {
+    initializerPtr_.reset(new ContinuationInitializer(initializer, *optimalControlProblem.dynamicsPtr, settings_.integratorType));
+  } else {
+    initializerPtr_.reset(initializer.clone());
+  }
+
+  // QP backend
+  if (settings_.useAdmmQpSolver) {
+    qpBackendPtr_.reset(new AdmmQpBackend(settings_.admmSettings, threadPool_));
+  }
 
   // Linesearch
   filterLinesearch_.g_max = settings_.g_max;
@@ -73,7 +84,7 @@ SlpSolver::SlpSolver(slp::Settings settings, const OptimalControlProblem& optima
 
 SlpSolver::~SlpSolver() {
   if (settings_.printSolverStatistics) {
-    std::cerr << getBenchmarkingInformationPIPG() << "\n" << getBenchmarkingInformation() << std::endl;
+    std::cerr << getBenchmarkingInformationQpSolver() << "\n" << getBenchmarkingInformation() << std::endl;
   }
 }
 
@@ -94,9 +105,17 @@ void SlpSolver::reset() {
   sigmaEstimation_.reset();
   preConditioning_.reset();
   pipgSolverTimer_.reset();
+  totalNumScalingSweeps_ = 0;
+  totalNumPipgIterations_ = 0;
+  totalNumQpMaxIterations_ = 0;
+
+  // Clear the scaling warm start
+  scalingD_.clear();
+  scalingE_.clear();
+  scalingC_ = 1.0;
 }
 
-std::string SlpSolver::getBenchmarkingInformationPIPG() const {
+std::string SlpSolver::getBenchmarkingInformationQpSolver() const {
   const auto lambdaEstimation = lambdaEstimation_.getTotalInMilliseconds();
   const auto sigmaEstimation = sigmaEstimation_.getTotalInMilliseconds();
   const auto preConditioning = preConditioning_.getTotalInMilliseconds();
@@ -104,20 +123,26 @@ std::string SlpSolver::getBenchmarkingInformationPIPG() const {
 
   const auto benchmarkTotal = preConditioning + lambdaEstimation + sigmaEstimation + pipgRuntime;
 
+  const std::string qpSolverName = (qpBackendPtr_ != nullptr) ? qpBackendPtr_->name() : std::string("PIPG");
+
   std::stringstream infoStream;
   if (benchmarkTotal > 0.0) {
     const scalar_t inPercent = 100.0;
     infoStream << "\n########################################################################\n";
-    infoStream << "The benchmarking is computed over " << preConditioning_.getNumTimedIntervals() << " iterations. \n";
-    infoStream << "PIPG Benchmarking\t       :\tAverage time [ms]   (% of total runtime)\n";
+    infoStream << "The benchmarking is computed over " << pipgSolverTimer_.getNumTimedIntervals() << " iterations. \n";
+    infoStream << qpSolverName << " Benchmarking\t       :\tAverage time [ms]   (% of total runtime)\n";
     infoStream << "\tpreConditioning        :\t" << std::setw(10) << preConditioning_.getAverageInMilliseconds() << " [ms] \t("
                << preConditioning / benchmarkTotal * inPercent << "%)\n";
     infoStream << "\tlambdaEstimation       :\t" << std::setw(10) << lambdaEstimation_.getAverageInMilliseconds() << " [ms] \t("
                << lambdaEstimation / benchmarkTotal * inPercent << "%)\n";
     infoStream << "\tsigmaEstimation        :\t" << std::setw(10) << sigmaEstimation_.getAverageInMilliseconds() << " [ms] \t("
                << sigmaEstimation / benchmarkTotal * inPercent << "%)\n";
-    infoStream << "\tPIPG runTime           :\t" << std::setw(10) << pipgSolverTimer_.getAverageInMilliseconds() << " [ms] \t("
+    infoStream << "\tQP solver runTime      :\t" << std::setw(10) << pipgSolverTimer_.getAverageInMilliseconds() << " [ms] \t("
                << pipgRuntime / benchmarkTotal * inPercent << "%)\n";
+    const auto numQps = static_cast<scalar_t>(pipgSolverTimer_.getNumTimedIntervals());
+    infoStream << "Average number of pre-conditioning sweeps : " << static_cast<scalar_t>(totalNumScalingSweeps_) / numQps << "\n";
+    infoStream << "Average number of QP solver iterations    : " << static_cast<scalar_t>(totalNumPipgIterations_) / numQps << "\n";
+    infoStream << "Number of QPs stopped at max iterations   : " << totalNumQpMaxIterations_ << "\n";
   }
   return infoStream.str();
 }
@@ -163,23 +188,29 @@ void SlpSolver::runImpl(scalar_t initTime, const vector_t& initState, scalar_t f
     std::cerr << "\n++++++++++++++++++++++++++++++++++++++++++++++++++++++\n";
   }
 
+  // Take the snapshots of the references for this run
+  modeScheduleSnapshot_ = this->getReferenceManager().getModeScheduleSnapshot();
+  targetTrajectoriesSnapshot_ = this->getReferenceManager().getTargetTrajectoriesSnapshot();
+
   // Determine time discretization, taking into account event times.
-  const auto& eventTimes = this->getReferenceManager().getModeSchedule().eventTimes;
+  const auto& eventTimes = modeScheduleSnapshot_->eventTimes;
   const auto timeDiscretization = timeDiscretizationWithEvents(initTime, finalTime, settings_.dt, eventTimes);
 
   // Initialize references
   for (auto& ocpDefinition : ocpDefinitions_) {
-    const auto& targetTrajectories = this->getReferenceManager().getTargetTrajectories();
-    ocpDefinition.targetTrajectoriesPtr = &targetTrajectories;
+    ocpDefinition.targetTrajectoriesPtr = targetTrajectoriesSnapshot_.get();
   }
 
   // Trajectory spread of primalSolution_
   if (!primalSolution_.timeTrajectory_.empty()) {
-    std::ignore = trajectorySpread(primalSolution_.modeSchedule_, this->getReferenceManager().getModeSchedule(), primalSolution_);
+    std::ignore = trajectorySpread(primalSolution_.modeSchedule_, *modeScheduleSnapshot_, primalSolution_);
   }
 
   // Initialize the state and input
   vector_array_t x, u;
+  if (settings_.warmStartPolicyContinuation) {
+    static_cast<ContinuationInitializer&>(*initializerPtr_).setPolicy(primalSolution_);
+  }
   multiple_shooting::initializeStateInputTrajectories(initState, timeDiscretization, primalSolution_, *initializerPtr_, x, u);
 
   // Bookkeeping
@@ -243,15 +274,45 @@ SlpSolver::OcpSubproblemSolution SlpSolver::getOCPSolution(const vector_t& delta
   auto& deltaUSol = solution.deltaUSol;
 
   // without constraints, or when using projection, we have an unconstrained QP.
+  if (qpBackendPtr_ != nullptr) {
+    pipgSolverTimer_.startTimer();
+    qpBackendPtr_->resize(extractSizesFromProblem(dynamics_, cost_, nullptr));
+    const auto status = qpBackendPtr_->solve(delta_x0, dynamics_, cost_, nullptr, deltaXSol, deltaUSol);
+    pipgSolverTimer_.endTimer();
+    totalNumPipgIterations_ += qpBackendPtr_->getNumIterations();
+    if (status == OcpQpBackend::Status::NUMERICAL_ERROR) {
+      throw std::runtime_error("[SlpSolver] Failed to solve the QP subproblem with " + qpBackendPtr_->name() + ".");
+    } else if (status == OcpQpBackend::Status::MAX_ITER) {
+      // the inexact solution is still used as the search direction, the linesearch guards the step
+      ++totalNumQpMaxIterations_;
+      if (settings_.printSolverStatus) {
+        std::cerr << "[SlpSolver] " << qpBackendPtr_->name() << " stopped at " << toString(status) << " after "
+                  << qpBackendPtr_->getNumIterations() << " iterations.\n";
+      }
+    }
+
+    solution.armijoDescentMetric = armijoDescentMetric(cost_, deltaXSol, deltaUSol);
+    multiple_shooting::remapProjectedInput(constraintsProjection_, deltaXSol, deltaUSol);
+    return solution;
+  }
+
   pipgSolver_.resize(extractSizesFromProblem(dynamics_, cost_, nullptr));
 
   // pre-condition the OCP
   preConditioning_.startTimer();
-  scalar_t c;
-  vector_array_t D, E;
   vector_array_t scalingVectors;
-  precondition::ocpDataInPlaceInParallel(threadPool_, delta_x0, pipgSolver_.size(), settings_.scalingIteration, dynamics_, cost_, D, E,
-                                         scalingVectors, c);
+  if (settings_.warmStartScaling) {
+    totalNumScalingSweeps_ += precondition::ocpDataInPlaceInParallelWarmStart(
+        threadPool_, delta_x0, pipgSolver_.size(), settings_.minScalingCorrection, settings_.scalingIteration,
+        settings_.scalingCorrectionTol, dynamics_, cost_, scalingD_, scalingE_, scalingVectors, scalingC_);
+  } else {
+    precondition::ocpDataInPlaceInParallel(threadPool_, delta_x0, pipgSolver_.size(), settings_.scalingIteration, dynamics_, cost_,
+                                           scalingD_, scalingE_, scalingVectors, scalingC_);
+    totalNumScalingSweeps_ += settings_.scalingIteration;
+  }
+  const auto& D = scalingD_;
+  const auto& E = scalingE_;
+  const auto c = scalingC_;
   preConditioning_.endTimer();
 
   // estimate mu and lambda: mu I < H < lambda I
@@ -281,6 +342,7 @@ SlpSolver::OcpSubproblemSolution SlpSolver::getOCPSolution(const vector_t& delta
   const auto pipgStatus =
       pipgSolver_.solve(threadPool_, delta_x0, dynamics_, cost_, nullptr, scalingVectors, &EInv, pipgBounds, deltaXSol, deltaUSol);
   pipgSolverTimer_.endTimer();
+  totalNumPipgIterations_ += pipgSolver_.getNumIterations();
 
   // to determine if the solution is a descent direction for the cost: compute gradient(cost)' * [dx; du]
   solution.armijoDescentMetric = armijoDescentMetric(cost_, deltaXSol, deltaUSol);
@@ -294,7 +356,7 @@ SlpSolver::OcpSubproblemSolution SlpSolver::getOCPSolution(const vector_t& delta
 }
 
 PrimalSolution SlpSolver::toPrimalSolution(const std::vector<AnnotatedTime>& time, vector_array_t&& x, vector_array_t&& u) {
-  ModeSchedule modeSchedule = this->getReferenceManager().getModeSchedule();
+  ModeSchedule modeSchedule = *modeScheduleSnapshot_;
   return multiple_shooting::toPrimalSolution(time, std::move(modeSchedule), std::move(x), std::move(u));
 }
 
@@ -54,6 +54,10 @@ Settings loadSettings(const std::string& filename, const std::string& fieldName,
   loadData::loadPtreeValue(pt, settings.relativeTolerance, fieldName + ".relativeTolerance", verbose);
 
   loadData::loadPtreeValue(pt, settings.lowerBoundH, fieldName + ".lowerBoundH", verbose);
+  loadData::loadPtreeValue(pt, settings.useAdaptiveRestart, fieldName + ".useAdaptiveRestart", verbose);
+  loadData::loadPtreeValue(pt, settings.initialMuRatio, fieldName + ".initialMuRatio", verbose);
+  loadData::loadPtreeValue(pt, settings.restartWindow, fieldName + ".restartWindow", verbose);
+  loadData::loadPtreeValue(pt, settings.restartDecayFactor, fieldName + ".restartDecayFactor", verbose);
 
   loadData::loadPtreeValue(pt, settings.checkTerminationInterval, fieldName + ".checkTerminationInterval", verbose);
   loadData::loadPtreeValue(pt, settings.displayShortSummary, fieldName + ".displayShortSummary", verbose);
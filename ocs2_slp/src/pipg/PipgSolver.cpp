@@ -29,13 +29,48 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ocs2_slp/pipg/PipgSolver.h"
 
-#include <condition_variable>
+#include <algorithm>
 #include <iostream>
-#include <mutex>
 #include <numeric>
+#include <thread>
+
+#include <ocs2_core/thread_support/SpinBarrier.h>
+
+#include "ocs2_slp/pipg/PipgAdaptiveRestart.h"
 
 namespace ocs2 {
 
+namespace {
+/**
+ * Splits the stages 1, ..., N into numWorkers non-empty contiguous ranges of about equal work. The work of a stage is estimated from
+ * the sizes of its dynamics matrices. The range of worker i is [partition[i], partition[i + 1]).
+ */
+std::vector<int> computeStagePartition(const OcpSize& ocpSize, int numWorkers) {
+  const int N = ocpSize.numStages;
+  std::vector<scalar_t> cumulativeWork(N + 1, 0.0);
+  for (int t = 1; t <= N; t++) {
+    const int nx = ocpSize.numStates[t];
+    const int nu = ocpSize.numInputs[t - 1];
+    cumulativeWork[t] = cumulativeWork[t - 1] + static_cast<scalar_t>((nx + nu) * (ocpSize.numStates[t - 1] + nx + nu));
+  }
+
+  std::vector<int> partition(numWorkers + 1);
+  partition.front() = 1;
+  partition.back() = N + 1;
+  int s = 1;
+  for (int i = 1; i < numWorkers; i++) {
+    const scalar_t targetWork = cumulativeWork[N] * static_cast<scalar_t>(i) / static_cast<scalar_t>(numWorkers);
+    while (s <= N && cumulativeWork[s - 1] < targetWork) {
+      s++;
+    }
+    // leave at least one stage to each of the remaining workers
+    s = std::min(std::max(s, partition[i - 1] + 1), N + 1 - (numWorkers - i));
+    partition[i] = s;
+  }
+  return partition;
+}
+}  // unnamed namespace
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -83,61 +118,87 @@ pipg::SolverStatus PipgSolver::solve(ThreadPool& threadPool, const vector_t& x0,
     WNew_[t].setZero(dynamics[t].dfdx.rows());
   }
 
-  scalar_t alpha = pipgBounds.primalStepSize(0);
-  scalar_t beta = pipgBounds.primalStepSize(0);
+  pipg::AdaptiveRestart adaptiveRestart(settings(), pipgBounds);
+  scalar_t alpha = adaptiveRestart.bounds().primalStepSize(0);
+  scalar_t beta = adaptiveRestart.bounds().primalStepSize(0);
   scalar_t betaLast = 0;
+  scalar_t alphaLast = alpha;
 
   size_t k = 0;
-  std::atomic_int timeIndex{1}, finishedTaskCounter{0};
-  std::atomic_bool keepRunning{true}, shouldWait{true};
+  bool keepRunning = true;
   bool isConverged = false;
 
-  std::mutex mux;
-  std::condition_variable iterationFinished;
+  // Each worker owns a fixed contiguous range of stages. The workers only meet once per iteration at the barrier. Since every worker
+  // has to run in every iteration, there should not be more workers than cores.
+  const int numCores = std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+  const int numWorkers = std::min({static_cast<int>(threadPool.numThreads()) + 1, numCores, N});
+  const std::vector<int> partition = computeStagePartition(ocpSize_, numWorkers);
+  std::atomic_int partitionCounter{0};
+  SpinBarrier barrier(numWorkers);
   std::vector<int> threadsWorkloadCounter(threadPool.numThreads() + 1U, 0);
 
+  // Serial part of an iteration. It is run by the last worker arriving at the barrier while the others wait.
+  auto finishIteration = [&]() {
+    if (k != 0 && k % settings().checkTerminationInterval == 0) {
+      constraintsViolationInfNorm = *(std::max_element(constraintsViolationInfNormArray.begin(), constraintsViolationInfNormArray.end()));
+
+      solutionSSE = std::accumulate(solutionSEArray.begin(), solutionSEArray.end(), 0.0);
+      solutionSquaredNorm = std::accumulate(solutionSquaredNormArray.begin(), solutionSquaredNormArray.end(), 0.0);
+
+      isConverged = constraintsViolationInfNorm <= settings().absoluteTolerance &&
+                    (solutionSSE <= settings().relativeTolerance * settings().relativeTolerance * solutionSquaredNorm ||
+                     solutionSSE <= settings().absoluteTolerance);
+
+      if (adaptiveRestart.update(k, solutionSSE, alphaLast, isConverged)) {
+        isConverged = false;
+      }
+      keepRunning = k < settings().maxNumIterations && !isConverged;
+    }
+
+    betaLast = beta;
+    alphaLast = alpha;
+    // Adaptive step size
+    beta = adaptiveRestart.bounds().dualStepSize(adaptiveRestart.stepSizeIndex(k));
+    alpha = adaptiveRestart.bounds().primalStepSize(adaptiveRestart.stepSizeIndex(k));
+
+    XNew_.swap(X_);
+    UNew_.swap(U_);
+    WNew_.swap(W_);
+
+    ++k;
+  };
+
   auto updateVariablesTask = [&](int workerId) {
-    int t;
-    int workerOrder;
+    const int partitionIndex = partitionCounter++;
+    const int tBegin = partition[partitionIndex];
+    const int tEnd = partition[partitionIndex + 1];
+    vector_t VNext;
 
     while (keepRunning) {
-      // Reset workerOrder in case all tasks have been assigned and some workers cannot enter the following while loop, keeping the
-      // workerOrder from previous iterations.
-      workerOrder = 0;
-      while ((t = timeIndex++) <= N) {
-        if (t == N) {
-          std::lock_guard<std::mutex> lk(mux);
-          shouldWait = true;
-        }
-        // Multi-thread performance analysis
-        ++threadsWorkloadCounter[workerId];
+      const scalar_t betaSum = beta + betaLast;
 
-        // PIPG algorithm
+      // Primal residuals and dual variables of the owned stages. The residual is evaluated once and shared by the W and V updates.
+      for (int t = tBegin; t < tEnd; t++) {
         const auto& A = dynamics[t - 1].dfdx;
         const auto& B = dynamics[t - 1].dfdu;
         const auto& C = scalingVectors[t - 1];
         const auto& b = dynamics[t - 1].f;
 
-        const auto& R = cost[t - 1].dfduu;
-        const auto& Q = cost[t].dfdxx;
-        const auto& P = cost[t - 1].dfdux;
-        const auto& q = cost[t].dfdx;
-        const auto& r = cost[t - 1].dfdu;
+        // primalResidual = C * X_[t] - A * X_[t - 1] - B * U_[t - 1] - b;
+        auto& primalResidual = primalResidualArray[t - 1];
+        primalResidual = C.cwiseProduct(X_[t]) - b;
+        primalResidual.noalias() -= A * X_[t - 1];
+        primalResidual.noalias() -= B * U_[t - 1];
 
         if (k != 0) {
-          // Update W of the iteration k - 1. Move the update of W to the front of the calculation of V to prevent data race.
-          // vector_t primalResidual = C * X_[t] - A * X_[t - 1] - B * U_[t - 1] - b;
-          primalResidualArray[t - 1] = -b;
-          primalResidualArray[t - 1].array() += C.array() * X_[t].array();
-          primalResidualArray[t - 1].noalias() -= A * X_[t - 1];
-          primalResidualArray[t - 1].noalias() -= B * U_[t - 1];
+          // Update W of the iteration k - 1.
           if (EInv != nullptr) {
-            constraintsViolationInfNormArray[t - 1] = (*EInv)[t - 1].cwiseProduct(primalResidualArray[t - 1]).lpNorm<Eigen::Infinity>();
+            constraintsViolationInfNormArray[t - 1] = (*EInv)[t - 1].cwiseProduct(primalResidual).lpNorm<Eigen::Infinity>();
           } else {
-            constraintsViolationInfNormArray[t - 1] = primalResidualArray[t - 1].lpNorm<Eigen::Infinity>();
+            constraintsViolationInfNormArray[t - 1] = primalResidual.lpNorm<Eigen::Infinity>();
           }
 
-          WNew_[t - 1] = W_[t - 1] + betaLast * primalResidualArray[t - 1];
+          WNew_[t - 1] = W_[t - 1] + betaLast * primalResidual;
 
           // What stored in UNew and XNew is the solution of iteration k - 2 and what stored in U and X is the solution of iteration k
           // - 1. By convention, iteration starts from 0 and the solution of iteration -1 is the initial value. Reuse UNew and XNew
@@ -149,11 +210,19 @@ pipg::SolverStatus PipgSolver::solve(ThreadPool& threadPool, const vector_t& x0,
           solutionSquaredNormArray[t - 1] = U_[t - 1].squaredNorm() + X_[t].squaredNorm();
         }
 
-        // V_[t - 1] = W_[t - 1] + (beta + betaLast) * (C * X_[t] - A * X_[t - 1] - B * U_[t - 1] - b);
-        V_[t - 1] = W_[t - 1] - (beta + betaLast) * b;
-        V_[t - 1].array() += (beta + betaLast) * C.array() * X_[t].array();
-        V_[t - 1].noalias() -= (beta + betaLast) * (A * X_[t - 1]);
-        V_[t - 1].noalias() -= (beta + betaLast) * (B * U_[t - 1]);
+        V_[t - 1] = W_[t - 1] + betaSum * primalResidual;
+      }
+
+      // Primal update of the owned stages
+      for (int t = tBegin; t < tEnd; t++) {
+        const auto& B = dynamics[t - 1].dfdu;
+        const auto& C = scalingVectors[t - 1];
+
+        const auto& R = cost[t - 1].dfduu;
+        const auto& Q = cost[t].dfdxx;
+        const auto& P = cost[t - 1].dfdux;
+        const auto& q = cost[t].dfdx;
+        const auto& r = cost[t - 1].dfdu;
 
         // UNew_[t - 1] = U_[t - 1] - alpha * (R * U_[t - 1] + P * X_[t - 1] + r - B.transpose() * V_[t - 1]);
         UNew_[t - 1] = U_[t - 1] - alpha * r;
@@ -162,76 +231,41 @@ pipg::SolverStatus PipgSolver::solve(ThreadPool& threadPool, const vector_t& x0,
         UNew_[t - 1].noalias() += alpha * (B.transpose() * V_[t - 1]);
 
         // XNew_[t] = X_[t] - alpha * (Q * X_[t] + q + C * V_[t - 1]);
-        XNew_[t] = X_[t] - alpha * q;
-        XNew_[t].array() -= alpha * C.array() * V_[t - 1].array();
+        XNew_[t] = X_[t] - alpha * (q + C.cwiseProduct(V_[t - 1]));
         XNew_[t].noalias() -= alpha * (Q * X_[t]);
 
         if (t != N) {
           const auto& ANext = dynamics[t].dfdx;
-          const auto& BNext = dynamics[t].dfdu;
-          const auto& CNext = scalingVectors[t];
-          const auto& bNext = dynamics[t].f;
-
           // dfdux
           const auto& PNext = cost[t].dfdux;
 
-          // vector_t VNext = W_[t] + (beta + betaLast) * (CNext * X_[t + 1] - ANext * X_[t] - BNext * U_[t] - bNext);
-          vector_t VNext = W_[t] - (beta + betaLast) * bNext;
-          VNext.array() += (beta + betaLast) * CNext.array() * X_[t + 1].array();
-          VNext.noalias() -= (beta + betaLast) * (ANext * X_[t]);
-          VNext.noalias() -= (beta + betaLast) * (BNext * U_[t]);
-
-          XNew_[t].noalias() += alpha * (ANext.transpose() * VNext);
+          if (t + 1 < tEnd) {
+            XNew_[t].noalias() += alpha * (ANext.transpose() * V_[t]);
+          } else {
+            // V_[t] belongs to the next worker and might not be ready yet.
+            // VNext = W_[t] + (beta + betaLast) * (CNext * X_[t + 1] - ANext * X_[t] - BNext * U_[t] - bNext);
+            VNext = scalingVectors[t].cwiseProduct(X_[t + 1]) - dynamics[t].f;
+            VNext.noalias() -= ANext * X_[t];
+            VNext.noalias() -= dynamics[t].dfdu * U_[t];
+            VNext = W_[t] + betaSum * VNext;
+            XNew_[t].noalias() += alpha * (ANext.transpose() * VNext);
+          }
           // Add dfdxu * du if it is not the final state.
           XNew_[t].noalias() -= alpha * (PNext.transpose() * U_[t]);
         }
-
-        workerOrder = ++finishedTaskCounter;
       }
 
-      if (workerOrder != N) {
-        std::unique_lock<std::mutex> lk(mux);
-        iterationFinished.wait(lk, [&shouldWait] { return !shouldWait; });
-        lk.unlock();
-      } else {
-        betaLast = beta;
-        // Adaptive step size
-        beta = pipgBounds.dualStepSize(k);
-        alpha = pipgBounds.primalStepSize(k);
-
-        if (k != 0 && k % settings().checkTerminationInterval == 0) {
-          constraintsViolationInfNorm =
-              *(std::max_element(constraintsViolationInfNormArray.begin(), constraintsViolationInfNormArray.end()));
-
-          solutionSSE = std::accumulate(solutionSEArray.begin(), solutionSEArray.end(), 0.0);
-          solutionSquaredNorm = std::accumulate(solutionSquaredNormArray.begin(), solutionSquaredNormArray.end(), 0.0);
-
-          isConverged = constraintsViolationInfNorm <= settings().absoluteTolerance &&
-                        (solutionSSE <= settings().relativeTolerance * settings().relativeTolerance * solutionSquaredNorm ||
-                         solutionSSE <= settings().absoluteTolerance);
+      // Multi-thread performance analysis
+      threadsWorkloadCounter[workerId] += tEnd - tBegin;
 
-          keepRunning = k < settings().maxNumIterations && !isConverged;
-        }
-
-        XNew_.swap(X_);
-        UNew_.swap(U_);
-        WNew_.swap(W_);
-
-        ++k;
-        finishedTaskCounter = 0;
-        timeIndex = 1;
-        {
-          std::lock_guard<std::mutex> lk(mux);
-          shouldWait = false;
-        }
-        iterationFinished.notify_all();
-      }
+      barrier.arriveAndWait(finishIteration);
     }
   };
-  threadPool.runParallel(std::move(updateVariablesTask), threadPool.numThreads() + 1U);
+  threadPool.runParallel(std::move(updateVariablesTask), numWorkers);
 
   xTrajectory = X_;
   uTrajectory = U_;
+  numIterations_ = k;
   const auto status = isConverged ? pipg::SolverStatus::SUCCESS : pipg::SolverStatus::MAX_ITER;
 
   if (settings().displayShortSummary) {
@@ -241,6 +275,9 @@ pipg::SolverStatus PipgSolver::solve(ThreadPool& threadPool, const vector_t& x0,
     std::cerr << "\n+++++++++++++++++++++++++++++++++++++++++++++\n";
     std::cerr << "Solver status: " << pipg::toString(status) << "\n";
     std::cerr << "Number of Iterations: " << k << " out of " << settings().maxNumIterations << "\n";
+    if (settings().useAdaptiveRestart) {
+      std::cerr << "Number of restarts: " << adaptiveRestart.getNumRestarts() << "\n";
+    }
     std::cerr << "Norm of delta primal solution: " << std::sqrt(solutionSSE) << "\n";
     std::cerr << "Constraints violation : " << constraintsViolationInfNorm << "\n";
     std::cerr << "Thread workload(ID: # of finished tasks): ";
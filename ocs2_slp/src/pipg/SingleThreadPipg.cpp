@@ -32,6 +32,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <iostream>
 #include <numeric>
 
+#include "ocs2_slp/pipg/PipgAdaptiveRestart.h"
+
 namespace ocs2 {
 namespace pipg {
 
@@ -50,9 +52,10 @@ SolverStatus singleThreadPipg(const pipg::Settings& settings, const Eigen::Spars
   size_t k = 0;
   bool isConverged = false;
   scalar_t constraintsViolationInfNorm;
+  AdaptiveRestart adaptiveRestart(settings, pipgBounds);
   while (k < settings.maxNumIterations && !isConverged) {
-    const auto beta = pipgBounds.dualStepSize(k);
-    const auto alpha = pipgBounds.primalStepSize(k);
+    const auto beta = adaptiveRestart.bounds().dualStepSize(adaptiveRestart.stepSizeIndex(k));
+    const auto alpha = adaptiveRestart.bounds().primalStepSize(adaptiveRestart.stepSizeIndex(k));
 
     z_old.swap(z);
 
@@ -86,6 +89,10 @@ SolverStatus singleThreadPipg(const pipg::Settings& settings, const Eigen::Spars
       isConverged =
           constraintsViolationInfNorm <= settings.absoluteTolerance &&
           (z_deltaNorm <= settings.relativeTolerance * settings.relativeTolerance * zNorm || z_deltaNorm <= settings.absoluteTolerance);
+
+      if (adaptiveRestart.update(k + 1, z_deltaNorm, alpha, isConverged)) {
+        isConverged = false;
+      }
     }
 
     ++k;
@@ -100,6 +107,9 @@ SolverStatus singleThreadPipg(const pipg::Settings& settings, const Eigen::Spars
     std::cerr << "\n+++++++++++++++++++++++++++++++++++++++++++++\n";
     std::cerr << "Solver status: " << pipg::toString(status) << "\n";
     std::cerr << "Number of Iterations: " << k << " out of " << settings.maxNumIterations << "\n";
+    if (settings.useAdaptiveRestart) {
+      std::cerr << "Number of restarts: " << adaptiveRestart.getNumRestarts() << "\n";
+    }
     std::cerr << "Norm of delta primal solution: " << (stackedSolution - z_old).norm() << "\n";
     std::cerr << "Constraints violation : " << constraintsViolationInfNorm << "\n";
   }
@@ -183,4 +183,44 @@ TEST_F(PIPGSolverTest, correctness) {
   ASSERT_TRUE(std::abs(PIPGConstraintViolation) < solver.settings().absoluteTolerance);
   EXPECT_TRUE(std::abs(QPConstraintViolation - PIPGConstraintViolation) < solver.settings().absoluteTolerance * 10.0);
   EXPECT_TRUE(std::abs(PIPGParallelCConstraintViolation - PIPGConstraintViolation) < solver.settings().absoluteTolerance * 10.0);
-}
\ No newline at end of file
+}
+
+TEST_F(PIPGSolverTest, adaptiveRestart) {
+  auto QPconstraints = constraintsApproximation;
+  QPconstraints.f = -QPconstraints.f;
+  ocs2::vector_t primalSolutionQP;
+  std::tie(primalSolutionQP, std::ignore) = ocs2::qp_solver::solveDenseQp(costApproximation, QPconstraints);
+
+  Eigen::JacobiSVD<ocs2::matrix_t> svd(costApproximation.dfdxx);
+  ocs2::vector_t s = svd.singularValues();
+  const ocs2::scalar_t lambda = s(0);
+  const ocs2::scalar_t mu = s(svd.rank() - 1);
+  Eigen::JacobiSVD<ocs2::matrix_t> svdGTG(constraintsApproximation.dfdx.transpose() * constraintsApproximation.dfdx);
+  const ocs2::scalar_t sigma = svdGTG.singularValues()(0);
+  const ocs2::pipg::PipgBounds pipgBounds{mu, lambda, sigma};
+
+  auto settings = solver.settings();
+  settings.useAdaptiveRestart = true;
+  ocs2::PipgSolver restartedSolver(settings);
+  restartedSolver.resize(solver.size());
+
+  ocs2::vector_t primalSolutionPIPG;
+  const auto status =
+      ocs2::pipg::singleThreadPipg(settings, costApproximation.dfdxx.sparseView(), costApproximation.dfdx,
+                                   constraintsApproximation.dfdx.sparseView(), constraintsApproximation.f,
+                                   ocs2::vector_t::Ones(solver.getNumDynamicsConstraints()), pipgBounds, primalSolutionPIPG);
+  EXPECT_EQ(status, ocs2::pipg::SolverStatus::SUCCESS);
+
+  ocs2::vector_array_t scalingVectors(N_, ocs2::vector_t::Ones(nx_));
+  ocs2::vector_array_t X, U;
+  const auto parallelStatus =
+      restartedSolver.solve(threadPool, x0, dynamicsArray, costArray, nullptr, scalingVectors, nullptr, pipgBounds, X, U);
+  EXPECT_EQ(parallelStatus, ocs2::pipg::SolverStatus::SUCCESS);
+  ocs2::vector_t primalSolutionPIPGParallel;
+  ocs2::toKktSolution(X, U, primalSolutionPIPGParallel);
+
+  EXPECT_TRUE(primalSolutionQP.isApprox(primalSolutionPIPG, settings.absoluteTolerance * 10.0))
+      << "Inf-norm of (QP - PIPG): " << (primalSolutionQP - primalSolutionPIPG).cwiseAbs().maxCoeff();
+  EXPECT_TRUE(primalSolutionQP.isApprox(primalSolutionPIPGParallel, settings.absoluteTolerance * 10.0))
+      << "Inf-norm of (QP - PIPGParallel): " << (primalSolutionQP - primalSolutionPIPGParallel).cwiseAbs().maxCoeff();
+}
@@ -40,7 +40,7 @@ namespace {
 
 std::pair<PrimalSolution, std::vector<PerformanceIndex>> solve(const VectorFunctionLinearApproximation& dynamicsMatrices,
                                                                const ScalarFunctionQuadraticApproximation& costMatrices,
-                                                               const ocs2::scalar_t tol) {
+                                                               const ocs2::scalar_t tol, bool useAdmm = false) {
   int n = dynamicsMatrices.dfdu.rows();
   int m = dynamicsMatrices.dfdu.cols();
 
@@ -85,6 +85,10 @@ std::pair<PrimalSolution, std::vector<PerformanceIndex>> solve(const VectorFunct
     settings.printLinesearch = true;
     settings.nThreads = 100;
     settings.pipgSettings = getPipgSettings();
+    settings.useAdmmQpSolver = useAdmm;
+    settings.admmSettings.absoluteTolerance = tol;
+    settings.admmSettings.relativeTolerance = tol;
+    settings.admmSettings.displayShortSummary = true;
     return settings;
   }();
 
@@ -121,3 +125,15 @@ TEST(testSlpSolver, test_unconstrained) {
   ASSERT_LE(result.second.size(), 2);
   ASSERT_LT(result.second.back().dynamicsViolationSSE, tol);
 }
+
+TEST(testSlpSolver, test_unconstrained_admm) {
+  int n = 3;
+  int m = 2;
+  const double tol = 1e-9;
+  const auto dynamics = ocs2::getRandomDynamics(n, m);
+  const auto costs = ocs2::getRandomCost(n, m);
+  const auto result = ocs2::solve(dynamics, costs, tol, true);
+
+  ASSERT_LE(result.second.size(), 2);
+  ASSERT_LT(result.second.back().dynamicsViolationSSE, tol);
+}
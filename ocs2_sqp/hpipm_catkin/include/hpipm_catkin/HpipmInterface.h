@@ -86,6 +86,23 @@ class HpipmInterface {
                      std::vector<ScalarFunctionQuadraticApproximation>& cost, std::vector<VectorFunctionLinearApproximation>* constraints,
                      vector_array_t& stateTrajectory, vector_array_t& inputTrajectory, bool verbose = false);
 
+  /**
+   * Re-solves the previously solved problem for new vectors b, q and r, reusing the Riccati factorization of the last solve() call.
+   * Only a backward pass over the vector terms and a forward rollout are performed, which is much cheaper than a new factorization.
+   * The matrices in dynamics and cost must be the same as in the last solve() call, and that call must have been unconstrained.
+   *
+   * @param x0 : Initial state (deviation).
+   * @param dynamics : Linearized approximation of the discrete dynamics. Only the vector terms may differ from the last solve() call.
+   * @param cost : Quadratic approximation of the cost. Only the vector terms may differ from the last solve() call.
+   * @param [out] stateTrajectory : Solution state (deviation) trajectory.
+   * @param [out] inputTrajectory : Solution input (deviation) trajectory.
+   * @param [out] costToGoGradient : If not nullptr, the linear term of the Riccati cost-to-go, see getRiccatiCostToGo().
+   * @return hpipm_status::SUCCESS or hpipm_status::NAN_SOL.
+   */
+  hpipm_status resolve(const vector_t& x0, const std::vector<VectorFunctionLinearApproximation>& dynamics,
+                       const std::vector<ScalarFunctionQuadraticApproximation>& cost, vector_array_t& stateTrajectory,
+                       vector_array_t& inputTrajectory, vector_array_t* costToGoGradient = nullptr);
+
   /**
    * Return the Riccati cost-to-go for the previously solved problem.
    * Extra information about the initial stage is needed to complete calculation.
@@ -143,9 +143,9 @@ class HpipmInterface::Impl {
     d_ocp_qp_ipm_arg_set_ric_alg(&settings.ric_alg, &arg_);
   }
 
-  void verifySizes(const vector_t& x0, std::vector<VectorFunctionLinearApproximation>& dynamics,
-                   std::vector<ScalarFunctionQuadraticApproximation>& cost,
-                   std::vector<VectorFunctionLinearApproximation>* constraints) const {
+  void verifySizes(const vector_t& x0, const std::vector<VectorFunctionLinearApproximation>& dynamics,
+                   const std::vector<ScalarFunctionQuadraticApproximation>& cost,
+                   const std::vector<VectorFunctionLinearApproximation>* constraints) const {
     if (dynamics.size() != ocpSize_.numStages) {
       throw std::runtime_error("[HpipmInterface] Inconsistent size of dynamics: " + std::to_string(dynamics.size()) + " with " +
                                std::to_string(ocpSize_.numStages) + " number of stages.");
@@ -300,6 +300,115 @@ class HpipmInterface::Impl {
     return hpipm_status(hpipmStatus);
   }
 
+  hpipm_status resolve(const vector_t& x0, const std::vector<VectorFunctionLinearApproximation>& dynamics,
+                       const std::vector<ScalarFunctionQuadraticApproximation>& cost, vector_array_t& stateTrajectory,
+                       vector_array_t& inputTrajectory, vector_array_t* costToGoGradient) {
+    const int N = ocpSize_.numStages;
+    verifySizes(x0, dynamics, cost, nullptr);
+
+    /*
+     * Backward pass over the vector terms with the factors of the last solve, where Lr * Lr' = R + B' * P * B and
+     * Ls = (S' + A' * P * B) * inv(Lr'):
+     *    l[k] = inv(Lr[k]) * (r[k] + B[k]' * (P[k+1] * b[k] + p[k+1]))
+     *    p[k] = q[k] + A[k]' * (P[k+1] * b[k] + p[k+1]) - Ls[k] * l[k]
+     * The optimal input is then u[k] = -inv(Lr[k]') * (Ls[k]' * x[k] + l[k]).
+     */
+    matrix_array_t Lr(N);
+    matrix_array_t Ls(N);
+    vector_array_t l(N);
+    vector_array_t p(N + 1);
+    matrix_t P(ocpSize_.numStates[N], ocpSize_.numStates[N]);
+    d_ocp_qp_ipm_get_ric_P(&qp_, &arg_, &workspace_, N, P.data());
+    p[N] = cost[N].dfdx;
+
+    vector_t pb;  // P[k+1] * b[k] + p[k+1]
+    for (int k = N - 1; k >= 0; --k) {
+      const auto numInput = ocpSize_.numInputs[k];
+      // k = 0. Absorb initial state into dynamics and cost as in solve()
+      pb = p[k + 1];
+      if (k == 0) {
+        vector_t b0 = dynamics[0].f;
+        b0.noalias() += dynamics[0].dfdx * x0;
+        pb.noalias() += P * b0;
+      } else {
+        pb.noalias() += P * dynamics[k].f;
+      }
+
+      if (numInput > 0) {
+        Lr[k].resize(numInput, numInput);
+        d_ocp_qp_ipm_get_ric_Lr(&qp_, &arg_, &workspace_, k, Lr[k].data());  // Lr matrix is lower triangular
+        LinearAlgebra::setTriangularMinimumEigenvalues(Lr[k]);
+        l[k] = cost[k].dfdu;
+        if (k == 0) {
+          l[k].noalias() += cost[0].dfdux * x0;
+        }
+        l[k].noalias() += dynamics[k].dfdu.transpose() * pb;
+        Lr[k].triangularView<Eigen::Lower>().solveInPlace(l[k]);
+      }
+
+      if (k > 0) {
+        p[k] = cost[k].dfdx;
+        p[k].noalias() += dynamics[k].dfdx.transpose() * pb;
+        if (numInput > 0) {
+          Ls[k].resize(ocpSize_.numStates[k], numInput);
+          d_ocp_qp_ipm_get_ric_Ls(&qp_, &arg_, &workspace_, k, Ls[k].data());
+          p[k].noalias() -= Ls[k] * l[k];
+        }
+        P.resize(ocpSize_.numStates[k], ocpSize_.numStates[k]);
+        d_ocp_qp_ipm_get_ric_P(&qp_, &arg_, &workspace_, k, P.data());
+      }
+    }
+
+    // k = 0, the initial state is not a decision variable. Complete the cost-to-go as in getRiccatiCostToGo()
+    if (costToGoGradient != nullptr) {
+      const auto& A0 = dynamics[0].dfdx;
+      const auto& B0 = dynamics[0].dfdu;
+      matrix_t P1(ocpSize_.numStates[1], ocpSize_.numStates[1]);
+      d_ocp_qp_ipm_get_ric_P(&qp_, &arg_, &workspace_, 1, P1.data());
+      pb = p[1];
+      pb.noalias() += P1 * dynamics[0].f;
+      p[0] = cost[0].dfdx;
+      p[0].noalias() += A0.transpose() * pb;
+      if (ocpSize_.numInputs[0] > 0) {
+        matrix_t tmp1 = cost[0].dfdux;
+        const matrix_t P1_A0 = P1 * A0;
+        tmp1.noalias() += B0.transpose() * P1_A0;
+        Lr[0].triangularView<Eigen::Lower>().solveInPlace(tmp1);
+        vector_t tmp2 = cost[0].dfdu;
+        tmp2.noalias() += B0.transpose() * pb;
+        Lr[0].triangularView<Eigen::Lower>().solveInPlace(tmp2);
+        p[0].noalias() -= tmp1.transpose() * tmp2;
+      }
+      *costToGoGradient = std::move(p);
+    }
+
+    // Forward rollout
+    stateTrajectory.resize(N + 1);
+    inputTrajectory.resize(N);
+    stateTrajectory[0] = x0;
+    for (int k = 0; k < N; ++k) {
+      const auto numInput = ocpSize_.numInputs[k];
+      if (numInput > 0) {
+        inputTrajectory[k] = -l[k];
+        if (k > 0) {
+          inputTrajectory[k].noalias() -= Ls[k].transpose() * stateTrajectory[k];
+        }
+        Lr[k].triangularView<Eigen::Lower>().transpose().solveInPlace(inputTrajectory[k]);
+      } else {
+        inputTrajectory[k].resize(0);
+      }
+
+      stateTrajectory[k + 1] = dynamics[k].f;
+      stateTrajectory[k + 1].noalias() += dynamics[k].dfdx * stateTrajectory[k];
+      stateTrajectory[k + 1].noalias() += dynamics[k].dfdu * inputTrajectory[k];
+      if (!stateTrajectory[k + 1].allFinite() || !inputTrajectory[k].allFinite()) {
+        return hpipm_status::NAN_SOL;
+      }
+    }
+
+    return hpipm_status::SUCCESS;
+  }
+
   bool getStateSolution(const vector_t& x0, vector_array_t& stateTrajectory) {
     stateTrajectory.resize(ocpSize_.numStages + 1);
     stateTrajectory.front() = x0;
@@ -538,6 +647,12 @@ hpipm_status HpipmInterface::solve(const vector_t& x0, std::vector<VectorFunctio
   return pImpl_->solve(x0, dynamics, cost, constraints, stateTrajectory, inputTrajectory, verbose);
 }
 
+hpipm_status HpipmInterface::resolve(const vector_t& x0, const std::vector<VectorFunctionLinearApproximation>& dynamics,
+                                     const std::vector<ScalarFunctionQuadraticApproximation>& cost, vector_array_t& stateTrajectory,
+                                     vector_array_t& inputTrajectory, vector_array_t* costToGoGradient) {
+  return pImpl_->resolve(x0, dynamics, cost, stateTrajectory, inputTrajectory, costToGoGradient);
+}
+
 std::vector<ScalarFunctionQuadraticApproximation> HpipmInterface::getRiccatiCostToGo(const VectorFunctionLinearApproximation& dynamics0,
                                                                                      const ScalarFunctionQuadraticApproximation& cost0) {
   return pImpl_->getRiccatiCostToGo(dynamics0, cost0);
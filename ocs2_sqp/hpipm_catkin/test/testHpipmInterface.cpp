@@ -338,3 +338,57 @@ TEST(test_hpiphm_interface, retrieveRiccati) {
     ASSERT_TRUE(uSol[k].isApprox(KSol[k] * xSol[k] + kSol[k]));
   }
 }
+
+TEST(test_hpiphm_interface, resolveWithNewVectors) {
+  int nx = 3;
+  int nu = 2;
+  int N = 5;
+
+  // Problem setup
+  ocs2::vector_t x0 = ocs2::vector_t::Random(nx);
+  std::vector<ocs2::VectorFunctionLinearApproximation> system;
+  std::vector<ocs2::ScalarFunctionQuadraticApproximation> cost;
+  for (int k = 0; k < N; k++) {
+    system.emplace_back(ocs2::getRandomDynamics(nx, nu));
+    cost.emplace_back(ocs2::getRandomCost(nx, nu));
+  }
+  cost.emplace_back(ocs2::getRandomCost(nx, 0));
+
+  // Interface
+  ocs2::OcpSize ocpSize(N, nx, nu);
+  ocs2::HpipmInterface hpipmInterface(ocpSize);
+
+  // Solve!
+  std::vector<ocs2::vector_t> xSol;
+  std::vector<ocs2::vector_t> uSol;
+  auto status = hpipmInterface.solve(x0, system, cost, nullptr, xSol, uSol, true);
+  ASSERT_EQ(status, hpipm_status::SUCCESS);
+
+  // Change only the vector terms
+  for (int k = 0; k < N; k++) {
+    system[k].f.setRandom();
+    cost[k].dfdx.setRandom();
+    cost[k].dfdu.setRandom();
+  }
+  cost[N].dfdx.setRandom();
+  x0.setRandom();
+
+  // Re-solve with the old factorization
+  std::vector<ocs2::vector_t> xResolve;
+  std::vector<ocs2::vector_t> uResolve;
+  ocs2::vector_array_t costToGoGradient;
+  status = hpipmInterface.resolve(x0, system, cost, xResolve, uResolve, &costToGoGradient);
+  ASSERT_EQ(status, hpipm_status::SUCCESS);
+
+  // Solve the new problem from scratch
+  status = hpipmInterface.solve(x0, system, cost, nullptr, xSol, uSol, true);
+  ASSERT_EQ(status, hpipm_status::SUCCESS);
+  const auto costToGo = hpipmInterface.getRiccatiCostToGo(system[0], cost[0]);
+
+  // Compare
+  ASSERT_TRUE(ocs2::isEqual(xSol, xResolve, 1e-9));
+  ASSERT_TRUE(ocs2::isEqual(uSol, uResolve, 1e-9));
+  for (int k = 0; k < (N + 1); k++) {
+    ASSERT_TRUE(costToGo[k].dfdx.isApprox(costToGoGradient[k], 1e-9));
+  }
+}
@@ -31,6 +31,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ocs2_core/Types.h>
 #include <ocs2_core/integration/SensitivityIntegrator.h>
+#include <ocs2_oc/qp_backend/AdmmSettings.h>
 
 #include <hpipm_catkin/HpipmInterfaceSettings.h>
 
@@ -52,14 +53,28 @@ struct Settings {
   scalar_t g_min = 1e-6;         // (2): ELSE IF (g{i} < g_min AND g{i+1} < g_min AND dc/dw'{i} * delta_w < 0) REQUIRE armijo condition
   scalar_t armijoFactor = 1e-4;  // Armijo condition: c{i+1} < c{i} + armijoFactor * dc/dw'{i} * delta_w
   scalar_t gamma_c = 1e-6;       // (3): ELSE REQUIRE c{i+1} < (c{i} - gamma_c * g{i}) OR g{i+1} < (1-gamma_c) * g{i}
+  size_t filterHistorySize = 0;  // Number of past (c, g) pairs a step must not be dominated by. 0 only compares against the baseline.
+
+  // Linesearch - second-order correction. If the full step is rejected and increases the constraint violation, the QP is re-solved
+  // with the dynamics defects at the trial point, reusing the Riccati factorization of the QP solution. The correction is skipped
+  // with the ADMM backend and when state-input equality constraints are not projected.
+  bool useSecondOrderCorrection = false;
 
   // controller type
   bool useFeedbackPolicy = true;     // true to use feedback, false to use feedforward
   bool createValueFunction = false;  // true to store the value function, false to ignore it
 
+  // Warm start: beyond the end of the previous solution, continue its final policy through the dynamics instead of using the Initializer
+  bool warmStartPolicyContinuation = false;
+
   // QP subproblem solver settings
   hpipm_interface::Settings hpipmSettings = hpipm_interface::Settings();
 
+  // Solve the QP subproblem with the ADMM backend instead of HPIPM. The feedback policy and the value function require the Riccati
+  // factorization of HPIPM; therefore, useFeedbackPolicy and createValueFunction are ignored.
+  bool useAdmmQpSolver = false;
+  admm::Settings admmSettings = admm::Settings();
+
   // Discretization method
   scalar_t dt = 0.01;  // user-defined time discretization
   SensitivityIntegratorType integratorType = SensitivityIntegratorType::RK2;
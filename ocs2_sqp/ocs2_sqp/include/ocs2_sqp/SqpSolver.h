@@ -38,6 +38,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_oc/oc_data/TimeDiscretization.h>
 #include <ocs2_oc/oc_problem/OptimalControlProblem.h>
 #include <ocs2_oc/oc_solver/SolverBase.h>
+#include <ocs2_oc/qp_backend/OcpQpBackend.h>
 #include <ocs2_oc/search_strategy/FilterLinesearch.h>
 
 #include <hpipm_catkin/HpipmInterface.h>
@@ -145,6 +146,13 @@ class SqpSolver : public SolverBase {
                          const OcpSubproblemSolution& subproblemSolution, vector_array_t& x, vector_array_t& u,
                          std::vector<Metrics>& metrics);
 
+  /**
+   * Computes the second-order correction of a rejected full step: The QP is re-solved with the dynamics defects shifted by the ones
+   * at the trial point, reusing the Riccati factorization of the last QP solution. Returns false if the correction is not available.
+   */
+  bool computeSecondOrderCorrection(const vector_t& delta_x0, const std::vector<Metrics>& trialMetrics, vector_array_t& dxSoc,
+                                    vector_array_t& duSoc);
+
   /** Determine convergence after a step */
   sqp::Convergence checkConvergence(int iteration, const PerformanceIndex& baseline, const sqp::StepInfo& stepInfo) const;
 
@@ -158,10 +166,15 @@ class SqpSolver : public SolverBase {
 
   // Solver interface
   HpipmInterface hpipmInterface_;
+  std::unique_ptr<OcpQpBackend> qpBackendPtr_;  // Used instead of HPIPM if set
 
   // Threading
   ThreadPool threadPool_;
 
+  // Snapshots of the references, kept alive for the whole run
+  std::shared_ptr<const ModeSchedule> modeScheduleSnapshot_;
+  std::shared_ptr<const TargetTrajectories> targetTrajectoriesSnapshot_;
+
   // Solution
   PrimalSolution primalSolution_;
 
@@ -47,6 +47,10 @@ struct StepInfo {
   scalar_t stepSize = 0.0;
   FilterLinesearch::StepType stepType = FilterLinesearch::StepType::UNKNOWN;
 
+  // Number of evaluated trial points, including a second-order correction, and whether the corrected step was accepted
+  size_t numTrials = 0;
+  bool secondOrderCorrection = false;
+
   // Step in primal variables
   scalar_t dx_norm = 0.0;  // norm of the state trajectory update
   scalar_t du_norm = 0.0;  // norm of the input trajectory update
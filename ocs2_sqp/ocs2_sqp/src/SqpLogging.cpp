@@ -51,6 +51,8 @@ std::ostream& operator<<(std::ostream& stream, const LogEntry& logEntry) {
           << logEntry.totalConstraintViolationBaseline << delim
           << logEntry.stepInfo.stepSize << delim
           << toString(logEntry.stepInfo.stepType) << delim
+          << logEntry.stepInfo.numTrials << delim
+          << logEntry.stepInfo.secondOrderCorrection << delim
           << logEntry.stepInfo.dx_norm << delim
           << logEntry.stepInfo.du_norm << delim
           << logEntry.stepInfo.performanceAfterStep.merit << delim
@@ -79,6 +81,8 @@ std::string logHeader() {
           << "totalConstraintViolationBaseline" << delim
           << "stepSize" << delim
           << "stepType" << delim
+          << "numTrials" << delim
+          << "secondOrderCorrection" << delim
           << "dxNorm" << delim
           << "duNorm" << delim
           << "performanceAfterStep/merit" << delim
@@ -41,6 +41,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_oc/multiple_shooting/PerformanceIndexComputation.h>
 #include <ocs2_oc/multiple_shooting/Transcription.h>
 #include <ocs2_oc/oc_problem/OcpSize.h>
+#include <ocs2_oc/oc_solver/ContinuationInitializer.h>
+#include <ocs2_oc/qp_backend/AdmmQpBackend.h>
 #include <ocs2_oc/trajectory_adjustment/TrajectorySpreadingHelperFunctions.h>
 
 namespace ocs2 {
@@ -51,6 +53,11 @@ sqp::Settings rectifySettings(const OptimalControlProblem& ocp, sqp::Settings&&
   if (ocp.equalityConstraintPtr->empty()) {
     settings.projectStateInputEqualityConstraints = false;
   }
+  // The Riccati feedback and cost-to-go are only available with HPIPM.
+  if (settings.useAdmmQpSolver) {
+    settings.useFeedbackPolicy = false;
+    settings.createValueFunction = false;
+  }
   return settings;
 }
 }  // anonymous namespace
@@ -73,13 +80,23 @@ SqpSolver::SqpSolver(sqp::Settings settings, const OptimalControlProblem& optima
   }
 
   // Operating points
-  initializerPtr_.reset(initializer.clone());
+  if (settings_.warmStartPolicyContinuation) {
+    initializerPtr_.reset(new ContinuationInitializer(initializer, *optimalControlProblem.dynamicsPtr, settings_.integratorType));
+  } else {
+    initializerPtr_.reset(initializer.clone());
+  }
+
+  // QP backend
+  if (settings_.useAdmmQpSolver) {
+    qpBackendPtr_.reset(new AdmmQpBackend(settings_.admmSettings, threadPool_));
+  }
 
   // Linesearch
   filterLinesearch_.g_max = settings_.g_max;
   filterLinesearch_.g_min = settings_.g_min;
   filterLinesearch_.gamma_c = settings_.gamma_c;
   filterLinesearch_.armijoFactor = settings_.armijoFactor;
+  filterLinesearch_.maxHistory = settings_.filterHistorySize;
 }
 
 SqpSolver::~SqpSolver() {
@@ -187,27 +204,34 @@ void SqpSolver::runImpl(scalar_t initTime, const vector_t& initState, scalar_t f
     std::cerr << "\n++++++++++++++++++++++++++++++++++++++++++++++++++++++\n";
   }
 
+  // Take the snapshots of the references for this run
+  modeScheduleSnapshot_ = this->getReferenceManager().getModeScheduleSnapshot();
+  targetTrajectoriesSnapshot_ = this->getReferenceManager().getTargetTrajectoriesSnapshot();
+
   // Determine time discretization, taking into account event times.
-  const auto& eventTimes = this->getReferenceManager().getModeSchedule().eventTimes;
+  const auto& eventTimes = modeScheduleSnapshot_->eventTimes;
   const auto timeDiscretization = timeDiscretizationWithEvents(initTime, finalTime, settings_.dt, eventTimes);
 
   // Initialize references
   for (auto& ocpDefinition : ocpDefinitions_) {
-    const auto& targetTrajectories = this->getReferenceManager().getTargetTrajectories();
-    ocpDefinition.targetTrajectoriesPtr = &targetTrajectories;
+    ocpDefinition.targetTrajectoriesPtr = targetTrajectoriesSnapshot_.get();
   }
 
   // Trajectory spread of primalSolution_
   if (!primalSolution_.timeTrajectory_.empty()) {
-    std::ignore = trajectorySpread(primalSolution_.modeSchedule_, this->getReferenceManager().getModeSchedule(), primalSolution_);
+    std::ignore = trajectorySpread(primalSolution_.modeSchedule_, *modeScheduleSnapshot_, primalSolution_);
   }
 
   // Initialize the state and input
   vector_array_t x, u;
+  if (settings_.warmStartPolicyContinuation) {
+    static_cast<ContinuationInitializer&>(*initializerPtr_).setPolicy(primalSolution_);
+  }
   multiple_shooting::initializeStateInputTrajectories(initState, timeDiscretization, primalSolution_, *initializerPtr_, x, u);
 
   // Bookkeeping
   performanceIndeces_.clear();
+  filterLinesearch_.clearFilter();
   std::vector<Metrics> metrics;
 
   int iter = 0;
@@ -284,7 +308,20 @@ SqpSolver::OcpSubproblemSolution SqpSolver::getOCPSolution(const vector_t& delta
   auto& deltaUSol = solution.deltaUSol;
   hpipm_status status;
   const bool hasStateInputConstraints = !ocpDefinitions_.front().equalityConstraintPtr->empty();
-  if (hasStateInputConstraints && !settings_.projectStateInputEqualityConstraints) {
+  if (qpBackendPtr_ != nullptr) {
+    const auto* constraintsPtr =
+        (hasStateInputConstraints && !settings_.projectStateInputEqualityConstraints) ? &stateInputEqConstraints_ : nullptr;
+    qpBackendPtr_->resize(extractSizesFromProblem(dynamics_, cost_, constraintsPtr));
+    const auto backendStatus = qpBackendPtr_->solve(delta_x0, dynamics_, cost_, constraintsPtr, deltaXSol, deltaUSol);
+    if (settings_.printSolverStatus) {
+      std::cerr << qpBackendPtr_->name() << " status: " << toString(backendStatus) << ", iterations: " << qpBackendPtr_->getNumIterations()
+                << "\n";
+    }
+    if (backendStatus == OcpQpBackend::Status::NUMERICAL_ERROR) {
+      throw std::runtime_error("[SqpSolver] Failed to solve QP with " + qpBackendPtr_->name());
+    }
+    status = hpipm_status::SUCCESS;
+  } else if (hasStateInputConstraints && !settings_.projectStateInputEqualityConstraints) {
     hpipmInterface_.resize(extractSizesFromProblem(dynamics_, cost_, &stateInputEqConstraints_));
     status =
         hpipmInterface_.solve(delta_x0, dynamics_, cost_, &stateInputEqConstraints_, deltaXSol, deltaUSol, settings_.printSolverStatus);
@@ -319,8 +356,8 @@ void SqpSolver::extractValueFunction(const std::vector<AnnotatedTime>& time, con
 }
 
 PrimalSolution SqpSolver::toPrimalSolution(const std::vector<AnnotatedTime>& time, vector_array_t&& x, vector_array_t&& u) {
+  ModeSchedule modeSchedule = *modeScheduleSnapshot_;
   if (settings_.useFeedbackPolicy) {
-    ModeSchedule modeSchedule = this->getReferenceManager().getModeSchedule();
     matrix_array_t KMatrices = hpipmInterface_.getRiccatiFeedback(dynamics_[0], cost_[0]);
     if (settings_.projectStateInputEqualityConstraints) {
       multiple_shooting::remapProjectedGain(constraintsProjection_, KMatrices);
@@ -328,7 +365,6 @@ PrimalSolution SqpSolver::toPrimalSolution(const std::vector<AnnotatedTime>& tim
     return multiple_shooting::toPrimalSolution(time, std::move(modeSchedule), std::move(x), std::move(u), std::move(KMatrices));
 
   } else {
-    ModeSchedule modeSchedule = this->getReferenceManager().getModeSchedule();
     return multiple_shooting::toPrimalSolution(time, std::move(modeSchedule), std::move(x), std::move(u));
   }
 }
@@ -490,6 +526,21 @@ sqp::StepInfo SqpSolver::takeStep(const PerformanceIndex& baseline, const std::v
   const auto deltaUnorm = multiple_shooting::trajectoryNorm(du);
   const auto deltaXnorm = multiple_shooting::trajectoryNorm(dx);
 
+  // Prepare step info of an accepted step
+  size_t numTrials = 0;
+  auto acceptedStepInfo = [&](scalar_t stepSize, StepType stepType, scalar_t dxNorm, scalar_t duNorm, const PerformanceIndex& performance) {
+    filterLinesearch_.augmentFilter(baseline, stepType);
+    sqp::StepInfo stepInfo;
+    stepInfo.stepSize = stepSize;
+    stepInfo.stepType = stepType;
+    stepInfo.numTrials = numTrials;
+    stepInfo.dx_norm = dxNorm;
+    stepInfo.du_norm = duNorm;
+    stepInfo.performanceAfterStep = performance;
+    stepInfo.totalConstraintViolationAfterStep = FilterLinesearch::totalConstraintViolation(performance);
+    return stepInfo;
+  };
+
   scalar_t alpha = 1.0;
   vector_array_t xNew(x.size());
   vector_array_t uNew(u.size());
@@ -501,6 +552,7 @@ sqp::StepInfo SqpSolver::takeStep(const PerformanceIndex& baseline, const std::v
 
     // Compute cost and constraints
     const PerformanceIndex performanceNew = computePerformance(timeDiscretization, initState, xNew, uNew, metricsNew);
+    ++numTrials;
 
     // Step acceptance and record step type
     bool stepAccepted;
@@ -519,35 +571,59 @@ sqp::StepInfo SqpSolver::takeStep(const PerformanceIndex& baseline, const std::v
       x = std::move(xNew);
       u = std::move(uNew);
       metrics = std::move(metricsNew);
+      return acceptedStepInfo(alpha, stepType, alpha * deltaXnorm, alpha * deltaUnorm, performanceNew);
+    }
 
-      // Prepare step info
-      sqp::StepInfo stepInfo;
-      stepInfo.stepSize = alpha;
-      stepInfo.stepType = stepType;
-      stepInfo.dx_norm = alpha * deltaXnorm;
-      stepInfo.du_norm = alpha * deltaUnorm;
-      stepInfo.performanceAfterStep = performanceNew;
-      stepInfo.totalConstraintViolationAfterStep = FilterLinesearch::totalConstraintViolation(performanceNew);
-      return stepInfo;
-
-    } else {  // Try smaller step
-      alpha *= settings_.alpha_decay;
-
-      // Detect too small step size during back-tracking to escape early. Prevents going all the way to alpha_min
-      if (alpha * deltaXnorm < settings_.deltaTol && alpha * deltaUnorm < settings_.deltaTol) {
+    // Second-order correction of a rejected full step that increases the constraint violation
+    if (alpha == 1.0 && settings_.useSecondOrderCorrection &&
+        FilterLinesearch::totalConstraintViolation(performanceNew) >= baselineConstraintViolation) {
+      vector_array_t dxSoc, duSoc;
+      if (computeSecondOrderCorrection(initState - x.front(), metricsNew, dxSoc, duSoc)) {
+        multiple_shooting::incrementTrajectory(u, duSoc, 1.0, uNew);
+        multiple_shooting::incrementTrajectory(x, dxSoc, 1.0, xNew);
+        const PerformanceIndex performanceSoc = computePerformance(timeDiscretization, initState, xNew, uNew, metricsNew);
+        ++numTrials;
+
+        std::tie(stepAccepted, stepType) = filterLinesearch_.acceptStep(baseline, performanceSoc, subproblemSolution.armijoDescentMetric);
+
+        const auto dxSocNorm = multiple_shooting::trajectoryNorm(dxSoc);
+        const auto duSocNorm = multiple_shooting::trajectoryNorm(duSoc);
         if (settings_.printLinesearch) {
-          std::cerr << "Exiting linesearch early due to too small primal steps |dx|: " << alpha * deltaXnorm
-                    << ", and or |du|: " << alpha * deltaUnorm << " are below deltaTol: " << settings_.deltaTol << "\n";
+          std::cerr << "Second-order correction, Step Type: " << toString(stepType)
+                    << (stepAccepted ? std::string{" (Accepted)"} : std::string{" (Rejected)"}) << "\n";
+          std::cerr << "|dx| = " << dxSocNorm << "\t|du| = " << duSocNorm << "\n";
+          std::cerr << performanceSoc << "\n";
+        }
+
+        if (stepAccepted) {
+          x = std::move(xNew);
+          u = std::move(uNew);
+          metrics = std::move(metricsNew);
+          auto stepInfo = acceptedStepInfo(1.0, stepType, dxSocNorm, duSocNorm, performanceSoc);
+          stepInfo.secondOrderCorrection = true;
+          return stepInfo;
         }
-        break;
       }
     }
+
+    // Try smaller step
+    alpha *= settings_.alpha_decay;
+
+    // Detect too small step size during back-tracking to escape early. Prevents going all the way to alpha_min
+    if (alpha * deltaXnorm < settings_.deltaTol && alpha * deltaUnorm < settings_.deltaTol) {
+      if (settings_.printLinesearch) {
+        std::cerr << "Exiting linesearch early due to too small primal steps |dx|: " << alpha * deltaXnorm
+                  << ", and or |du|: " << alpha * deltaUnorm << " are below deltaTol: " << settings_.deltaTol << "\n";
+      }
+      break;
+    }
   } while (alpha >= settings_.alpha_min);
 
   // Alpha_min reached -> Don't take a step
   sqp::StepInfo stepInfo;
   stepInfo.stepSize = 0.0;
   stepInfo.stepType = StepType::ZERO;
+  stepInfo.numTrials = numTrials;
   stepInfo.dx_norm = 0.0;
   stepInfo.du_norm = 0.0;
   stepInfo.performanceAfterStep = baseline;
@@ -560,6 +636,33 @@ sqp::StepInfo SqpSolver::takeStep(const PerformanceIndex& baseline, const std::v
   return stepInfo;
 }
 
+bool SqpSolver::computeSecondOrderCorrection(const vector_t& delta_x0, const std::vector<Metrics>& trialMetrics, vector_array_t& dxSoc,
+                                             vector_array_t& duSoc) {
+  // The correction reuses the Riccati factorization of the last unconstrained HPIPM solve
+  const bool hasStateInputConstraints = !ocpDefinitions_.front().equalityConstraintPtr->empty();
+  if (qpBackendPtr_ != nullptr || (hasStateInputConstraints && !settings_.projectStateInputEqualityConstraints)) {
+    return false;
+  }
+
+  // Shift the dynamics defects by the ones at the trial point. The initial state constraint is satisfied by any full step.
+  const int N = static_cast<int>(dynamics_.size());
+  for (int i = 0; i < N; ++i) {
+    dynamics_[i].f += trialMetrics[i].dynamicsViolation;
+  }
+  const auto status = hpipmInterface_.resolve(delta_x0, dynamics_, cost_, dxSoc, duSoc);
+  for (int i = 0; i < N; ++i) {
+    dynamics_[i].f -= trialMetrics[i].dynamicsViolation;
+  }
+
+  if (status != hpipm_status::SUCCESS) {
+    return false;
+  }
+  if (settings_.projectStateInputEqualityConstraints) {
+    multiple_shooting::remapProjectedInput(constraintsProjection_, dxSoc, duSoc);
+  }
+  return true;
+}
+
 sqp::Convergence SqpSolver::checkConvergence(int iteration, const PerformanceIndex& baseline, const sqp::StepInfo& stepInfo) const {
   using Convergence = sqp::Convergence;
   if ((iteration + 1) >= settings_.sqpIteration) {
@@ -141,3 +141,46 @@ TEST(test_circular_kinematics, solve_EqConstraints_inQPSubproblem) {
     ASSERT_TRUE(u.isApprox(primalSolution.controllerPtr_->computeInput(t, x)));
   }
 }
+
+TEST(test_circular_kinematics, solve_projected_EqConstraints_FilterHistory_SecondOrderCorrection) {
+  // optimal control problem
+  ocs2::OptimalControlProblem problem = ocs2::createCircularKinematicsProblem("/tmp/ocs2/sqp_test_generated");
+
+  // Initializer
+  ocs2::DefaultInitializer zeroInitializer(2);
+
+  // Solver settings
+  ocs2::sqp::Settings settings;
+  settings.dt = 0.01;
+  settings.sqpIteration = 20;
+  settings.projectStateInputEqualityConstraints = true;
+  settings.printLinesearch = true;
+  settings.nThreads = 1;
+
+  // Additional problem definitions
+  const ocs2::scalar_t startTime = 0.0;
+  const ocs2::scalar_t finalTime = 1.0;
+  const ocs2::vector_t initState = (ocs2::vector_t(2) << 1.0, 0.0).finished();  // radius 1.0
+
+  // Solve with the default linesearch
+  ocs2::SqpSolver solverDefault(settings, problem, zeroInitializer);
+  solverDefault.run(startTime, initState, finalTime);
+
+  // Solve with the filter history and the second-order correction
+  settings.filterHistorySize = 10;
+  settings.useSecondOrderCorrection = true;
+  ocs2::SqpSolver solver(settings, problem, zeroInitializer);
+  solver.run(startTime, initState, finalTime);
+
+  std::cerr << "Number of iterations, default: " << solverDefault.getNumIterations()
+            << ", with filter history and second-order correction: " << solver.getNumIterations() << "\n";
+
+  // Check constraint satisfaction.
+  const auto performance = solver.getPerformanceIndeces();
+  ASSERT_LT(performance.dynamicsViolationSSE, 1e-6);
+  ASSERT_LT(performance.equalityConstraintsSSE, 1e-6);
+
+  // Same solution as the default linesearch
+  EXPECT_NEAR(performance.cost, solverDefault.getPerformanceIndeces().cost, 1e-6);
+  EXPECT_LE(solver.getNumIterations(), solverDefault.getNumIterations());
+}
@@ -0,0 +1,91 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+
+#include "ocs2_sqp/SqpMpc.h"
+#include "ocs2_sqp/SqpSolver.h"
+
+#include <ocs2_core/initialization/DefaultInitializer.h>
+#include <ocs2_mpc/MpcRecord.h>
+
+#include <ocs2_oc/test/circular_kinematics.h>
+
+namespace {
+
+ocs2::sqp::Settings getSettings() {
+  ocs2::sqp::Settings settings;
+  settings.dt = 0.01;
+  settings.sqpIteration = 20;
+  settings.printSolverStatistics = false;
+  settings.printSolverStatus = false;
+  settings.printLinesearch = false;
+  settings.nThreads = 1;
+  return settings;
+}
+
+}  // unnamed namespace
+
+TEST(test_record_replay, reproduceMpcRuns) {
+  const std::string filePath = "/tmp/ocs2_sqp_record_replay_test.bin";
+  const ocs2::OptimalControlProblem problem = ocs2::createCircularKinematicsProblem("/tmp/ocs2/sqp_test_generated");
+  const ocs2::DefaultInitializer zeroInitializer(2);
+
+  // record the MPC runs along a perturbed trajectory
+  ocs2::mpc::Settings mpcSettings;
+  mpcSettings.timeHorizon_ = 1.0;
+  ocs2::SqpMpc mpc(mpcSettings, getSettings(), problem, zeroInitializer);
+  mpc.setRecorder(std::make_unique<ocs2::mpc_record::Recorder>(filePath));
+  ocs2::vector_t state = (ocs2::vector_t(2) << 1.0, 0.0).finished();
+  for (int i = 0; i < 5; i++) {
+    const ocs2::scalar_t time = 0.05 * i;
+    ASSERT_TRUE(mpc.run(time, state));
+    state = mpc.getSolverPtr()->primalSolution(time + 1.0).stateTrajectory_[5] + 0.01 * ocs2::vector_t::Ones(2);
+  }
+  mpc.setRecorder(nullptr);
+
+  const auto instances = ocs2::mpc_record::load(filePath);
+  ASSERT_EQ(instances.size(), 5);
+  EXPECT_FALSE(instances.front().warmStart);
+  EXPECT_TRUE(instances.back().warmStart);
+
+  // a fresh solver reproduces the recorded runs in any order
+  ocs2::SqpSolver solver(getSettings(), problem, zeroInitializer);
+  const std::vector<ocs2::mpc_record::Instance> reversed(instances.rbegin(), instances.rend());
+  const auto statistics = ocs2::mpc_record::replay(solver, reversed);
+  ASSERT_EQ(statistics.size(), instances.size());
+  for (size_t i = 0; i < instances.size(); i++) {
+    const auto& recorded = reversed[i].recordedStatistics;
+    EXPECT_EQ(statistics[i].numIterations, recorded.numIterations);
+    EXPECT_TRUE(statistics[i].performanceIndex.isApprox(recorded.performanceIndex, 1e-9)) << statistics[i];
+  }
+  std::remove(filePath.c_str());
+}